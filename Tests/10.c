@@ -0,0 +1,7 @@
+int a[5];
+
+void main()
+{
+	float a[100];
+	a[50]=1;
+}
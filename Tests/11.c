@@ -0,0 +1,6 @@
+void main()
+{
+	// Buffer
+	int a[100];
+	a[50]=1;
+}
@@ -0,0 +1,14 @@
+char f(char c)
+{
+	c = c + 200;
+	return c;
+}
+
+void main()
+{
+	int x;
+	x = f(100);
+	if (f(100) > 255) {
+		x = 0;
+	}
+}
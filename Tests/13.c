@@ -0,0 +1,18 @@
+int g(int x)
+{
+	return x * 65536 * 65536;
+}
+
+int h()
+{
+	return g(3);
+}
+
+void main()
+{
+	int y;
+	y = g(3) + 1;
+	while (h() != 0) {
+		y = y - 1;
+	}
+}
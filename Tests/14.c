@@ -0,0 +1,20 @@
+int a[3];
+
+int set(int i)
+{
+	if (i > 2) {
+		return 0;
+	}
+	a[i] = 1;
+	return 1;
+}
+
+void main()
+{
+	int b[2];
+	if (0) a[3] = 1;
+	while (set(3)) {
+		b[2] = 0;
+	}
+	b[0] = set(0) && b[1];
+}
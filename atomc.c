@@ -0,0 +1,183 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "atomc.h"
+#include "hugemem.h"
+#include "parser.h"
+#include "strpool.h"
+#include "bounds.h"
+
+#define ATOMC_DIAG_CAPACITY 4096
+#define ATOMC_RETAIN_BYTES (16 * 1024 * 1024)
+
+struct AtomcContext {
+    char *source;           // NUL-terminated copy of the input
+    size_t sourceCapacity;
+    Token *tokens;
+    int tokenCapacity;
+    int tokenCount;
+    int *brackets;          // Bracket index for the bounds check, one per token plus one
+    int bracketCapacity;
+    StringPool strings;     // Decoded string literals of the last compilation
+    LineIndex lines;        // Line table of source, built only for errors
+    char *diagBuffer;
+    ParseDiagnostics diag;
+    char *name;             // For bounds errors, NULL for "<source>"
+    BoundsWorkspace *bounds;    // Scratch arrays of the bounds check
+};
+
+AtomcContext *atomc_context_new(void) {
+    AtomcContext *ctx = (AtomcContext *)calloc(1, sizeof(AtomcContext));
+    if (!ctx) {
+        return NULL;
+    }
+    ctx->diagBuffer = (char *)malloc(ATOMC_DIAG_CAPACITY);
+    ctx->bounds = bounds_workspace_new();
+    if (!ctx->diagBuffer || !ctx->bounds) {
+        free(ctx->diagBuffer);
+        bounds_workspace_free(ctx->bounds);
+        free(ctx);
+        return NULL;
+    }
+    ctx->diagBuffer[0] = '\0';
+    ctx->diag.buffer = ctx->diagBuffer;
+    ctx->diag.capacity = ATOMC_DIAG_CAPACITY;
+    line_index_init(&ctx->lines, NULL);
+    ctx->diag.lines = &ctx->lines;
+    return ctx;
+}
+
+void atomc_context_free(AtomcContext *ctx) {
+    if (!ctx) {
+        return;
+    }
+    free(ctx->source);
+    huge_free(ctx->tokens);
+    free(ctx->brackets);
+    string_pool_free(&ctx->strings);
+    line_index_free(&ctx->lines);
+    free(ctx->diagBuffer);
+    free(ctx->name);
+    bounds_workspace_free(ctx->bounds);
+    free(ctx);
+}
+
+void atomc_context_reset(AtomcContext *ctx) {
+    ctx->tokenCount = 0;
+    ctx->diag.length = 0;
+    ctx->diagBuffer[0] = '\0';
+    string_pool_clear(&ctx->strings);
+    line_index_free(&ctx->lines);
+
+    // Give back memory after an unusually large input
+    if (ctx->sourceCapacity > ATOMC_RETAIN_BYTES) {
+        free(ctx->source);
+        ctx->source = NULL;
+        ctx->sourceCapacity = 0;
+    }
+    if ((size_t)ctx->tokenCapacity * sizeof(Token) > ATOMC_RETAIN_BYTES) {
+        huge_free(ctx->tokens);
+        ctx->tokens = NULL;
+        ctx->tokenCapacity = 0;
+        free(ctx->brackets);
+        ctx->brackets = NULL;
+        ctx->bracketCapacity = 0;
+        // Its arrays grew with the tokens; a new one is made on the next compile
+        bounds_workspace_free(ctx->bounds);
+        ctx->bounds = NULL;
+    }
+    if (ctx->strings.capacity > ATOMC_RETAIN_BYTES) {
+        string_pool_free(&ctx->strings);
+    }
+}
+
+AtomcStatus atomc_compile_buffer(AtomcContext *ctx, const char *source, size_t length) {
+    if (!ctx || (!source && length > 0)) {
+        return ATOMC_ERROR_ARGUMENT;
+    }
+    ctx->tokenCount = 0;
+    ctx->diag.length = 0;
+    ctx->diagBuffer[0] = '\0';
+    string_pool_clear(&ctx->strings);
+
+    // The lexer works on NUL-terminated text, so copy into the reusable buffer
+    if (length + 1 > ctx->sourceCapacity) {
+        size_t capacity = ctx->sourceCapacity ? ctx->sourceCapacity : 4096;
+        while (capacity < length + 1) {
+            capacity *= 2;
+        }
+        char *buffer = (char *)realloc(ctx->source, capacity);
+        if (!buffer) {
+            return ATOMC_ERROR_MEMORY;
+        }
+        ctx->source = buffer;
+        ctx->sourceCapacity = capacity;
+    }
+    if (length > 0) {
+        memcpy(ctx->source, source, length);
+    }
+    ctx->source[length] = '\0';
+    line_index_free(&ctx->lines);
+    line_index_init(&ctx->lines, ctx->source);
+
+    if (!tokenize_source_into(ctx->source, &ctx->tokens, &ctx->tokenCapacity, &ctx->tokenCount)) {
+        ctx->tokenCount = 0;
+        return ATOMC_ERROR_MEMORY;
+    }
+    if (!intern_strings(ctx->source, ctx->tokens, ctx->tokenCount, &ctx->strings)) {
+        ctx->tokenCount = 0;
+        return ATOMC_ERROR_MEMORY;
+    }
+
+    if (!parseWithDiagnostics(ctx->tokens, ctx->tokenCount, &ctx->diag)) {
+        return ATOMC_ERROR_SYNTAX;
+    }
+
+    // The same array bounds check the command line runs by default
+    if (ctx->tokenCount + 1 > ctx->bracketCapacity) {
+        int *brackets = (int *)realloc(ctx->brackets, (ctx->tokenCount + 1) * sizeof(int));
+        if (!brackets) {
+            return ATOMC_ERROR_MEMORY;
+        }
+        ctx->brackets = brackets;
+        ctx->bracketCapacity = ctx->tokenCount + 1;
+    }
+    build_bracket_index(ctx->tokens, ctx->tokenCount, ctx->brackets);
+    if (!ctx->bounds && !(ctx->bounds = bounds_workspace_new())) {
+        return ATOMC_ERROR_MEMORY;
+    }
+    int bounds_ok = check_array_bounds_into(ctx->tokens, ctx->tokenCount, ctx->brackets,
+                                            ctx->name ? ctx->name : "<source>", ctx->bounds, &ctx->diag, NULL);
+    if (bounds_ok < 0) {
+        return ATOMC_ERROR_MEMORY;
+    }
+    return bounds_ok ? ATOMC_OK : ATOMC_ERROR_BOUNDS;
+}
+
+const char *atomc_diagnostics(const AtomcContext *ctx) {
+    return ctx->diagBuffer;
+}
+
+const Token *atomc_tokens(const AtomcContext *ctx, int *token_count) {
+    *token_count = ctx->tokenCount;
+    return ctx->tokens;
+}
+
+const StringPool *atomc_strings(const AtomcContext *ctx) {
+    return &ctx->strings;
+}
+
+void atomc_set_trace(AtomcContext *ctx, int enabled) {
+    ctx->diag.trace = enabled;
+}
+
+AtomcStatus atomc_set_name(AtomcContext *ctx, const char *name) {
+    char *copy = name ? strdup(name) : NULL;
+    if (name && !copy) {
+        return ATOMC_ERROR_MEMORY;
+    }
+    free(ctx->name);
+    ctx->name = copy;
+    return ATOMC_OK;
+}
@@ -0,0 +1,51 @@
+#ifndef ATOMC_H
+#define ATOMC_H
+
+#include <stddef.h>
+
+#include "lexer.h"
+#include "strpool.h"
+
+// Compiler-as-a-library API. A context owns every buffer a compilation
+// needs (source copy, tokens, string pool, diagnostics) and keeps them between calls,
+// so a long-lived service compiling many snippets allocates only while
+// the buffers are still growing. Nothing here exits or prints.
+
+typedef enum {
+    ATOMC_OK = 0,
+    ATOMC_ERROR_MEMORY,     // Out of memory, the context stays usable
+    ATOMC_ERROR_SYNTAX,     // See atomc_diagnostics for the messages
+    ATOMC_ERROR_ARGUMENT,
+    ATOMC_ERROR_BOUNDS      // A constant index outside its array, as reported by the CLI
+} AtomcStatus;
+
+typedef struct AtomcContext AtomcContext;
+
+AtomcContext *atomc_context_new(void);
+void atomc_context_free(AtomcContext *ctx);
+
+// Forget the last compilation. Buffers are kept for reuse unless they grew
+// past ATOMC_RETAIN_BYTES, in which case they are released.
+void atomc_context_reset(AtomcContext *ctx);
+
+// Compile length bytes of source (no NUL terminator needed)
+AtomcStatus atomc_compile_buffer(AtomcContext *ctx, const char *source, size_t length);
+
+// Messages of the last compilation ("" if there were none)
+const char *atomc_diagnostics(const AtomcContext *ctx);
+
+// Tokens of the last compilation, valid until the next call on ctx
+const Token *atomc_tokens(const AtomcContext *ctx, int *token_count);
+
+// Decoded string literals of the last compilation; token->literal.string
+// indexes into it. Valid until the next call on ctx.
+const StringPool *atomc_strings(const AtomcContext *ctx);
+
+// Include the parser's debug trace in the diagnostics
+void atomc_set_trace(AtomcContext *ctx, int enabled);
+
+// Name that bounds errors are reported under ("<source>" by default).
+// Returns ATOMC_ERROR_MEMORY if it cannot be copied.
+AtomcStatus atomc_set_name(AtomcContext *ctx, const char *name);
+
+#endif
@@ -0,0 +1,637 @@
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bounds.h"
+#include "constfold.h"
+#include "namemap.h"
+#include "util.h"
+
+#define SIZE_UNKNOWN -1     // Array whose size is not a constant
+#define NOT_AN_ARRAY -2     // Scalar; hides arrays of the same name
+#define MAX_LOOP_NESTING 32 // Deeper loops are not analyzed, which keeps the pass linear
+
+typedef struct {
+    int nameIndex;
+    long long size;
+    int scopeEnd;           // Token of the '}' that ends its scope
+    int previous;           // Declaration it hides, or -1
+} Declaration;
+
+// for(i=low;i<=high;i=i+1) with a body that leaves i alone
+typedef struct {
+    int var;                // Token of the induction variable in the header, -1 for other loops
+    long long low, high;
+    int bodyEnd;
+} CanonicalLoop;
+
+struct BoundsWorkspace {
+    Declaration *decls;
+    int declCapacity;
+    NameMap names;
+    int *scopes;
+    int scopeCapacity;
+    CanonicalLoop *loops;
+    int loopCapacity;
+    int *ends;
+    int endCapacity;
+};
+
+typedef struct {
+    const Token *tokens;
+    int tokenCount;
+    const int *brackets;
+    const char *filename;
+    LineIndex *lines;
+    int remarks;
+    FILE *out;
+    ParseDiagnostics *diag; // Instead of out when not NULL
+    BoundsReport *report;
+    ConstEvaluator constants;   // Array sizes and indices
+    Declaration *decls;     // Visible declarations, innermost last
+    int declCount, declCapacity;
+    NameMap names;          // Name to its innermost entry of decls
+    int *scopes;            // Open '{' tokens
+    int scopeCount, scopeCapacity;
+    CanonicalLoop *loops;   // for loops around the current token
+    int loopCount, loopCapacity;
+    int *ends;              // statement_end_memo of each token, -1 until known
+    int mainBody;           // '{' of main, -1 until seen
+    int statement;          // Statement of main holding the last access asked about
+    int statementEnd;
+    int scanned;            // Its tokens before this one were searched for && and ||
+    int shortCircuit;       // Whether one was found
+    int returned;           // Whether a statement of main before it was a return
+} BoundsChecker;
+
+// Write to out, or append to diag as the parser does
+static void emit(const BoundsChecker *checker, const char *format, ...) {
+    ParseDiagnostics *diag = checker->diag;
+    va_list args;
+    va_start(args, format);
+    if (!diag) {
+        vfprintf(checker->out, format, args);
+    } else if (!diag->buffer) {
+        vprintf(format, args);
+    } else if (diag->length + 1 < diag->capacity) {
+        int written = vsnprintf(diag->buffer + diag->length, diag->capacity - diag->length, format, args);
+        if (written > 0) {
+            diag->length += (size_t)written;
+            if (diag->length >= diag->capacity) {
+                diag->length = diag->capacity - 1;
+            }
+        }
+    }
+    va_end(args);
+}
+
+static void report_at(const BoundsChecker *checker, int index, const char *kind, const char *format, ...) {
+    char message[512];
+    int line, column;
+    va_list args;
+    va_start(args, format);
+    vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+    if (checker->lines && line_index_lookup(checker->lines, checker->tokens[index].offset, &line, &column)) {
+        emit(checker, "%s:%d:%d: %s: %s\n", checker->filename, line, column, kind, message);
+    } else {
+        emit(checker, "%s: token %d: %s: %s\n", checker->filename, index, kind, message);
+    }
+}
+
+static int same_name(const Token *tokens, int a, int b) {
+    return tokens[a].type == TOKEN_IDENTIFIER && tokens[b].type == TOKEN_IDENTIFIER &&
+           strcmp(tokens[a].value, tokens[b].value) == 0;
+}
+
+// Integer literal, optionally negated, at token i. *next receives the token after it.
+static int integer_at(const Token *tokens, int i, int end, long long *value, int *next) {
+    int negative = 0;
+    if (i < end && tokens[i].type == TOKEN_MINUS) {
+        negative = 1;
+        i++;
+    }
+    if (i >= end || (tokens[i].type != TOKEN_NUMBER_ZEC && tokens[i].type != TOKEN_NUMBER_HEX &&
+                     tokens[i].type != TOKEN_NUMBER_OCT)) {
+        return 0;
+    }
+    *value = negative ? -tokens[i].literal.integer : tokens[i].literal.integer;
+    *next = i + 1;
+    return 1;
+}
+
+static const Declaration *find_declaration(const BoundsChecker *checker, int name) {
+    int index = name_map_get(&checker->names, checker->tokens[name].value);
+    return index >= 0 ? &checker->decls[index] : NULL;
+}
+
+static int declare(BoundsChecker *checker, int name, long long size, int scope_end) {
+    if (!grow_array((void **)&checker->decls, &checker->declCapacity, checker->declCount, sizeof(Declaration))) {
+        return 0;
+    }
+    Declaration *decl = &checker->decls[checker->declCount];
+    decl->nameIndex = name;
+    decl->size = size;
+    decl->scopeEnd = scope_end;
+    decl->previous = name_map_get(&checker->names, checker->tokens[name].value);
+    if (!name_map_set(&checker->names, checker->tokens[name].value, checker->declCount)) {
+        return 0;
+    }
+    checker->declCount++;
+    return 1;
+}
+
+static int is_comment(const Token *token) {
+    return token->type == TOKEN_LINECOMMENT || token->type == TOKEN_MULTILINECOMMENT;
+}
+
+// Number of tokens before the first declarator if a declaration starts at k, else 0
+static int declaration_type_length(const Token *tokens, int token_count, int k) {
+    int previous = k - 1;
+    while (previous >= 0 && is_comment(&tokens[previous])) {
+        previous--;
+    }
+    if (previous >= 0 && tokens[previous].type != TOKEN_SEMICOLON && tokens[previous].type != TOKEN_LBRACE &&
+        tokens[previous].type != TOKEN_RBRACE) {
+        return 0;
+    }
+    if (token_is_keyword(&tokens[k], KEYWORD_INT) || token_is_keyword(&tokens[k], KEYWORD_FLOAT) ||
+        token_is_keyword(&tokens[k], KEYWORD_DOUBLE) || token_is_keyword(&tokens[k], KEYWORD_CHAR) ||
+        token_is_keyword(&tokens[k], KEYWORD_VOID)) {
+        return 1;
+    }
+    if (token_is_keyword(&tokens[k], KEYWORD_STRUCT) && k + 2 < token_count &&
+        tokens[k + 1].type == TOKEN_IDENTIFIER && tokens[k + 2].type != TOKEN_LBRACE) {
+        return 2;
+    }
+    return 0;
+}
+
+// Record the declarators of the declaration starting at k. Returns the
+// last token handled: the ';' of a variable declaration, or the ')' of a
+// function header, whose parameters are scoped to the body that follows.
+static int declare_all(BoundsChecker *checker, int k, int type_length, int *ok) {
+    const Token *tokens = checker->tokens;
+    const int *brackets = checker->brackets;
+    int scope_end = checker->scopeCount > 0 ? brackets[checker->scopes[checker->scopeCount - 1]]
+                                            : checker->tokenCount;
+    int i = k + type_length;
+
+    while (i < checker->tokenCount && tokens[i].type == TOKEN_IDENTIFIER) {
+        int name = i++;
+        if (i >= checker->tokenCount) {
+            return name;
+        }
+        if (tokens[i].type == TOKEN_LPAREN && brackets[i] > i) {
+            // Function header: parameters live until the end of the body
+            int close = brackets[i];
+            int body_end = close + 1 < checker->tokenCount && brackets[close + 1] > close + 1
+                               ? brackets[close + 1] : close;
+            if (body_end > close && checker->scopeCount == 0 && strcmp(tokens[name].value, "main") == 0) {
+                checker->mainBody = close + 1;
+                checker->statement = checker->statementEnd = close + 1;
+            }
+            for (int p = i + 1; p < close && *ok; p++) {
+                TokenType next = tokens[p + 1].type;
+                if (tokens[p].type == TOKEN_IDENTIFIER &&
+                    (next == TOKEN_COMMA || next == TOKEN_RPAREN || next == TOKEN_LBRACKET)) {
+                    *ok = declare(checker, p, next == TOKEN_LBRACKET ? SIZE_UNKNOWN : NOT_AN_ARRAY, body_end);
+                }
+            }
+            return close;
+        }
+
+        long long size = NOT_AN_ARRAY;
+        if (tokens[i].type == TOKEN_LBRACKET && brackets[i] > i) {
+            ConstValue value;
+            size = SIZE_UNKNOWN;
+            if (const_eval(&checker->constants, i + 1, brackets[i], &value) && !value.isReal) {
+                size = value.integer;
+            }
+        }
+        if (!(*ok = declare(checker, name, size, scope_end))) {
+            return i;
+        }
+        while (i < checker->tokenCount && tokens[i].type != TOKEN_COMMA && tokens[i].type != TOKEN_SEMICOLON) {
+            if (brackets[i] > i) {
+                i = brackets[i];
+            }
+            i++;
+        }
+        if (i >= checker->tokenCount || tokens[i].type == TOKEN_SEMICOLON) {
+            return i;
+        }
+        i++;    // Skip ','
+    }
+    return i;
+}
+
+// Recognize for(i=A;i<B;i=i+1) (also i<=B, i++, ++i and i=j=A) whose body
+// does not assign i. Calls in the body could change a global i, so those
+// only qualify for locals.
+static int canonical_loop(const BoundsChecker *checker, int k, CanonicalLoop *loop) {
+    const Token *tokens = checker->tokens;
+    int close = checker->brackets[k + 1];
+    int p = k + 2;
+    long long limit;
+
+    if (close < 0 || tokens[p].type != TOKEN_IDENTIFIER) {
+        return 0;
+    }
+    int var = p;
+    for (;;) {
+        if (tokens[p].type != TOKEN_IDENTIFIER || tokens[p + 1].type != TOKEN_ASSIGN) {
+            return 0;
+        }
+        p += 2;
+        if (integer_at(tokens, p, close, &loop->low, &p)) {
+            break;
+        }
+    }
+    if (tokens[p++].type != TOKEN_SEMICOLON || p + 2 >= close || !same_name(tokens, p, var) ||
+        (tokens[p + 1].type != TOKEN_LESS && tokens[p + 1].type != TOKEN_LESSEQUAL)) {
+        return 0;
+    }
+    int inclusive = tokens[p + 1].type == TOKEN_LESSEQUAL;
+    if (!integer_at(tokens, p + 2, close, &limit, &p) || tokens[p++].type != TOKEN_SEMICOLON) {
+        return 0;
+    }
+    loop->high = inclusive ? limit : limit - 1;
+
+    long long one;
+    int after;
+    int step = (p + 2 == close && tokens[p].type == TOKEN_PLUS_1 && same_name(tokens, p + 1, var)) ||
+               (p + 2 == close && same_name(tokens, p, var) && tokens[p + 1].type == TOKEN_PLUS_1) ||
+               (p + 5 == close && same_name(tokens, p, var) && tokens[p + 1].type == TOKEN_ASSIGN &&
+                same_name(tokens, p + 2, var) && tokens[p + 3].type == TOKEN_PLUS &&
+                integer_at(tokens, p + 4, close, &one, &after) && one == 1);
+    if (!step) {
+        return 0;
+    }
+
+    loop->var = var;
+    loop->bodyEnd = statement_end_memo(tokens, checker->tokenCount, checker->brackets, close + 1, checker->ends);
+    const Declaration *decl = find_declaration(checker, var);
+    int global = !decl || decl->scopeEnd == checker->tokenCount;
+    for (int i = close + 1; i <= loop->bodyEnd && i + 1 < checker->tokenCount; i++) {
+        if (same_name(tokens, i, var) &&
+            (tokens[i + 1].type == TOKEN_ASSIGN || tokens[i + 1].type == TOKEN_PLUS_1 ||
+             tokens[i + 1].type == TOKEN_MINUS_1 || tokens[i - 1].type == TOKEN_PLUS_1 ||
+             tokens[i - 1].type == TOKEN_MINUS_1)) {
+            return 0;
+        }
+        if (global && tokens[i].type == TOKEN_IDENTIFIER && tokens[i + 1].type == TOKEN_LPAREN) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Why the body of a canonical loop is not a set of element-wise stores
+// v[i]=... and sums s=s+..., or NULL if it is
+static const char *vectorize_blocker(const BoundsChecker *checker, const CanonicalLoop *loop,
+                                     int body_start, int *stores, int *sums) {
+    const Token *tokens = checker->tokens;
+    const int *brackets = checker->brackets;
+    int first = body_start, last = loop->bodyEnd;
+    if (tokens[body_start].type == TOKEN_LBRACE) {
+        first = body_start + 1;
+        last = loop->bodyEnd - 1;
+    }
+
+    *stores = *sums = 0;
+    for (int s = first; s <= last; ) {
+        if (tokens[s].type == TOKEN_KEYWORD || tokens[s].type == TOKEN_LBRACE) {
+            return "control flow in the loop body";
+        }
+        int e = s;
+        while (e <= last && tokens[e].type != TOKEN_SEMICOLON) {
+            TokenType type = tokens[e].type;
+            if (type == TOKEN_IDENTIFIER && tokens[e + 1].type == TOKEN_LPAREN) {
+                return "function call in the loop body";
+            }
+            if (type == TOKEN_DOT) {
+                return "struct field access";
+            }
+            if (type == TOKEN_PLUS_1 || type == TOKEN_MINUS_1) {
+                return "increment in the loop body";
+            }
+            if (type == TOKEN_LBRACKET && (brackets[e] != e + 2 || !same_name(tokens, e + 1, loop->var))) {
+                return "index other than the induction variable";
+            }
+            if (brackets[e] > e) {
+                e = brackets[e];
+            }
+            e++;
+        }
+        if (e == s) {
+            s++;    // Empty statement
+            continue;
+        }
+
+        if (tokens[s].type == TOKEN_IDENTIFIER && tokens[s + 1].type == TOKEN_LBRACKET &&
+            tokens[brackets[s + 1] + 1].type == TOKEN_ASSIGN) {
+            (*stores)++;
+        } else if (tokens[s].type == TOKEN_IDENTIFIER && tokens[s + 1].type == TOKEN_ASSIGN &&
+                   same_name(tokens, s + 2, s) && tokens[s + 3].type == TOKEN_PLUS) {
+            (*sums)++;
+        } else if (tokens[s].type == TOKEN_IDENTIFIER && tokens[s + 1].type == TOKEN_ASSIGN) {
+            return "scalar assigned in the loop body";
+        } else {
+            return "statement without a store";
+        }
+        s = e + 1;
+    }
+    if (*stores + *sums == 0) {
+        return "empty loop body";
+    }
+    return NULL;
+}
+
+// Whether the access at token k runs whenever the program does: it is in a
+// statement of main before any return, and not in the body of an if, while
+// or for, in a nested block or behind && or ||. Calls and loops are assumed
+// to return. Accesses come in token order, so main is walked once.
+static int always_runs(BoundsChecker *checker, int k) {
+    const Token *tokens = checker->tokens;
+    const int *brackets = checker->brackets;
+    int body = checker->mainBody;
+    if (body < 0 || k <= body || k >= brackets[body]) {
+        return 0;
+    }
+    while (checker->statementEnd < k && !checker->returned) {
+        if (checker->statement > body && token_is_keyword(&tokens[checker->statement], KEYWORD_RETURN)) {
+            checker->returned = 1;
+            break;
+        }
+        int s = checker->statementEnd + 1;
+        while (tokens[s].type == TOKEN_LINECOMMENT || tokens[s].type == TOKEN_MULTILINECOMMENT) {
+            s++;
+        }
+        checker->statement = checker->scanned = s;
+        checker->statementEnd = statement_end_memo(tokens, checker->tokenCount, brackets, s, checker->ends);
+        checker->shortCircuit = 0;
+    }
+    if (checker->returned) {
+        return 0;
+    }
+
+    const Token *first = &tokens[checker->statement];
+    if (first->type == TOKEN_LBRACE || token_is_keyword(first, KEYWORD_FOR)) {
+        return 0;
+    }
+    if (token_is_keyword(first, KEYWORD_IF) || token_is_keyword(first, KEYWORD_WHILE)) {
+        // Only the condition runs for sure
+        int close = brackets[checker->statement + 1];
+        if (close <= checker->statement + 1 || k >= close) {
+            return 0;
+        }
+    }
+    for (; checker->scanned < k; checker->scanned++) {
+        TokenType type = tokens[checker->scanned].type;
+        if (type == TOKEN_AND || type == TOKEN_OR) {
+            checker->shortCircuit = 1;
+        }
+    }
+    return !checker->shortCircuit;
+}
+
+static void check_access(BoundsChecker *checker, int k) {
+    const Token *tokens = checker->tokens;
+    const Declaration *decl = find_declaration(checker, k);
+    if (!decl || decl->size == NOT_AN_ARRAY) {
+        return;
+    }
+    if (decl->size == SIZE_UNKNOWN) {
+        checker->report->unproven++;
+        return;
+    }
+
+    int start = k + 2, end = checker->brackets[k + 1];
+    long long offset = 0;
+    int next;
+    ConstValue value;
+    if (const_eval(&checker->constants, start, end, &value) && !value.isReal) {
+        long long index = value.integer;
+        if ((index < 0 || index >= decl->size) && !always_runs(checker, k)) {
+            checker->report->warnings++;
+            report_at(checker, start, "warning", "index %lld is out of bounds of '%s' (size %lld)",
+                      index, tokens[k].value, decl->size);
+        } else if (index < 0 || index >= decl->size) {
+            report_at(checker, start, "error", "index %lld is out of bounds of '%s' (size %lld)",
+                      index, tokens[k].value, decl->size);
+            if (checker->report->errors++ == 0) {
+                checker->report->errorOffset = tokens[start].offset;
+            }
+        } else {
+            checker->report->proven++;
+        }
+        return;
+    }
+
+    // i, i+C or i-C with i the variable of an enclosing canonical loop
+    if (tokens[start].type == TOKEN_IDENTIFIER && start + 1 < end) {
+        if ((tokens[start + 1].type != TOKEN_PLUS && tokens[start + 1].type != TOKEN_MINUS) ||
+            !integer_at(tokens, start + 2, end, &offset, &next) || next != end) {
+            checker->report->unproven++;
+            return;
+        }
+        if (tokens[start + 1].type == TOKEN_MINUS) {
+            offset = -offset;
+        }
+    } else if (tokens[start].type != TOKEN_IDENTIFIER) {
+        checker->report->unproven++;
+        return;
+    }
+    for (int i = checker->loopCount - 1; i >= 0; i--) {
+        const CanonicalLoop *loop = &checker->loops[i];
+        if (loop->var < 0 || !same_name(tokens, loop->var, start)) {
+            continue;
+        }
+        long long low = loop->low + offset, high = loop->high + offset;
+        if (loop->high < loop->low || (low >= 0 && high < decl->size)) {
+            checker->report->proven++;
+            if (checker->remarks) {
+                report_at(checker, k, "remark", "bounds check on '%s' not needed: index stays in [%lld, %lld]",
+                          tokens[k].value, low, high);
+            }
+        } else {
+            checker->report->warnings++;
+            report_at(checker, start, "warning", "index of '%s' ranges over [%lld, %lld], out of bounds (size %lld)",
+                      tokens[k].value, low, high, decl->size);
+        }
+        return;
+    }
+    checker->report->unproven++;
+}
+
+BoundsWorkspace *bounds_workspace_new(void) {
+    return (BoundsWorkspace *)calloc(1, sizeof(BoundsWorkspace));
+}
+
+static void free_arrays(BoundsWorkspace *workspace) {
+    free(workspace->decls);
+    name_map_free(&workspace->names);
+    free(workspace->scopes);
+    free(workspace->loops);
+    free(workspace->ends);
+}
+
+void bounds_workspace_free(BoundsWorkspace *workspace) {
+    if (workspace) {
+        free_arrays(workspace);
+        free(workspace);
+    }
+}
+
+// Run the check with the arrays of workspace, which keeps them afterwards.
+// Returns 1 without errors, 0 with errors and -1 if out of memory.
+static int run_check(BoundsChecker *checker, BoundsWorkspace *workspace) {
+    const Token *tokens = checker->tokens;
+    const int *brackets = checker->brackets;
+    int token_count = checker->tokenCount;
+    int remarks = checker->remarks;
+
+    checker->decls = workspace->decls;
+    checker->declCapacity = workspace->declCapacity;
+    checker->names = workspace->names;
+    checker->scopes = workspace->scopes;
+    checker->scopeCapacity = workspace->scopeCapacity;
+    checker->loops = workspace->loops;
+    checker->loopCapacity = workspace->loopCapacity;
+    name_map_clear(&checker->names);
+    const_evaluator_init(&checker->constants, tokens, token_count, brackets, NULL);
+    memset(checker->report, 0, sizeof(BoundsReport));
+    checker->report->errorOffset = -1;
+    checker->mainBody = -1;
+    checker->returned = 0;
+
+    int ok = 1;
+    if (token_count > workspace->endCapacity) {
+        int *ends = (int *)realloc(workspace->ends, token_count * sizeof(int));
+        ok = ends != NULL;
+        if (ok) {
+            workspace->ends = ends;
+            workspace->endCapacity = token_count;
+        }
+    }
+    checker->ends = workspace->ends;
+    for (int k = 0; ok && k < token_count; k++) {
+        checker->ends[k] = -1;
+    }
+
+    for (int k = 0; ok && k < token_count; k++) {
+        while (checker->loopCount > 0 && checker->loops[checker->loopCount - 1].bodyEnd < k) {
+            checker->loopCount--;
+        }
+        const Token *token = &tokens[k];
+        int type_length;
+
+        if (token->type == TOKEN_LBRACE) {
+            // Struct members are not variables
+            if (k >= 2 && token_is_keyword(&tokens[k - 2], KEYWORD_STRUCT) && brackets[k] > k) {
+                k = brackets[k];
+                continue;
+            }
+            if (!(ok = grow_array((void **)&checker->scopes, &checker->scopeCapacity, checker->scopeCount, sizeof(int)))) {
+                break;
+            }
+            checker->scopes[checker->scopeCount++] = k;
+        } else if (token->type == TOKEN_RBRACE) {
+            while (ok && checker->declCount > 0 && checker->decls[checker->declCount - 1].scopeEnd == k) {
+                const Declaration *decl = &checker->decls[--checker->declCount];
+                ok = name_map_set(&checker->names, tokens[decl->nameIndex].value, decl->previous);
+            }
+            if (checker->scopeCount > 0) {
+                checker->scopeCount--;
+            }
+        } else if ((type_length = declaration_type_length(tokens, token_count, k)) > 0) {
+            k = declare_all(checker, k, type_length, &ok);
+        } else if (token_is_keyword(token, KEYWORD_FOR) && k + 1 < token_count &&
+                   tokens[k + 1].type == TOKEN_LPAREN) {
+            CanonicalLoop loop;
+            int canonical = checker->loopCount < MAX_LOOP_NESTING && canonical_loop(checker, k, &loop);
+            if (!canonical) {
+                loop.var = -1;
+                loop.bodyEnd = statement_end_memo(tokens, token_count, brackets, k, checker->ends);
+            }
+            if (!(ok = grow_array((void **)&checker->loops, &checker->loopCapacity, checker->loopCount, sizeof(CanonicalLoop)))) {
+                break;
+            }
+            checker->loops[checker->loopCount++] = loop;
+            if (!canonical) {
+                continue;
+            }
+
+            int stores, sums;
+            const char *blocker = vectorize_blocker(checker, &loop, brackets[k + 1] + 1, &stores, &sums);
+            if (!blocker) {
+                checker->report->vectorizable++;
+            }
+            if (remarks && blocker) {
+                report_at(checker, k, "remark", "loop over '%s' not vectorizable: %s",
+                          tokens[loop.var].value, blocker);
+            } else if (remarks) {
+                report_at(checker, k, "remark", "loop over '%s' is vectorizable (%d element-wise stores, %d sums)",
+                          tokens[loop.var].value, stores, sums);
+            }
+        } else if (token->type == TOKEN_IDENTIFIER && k + 1 < token_count &&
+                   tokens[k + 1].type == TOKEN_LBRACKET && brackets[k + 1] > k &&
+                   (k == 0 || tokens[k - 1].type != TOKEN_DOT)) {
+            check_access(checker, k);
+        }
+    }
+
+    workspace->decls = checker->decls;
+    workspace->declCapacity = checker->declCapacity;
+    workspace->names = checker->names;
+    workspace->scopes = checker->scopes;
+    workspace->scopeCapacity = checker->scopeCapacity;
+    workspace->loops = checker->loops;
+    workspace->loopCapacity = checker->loopCapacity;
+    if (!ok) {
+        return -1;
+    }
+    return checker->report->errors == 0;
+}
+
+int check_array_bounds(const Token *tokens, int token_count, const int *brackets,
+                       const char *filename, LineIndex *lines, int remarks,
+                       FILE *out, BoundsReport *report) {
+    BoundsReport local_report;
+    BoundsWorkspace workspace;
+    BoundsChecker checker;
+    memset(&workspace, 0, sizeof(workspace));
+    memset(&checker, 0, sizeof(checker));
+    checker.tokens = tokens;
+    checker.tokenCount = token_count;
+    checker.brackets = brackets;
+    checker.filename = filename;
+    checker.lines = lines;
+    checker.remarks = remarks;
+    checker.out = out;
+    checker.report = report ? report : &local_report;
+    int ok = run_check(&checker, &workspace);
+    free_arrays(&workspace);
+    if (ok < 0) {
+        fprintf(out, "Out of memory\n");
+        return 0;
+    }
+    return ok;
+}
+
+int check_array_bounds_into(const Token *tokens, int token_count, const int *brackets,
+                            const char *filename, BoundsWorkspace *workspace,
+                            ParseDiagnostics *diag, BoundsReport *report) {
+    BoundsReport local_report;
+    BoundsChecker checker;
+    memset(&checker, 0, sizeof(checker));
+    checker.tokens = tokens;
+    checker.tokenCount = token_count;
+    checker.brackets = brackets;
+    checker.filename = filename;
+    checker.lines = diag->lines;
+    checker.diag = diag;
+    checker.report = report ? report : &local_report;
+    return run_check(&checker, workspace);
+}
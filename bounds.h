@@ -0,0 +1,48 @@
+#ifndef BOUNDS_H
+#define BOUNDS_H
+
+#include <stdio.h>
+
+#include "lexer.h"
+#include "lineindex.h"
+#include "parser.h"
+
+// What the bounds analysis found in a program
+typedef struct {
+    int errors;         // Constant indices outside their array in code that always runs
+    int errorOffset;    // Source offset of the first of them, -1 if none
+    int warnings;       // Such indices in code that may not run, and loops whose
+                        // induction variable runs past the array
+    int proven;         // Accesses shown to stay inside their array
+    int unproven;       // Accesses that still need a check
+    int vectorizable;   // Canonical loops whose body is element-wise or a sum
+} BoundsReport;
+
+// Check every indexing of an array with a constant size. Constant indices and
+// indices driven by a canonical for(i=A;i<B;i=i+1) loop are checked
+// statically; errors and warnings are always printed to out as
+// "file:line:column: error: ...", and with remarks also the proven accesses
+// and the loops a vectorizing backend could handle. Positions fall back to
+// token indices when lines is NULL. A constant index outside its array is an
+// error when the access runs on every run of the program (straight-line code
+// of main) and a warning elsewhere. Returns 0 if there were errors.
+int check_array_bounds(const Token *tokens, int token_count, const int *brackets,
+                       const char *filename, LineIndex *lines, int remarks,
+                       FILE *out, BoundsReport *report);
+
+// Scratch arrays of the check, for callers that run it again and again
+typedef struct BoundsWorkspace BoundsWorkspace;
+
+BoundsWorkspace *bounds_workspace_new(void);
+void bounds_workspace_free(BoundsWorkspace *workspace);
+
+// The same check for long-lived callers: messages are appended to diag
+// like the parser's (truncated when the buffer is full, positions from
+// diag->lines) and the arrays of workspace are reused, so nothing is
+// allocated once they have grown to the size of the input. Returns 1 if
+// there were no errors, 0 if there were and -1 if out of memory.
+int check_array_bounds_into(const Token *tokens, int token_count, const int *brackets,
+                            const char *filename, BoundsWorkspace *workspace,
+                            ParseDiagnostics *diag, BoundsReport *report);
+
+#endif
@@ -0,0 +1,248 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+#include "cache.h"
+
+#define CACHE_TMP_MAX_AGE 600   // Seconds after which a temporary file is a crashed writer's
+
+// On-disk header of a cache entry, followed by tokenCount raw Token structs
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t tokenSize;
+    uint32_t parseOk;
+    uint64_t key;
+    uint64_t sourceLength;  // Checked on lookup along with the key
+    uint64_t tokenCount;
+} CacheHeader;
+
+typedef struct {
+    char path[1024];
+    long long size;
+    struct timespec mtime;
+} CacheFile;
+
+static atomic_uint tmp_counter;
+
+static uint64_t mix64(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+uint64_t hash_bytes(const void *data, size_t length, uint64_t seed) {
+    const unsigned char *p = (const unsigned char *)data;
+    uint64_t h = seed ^ (length * 0x9e3779b97f4a7c15ULL);
+    uint64_t word;
+
+    // Main loop: one 8-byte word per step
+    while (length >= 8) {
+        memcpy(&word, p, 8);
+        h ^= mix64(word);
+        h = (h << 27 | h >> 37) * 0x9e3779b97f4a7c15ULL;
+        p += 8;
+        length -= 8;
+    }
+
+    // Remaining 0..7 bytes
+    word = 0;
+    memcpy(&word, p, length);
+    h ^= mix64(word ^ length);
+    return mix64(h);
+}
+
+uint64_t cache_key(const char *source, size_t length) {
+    uint64_t seed = hash_bytes(COMPILER_VERSION, strlen(COMPILER_VERSION), CACHE_FORMAT_VERSION);
+    return hash_bytes(source, length, seed);
+}
+
+static void entry_path(char *path, size_t size, const char *dir, uint64_t key) {
+    snprintf(path, size, "%s/%016llx.acc", dir, (unsigned long long)key);
+}
+
+int cache_lookup(const char *dir, uint64_t key, size_t source_length, CacheEntry *entry) {
+    char path[1024];
+    entry_path(path, sizeof(path), dir, key);
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(CacheHeader)) {
+        close(fd);
+        return 0;
+    }
+
+    // Private and writable: a caller that patches a token gets its own copy
+    // of that page, the file is never changed
+    void *map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping stays valid after close
+    if (map == MAP_FAILED) {
+        return 0;
+    }
+
+    // Validate the header before trusting the token array
+    const CacheHeader *header = (const CacheHeader *)map;
+    if (memcmp(header->magic, "ACCH", 4) != 0 ||
+        header->version != CACHE_FORMAT_VERSION ||
+        header->tokenSize != sizeof(Token) ||
+        header->key != key ||
+        header->sourceLength != source_length ||
+        sizeof(CacheHeader) + header->tokenCount * sizeof(Token) != (size_t)st.st_size) {
+        munmap(map, st.st_size);
+        return 0;
+    }
+
+    entry->map = map;
+    entry->mapSize = st.st_size;
+    entry->tokens = (Token *)((char *)map + sizeof(CacheHeader));
+    entry->tokenCount = (int)header->tokenCount;
+    entry->parseOk = (int)header->parseOk;
+
+    // Bump the modification time so eviction sees this entry as recently used
+    utimes(path, NULL);
+    return 1;
+}
+
+void cache_release(CacheEntry *entry) {
+    if (entry->map) {
+        munmap(entry->map, entry->mapSize);
+    }
+    entry->map = NULL;
+    entry->tokens = NULL;
+}
+
+static int compare_mtime(const void *a, const void *b) {
+    const CacheFile *fa = (const CacheFile *)a;
+    const CacheFile *fb = (const CacheFile *)b;
+    if (fa->mtime.tv_sec != fb->mtime.tv_sec) {
+        return (fa->mtime.tv_sec > fb->mtime.tv_sec) - (fa->mtime.tv_sec < fb->mtime.tv_sec);
+    }
+    return (fa->mtime.tv_nsec > fb->mtime.tv_nsec) - (fa->mtime.tv_nsec < fb->mtime.tv_nsec);
+}
+
+// Remove the oldest entries until the cache directory fits in max_bytes.
+// The entry that was just written (keep) is never evicted. Temporary files
+// older than CACHE_TMP_MAX_AGE belong to writers that died before renaming
+// them and are removed too; younger ones may still be being written.
+static void cache_evict(const char *dir, const char *keep, long long max_bytes) {
+    DIR *d = opendir(dir);
+    if (!d) {
+        return;
+    }
+
+    int capacity = 16, count = 0;
+    long long total = 0;
+    CacheFile *files = (CacheFile *)malloc(capacity * sizeof(CacheFile));
+    time_t now = time(NULL);
+    struct dirent *de;
+    while (files && (de = readdir(d)) != NULL) {
+        size_t len = strlen(de->d_name);
+        if (len >= 4 && strcmp(de->d_name + len - 4, ".tmp") == 0) {
+            char path[1024];
+            struct stat st;
+            snprintf(path, sizeof(path), "%s/%s", dir, de->d_name);
+            if (lstat(path, &st) == 0 && S_ISREG(st.st_mode) && now - st.st_mtime > CACHE_TMP_MAX_AGE) {
+                unlink(path);
+            }
+            continue;
+        }
+        if (len < 4 || strcmp(de->d_name + len - 4, ".acc") != 0) {
+            continue;
+        }
+        if (count >= capacity) {
+            capacity *= 2;
+            CacheFile *new_files = (CacheFile *)realloc(files, capacity * sizeof(CacheFile));
+            if (!new_files) {
+                break;
+            }
+            files = new_files;
+        }
+        CacheFile *f = &files[count];
+        snprintf(f->path, sizeof(f->path), "%s/%s", dir, de->d_name);
+        struct stat st;
+        if (stat(f->path, &st) != 0) {
+            continue;   // Removed by a concurrent build
+        }
+        f->size = st.st_size;
+        f->mtime = st.st_mtim;
+        total += f->size;
+        count++;
+    }
+    closedir(d);
+
+    if (files && total > max_bytes) {
+        qsort(files, count, sizeof(CacheFile), compare_mtime);
+        for (int i = 0; i < count && total > max_bytes; i++) {
+            if (strcmp(files[i].path, keep) == 0) {
+                continue;
+            }
+            // Readers holding a mapping keep their data after the unlink
+            if (unlink(files[i].path) == 0 || errno == ENOENT) {
+                total -= files[i].size;
+            }
+        }
+    }
+    free(files);
+}
+
+int cache_store(const char *dir, uint64_t key, size_t source_length, const Token *tokens,
+                int token_count, int parse_ok, long long max_bytes) {
+    if (mkdir(dir, 0777) != 0 && errno != EEXIST) {
+        return 0;
+    }
+
+    char path[1024], tmp_path[1100];
+    entry_path(path, sizeof(path), dir, key);
+    // Unique temporary name so concurrent builds never write the same file
+    snprintf(tmp_path, sizeof(tmp_path), "%s.%ld.%u.tmp", path, (long)getpid(),
+             atomic_fetch_add(&tmp_counter, 1));
+
+    FILE *file = fopen(tmp_path, "wb");
+    if (!file) {
+        return 0;
+    }
+
+    CacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "ACCH", 4);
+    header.version = CACHE_FORMAT_VERSION;
+    header.tokenSize = sizeof(Token);
+    header.parseOk = parse_ok ? 1 : 0;
+    header.key = key;
+    header.sourceLength = source_length;
+    header.tokenCount = token_count;
+
+    int ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+             (token_count == 0 ||
+              fwrite(tokens, sizeof(Token), token_count, file) == (size_t)token_count) &&
+             fflush(file) == 0 &&
+             fsync(fileno(file)) == 0;
+    if (fclose(file) != 0) {
+        ok = 0;
+    }
+
+    // rename() is atomic: readers see either the old entry or the complete new one
+    if (!ok || rename(tmp_path, path) != 0) {
+        unlink(tmp_path);
+        return 0;
+    }
+
+    cache_evict(dir, path, max_bytes);
+    return 1;
+}
@@ -0,0 +1,42 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lexer.h"
+
+#define COMPILER_VERSION "atomc-0.1"
+#define CACHE_FORMAT_VERSION 6
+#define CACHE_DEFAULT_MAX_BYTES (256LL * 1024 * 1024)
+
+// A cache entry mapped back from disk. The tokens point straight into the
+// mapping, so nothing is deserialized on a hit.
+typedef struct {
+    void *map;
+    size_t mapSize;
+    Token *tokens;
+    int tokenCount;
+    int parseOk;
+} CacheEntry;
+
+// 64-bit hash of a byte buffer (8 bytes per step, used as the cache key)
+uint64_t hash_bytes(const void *data, size_t length, uint64_t seed);
+
+// Cache key of a source file: hash of its bytes plus the compiler version
+uint64_t cache_key(const char *source, size_t length);
+
+// Returns 1 and fills entry on a hit, 0 on a miss. An entry is only a hit if
+// it was stored for a source of the same length, so a hash collision
+// between sources of different lengths is never taken for a hit.
+int cache_lookup(const char *dir, uint64_t key, size_t source_length, CacheEntry *entry);
+void cache_release(CacheEntry *entry);
+
+// Atomically stores a token stream and its parse result, then evicts the
+// least recently used entries until the directory fits in max_bytes, and
+// temporary files that crashed writers left behind.
+// Returns 1 on success, 0 on failure (the build goes on without the cache).
+int cache_store(const char *dir, uint64_t key, size_t source_length, const Token *tokens,
+                int token_count, int parse_ok, long long max_bytes);
+
+#endif
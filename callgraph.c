@@ -0,0 +1,427 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "callgraph.h"
+#include "cache.h"
+
+// Inlining budget in body tokens. Calls inside loops and functions with a
+// single call site get a larger one, since the call overhead dominates there.
+#define INLINE_THRESHOLD 40
+#define INLINE_LOOP_THRESHOLD 120
+#define INLINE_SINGLE_CALLER_THRESHOLD 250
+
+// Probe the open addressing table from function name to node index
+static int name_slot(const CallGraph *graph, const Token *tokens, const char *name, size_t *slot_out) {
+    size_t mask = graph->nameSlotCount - 1;
+    size_t slot = hash_bytes(name, strlen(name), 0) & mask;
+    while (graph->nameSlots[slot] >= 0 &&
+           strcmp(tokens[graph->nodes[graph->nameSlots[slot]].nameIndex].value, name) != 0) {
+        slot = (slot + 1) & mask;
+    }
+    if (slot_out) {
+        *slot_out = slot;
+    }
+    return graph->nameSlots[slot];
+}
+
+int call_graph_find(const CallGraph *graph, const Token *tokens, const char *name) {
+    return graph->nameSlots ? name_slot(graph, tokens, name, NULL) : -1;
+}
+
+static int add_call(CallGraph *graph, int *capacity, const CallSite *call) {
+    if (graph->callCount >= *capacity) {
+        int new_capacity = *capacity ? *capacity * 2 : 64;
+        CallSite *calls = (CallSite *)realloc(graph->calls, new_capacity * sizeof(CallSite));
+        if (!calls) {
+            return 0;
+        }
+        graph->calls = calls;
+        *capacity = new_capacity;
+    }
+    graph->calls[graph->callCount++] = *call;
+    return 1;
+}
+
+// Mark the functions on cycles with Tarjan's algorithm, using an explicit
+// stack so long call chains cannot overflow the C stack
+static int mark_recursion(CallGraph *graph) {
+    int n = graph->count;
+    int *index = (int *)malloc(n * sizeof(int));
+    int *low = (int *)malloc(n * sizeof(int));
+    int *next_edge = (int *)malloc(n * sizeof(int));
+    int *stack = (int *)malloc(n * sizeof(int));
+    int *path = (int *)malloc(n * sizeof(int));
+    char *on_stack = (char *)calloc(n, 1);
+    int ok = index && low && next_edge && stack && path && on_stack;
+    int counter = 0, top = 0;
+
+    for (int i = 0; ok && i < n; i++) {
+        index[i] = -1;
+    }
+    for (int root = 0; ok && root < n; root++) {
+        if (index[root] >= 0) {
+            continue;
+        }
+        int depth = 0;
+        path[depth++] = root;
+        index[root] = low[root] = counter++;
+        next_edge[root] = 0;
+        stack[top++] = root;
+        on_stack[root] = 1;
+
+        while (depth > 0) {
+            int v = path[depth - 1];
+            CallNode *node = &graph->nodes[v];
+            if (next_edge[v] < node->callCount) {
+                int w = graph->calls[node->firstCall + next_edge[v]++].callee;
+                if (w < 0) {
+                    continue;
+                }
+                if (w == v) {
+                    node->recursive = true;
+                } else if (index[w] < 0) {
+                    index[w] = low[w] = counter++;
+                    next_edge[w] = 0;
+                    stack[top++] = w;
+                    on_stack[w] = 1;
+                    path[depth++] = w;
+                } else if (on_stack[w] && index[w] < low[v]) {
+                    low[v] = index[w];
+                }
+                continue;
+            }
+
+            // All edges of v done
+            depth--;
+            if (depth > 0 && low[v] < low[path[depth - 1]]) {
+                low[path[depth - 1]] = low[v];
+            }
+            if (low[v] == index[v]) {
+                // v is the root of a component; more than one member means a cycle
+                int size = 0;
+                int start = top;
+                do {
+                    start--;
+                    size++;
+                } while (stack[start] != v);
+                for (int k = start; k < top; k++) {
+                    on_stack[stack[k]] = 0;
+                    if (size > 1) {
+                        graph->nodes[stack[k]].recursive = true;
+                    }
+                }
+                top = start;
+            }
+        }
+    }
+
+    free(index);
+    free(low);
+    free(next_edge);
+    free(stack);
+    free(path);
+    free(on_stack);
+    return ok;
+}
+
+int build_call_graph(const Token *tokens, int token_count, const int *brackets,
+                     const Outline *outline, CallGraph *graph) {
+    memset(graph, 0, sizeof(*graph));
+    graph->brackets = brackets;
+    graph->nodes = (CallNode *)calloc(outline->count + 1, sizeof(CallNode));
+    if (!graph->nodes) {
+        return 0;
+    }
+    for (int i = 0; i < outline->count; i++) {
+        const OutlineItem *item = &outline->items[i];
+        if (item->kind != OUTLINE_FUNCTION || item->bodyEnd < 0) {
+            continue;
+        }
+        CallNode *node = &graph->nodes[graph->count++];
+        node->nameIndex = item->nameIndex;
+        node->paramsStart = item->nameIndex + 1;
+        node->paramsEnd = brackets[item->nameIndex + 1];
+        node->bodyStart = item->bodyStart;
+        node->bodyEnd = item->bodyEnd;
+    }
+
+    graph->nameSlotCount = 64;
+    while (graph->nameSlotCount < (size_t)graph->count * 2) {
+        graph->nameSlotCount *= 2;
+    }
+    graph->nameSlots = (int *)malloc(graph->nameSlotCount * sizeof(int));
+    int *loops = NULL;
+    int loop_capacity = 0;
+    int call_capacity = 0;
+    int *ends = (int *)malloc((token_count > 0 ? token_count : 1) * sizeof(int));
+    int ok = graph->nameSlots != NULL && ends != NULL;
+    if (ok) {
+        memset(ends, -1, token_count * sizeof(int));
+        memset(graph->nameSlots, -1, graph->nameSlotCount * sizeof(int));
+        for (int i = 0; i < graph->count; i++) {
+            size_t slot;
+            if (name_slot(graph, tokens, tokens[graph->nodes[i].nameIndex].value, &slot) < 0) {
+                graph->nameSlots[slot] = i;
+            }
+        }
+    }
+
+    for (int f = 0; ok && f < graph->count; f++) {
+        CallNode *node = &graph->nodes[f];
+        node->firstCall = graph->callCount;
+        int loop_depth = 0;     // Ends of the loops around the current token
+
+        for (int k = node->bodyStart + 1; ok && k < node->bodyEnd; k++) {
+            while (loop_depth > 0 && loops[loop_depth - 1] < k) {
+                loop_depth--;
+            }
+            const Token *token = &tokens[k];
+            if ((token_is_keyword(token, KEYWORD_FOR) || token_is_keyword(token, KEYWORD_WHILE)) &&
+                tokens[k + 1].type == TOKEN_LPAREN) {
+                if (loop_depth >= loop_capacity) {
+                    int capacity = loop_capacity ? loop_capacity * 2 : 16;
+                    int *grown = (int *)realloc(loops, capacity * sizeof(int));
+                    if (!grown) {
+                        ok = 0;
+                        break;
+                    }
+                    loops = grown;
+                    loop_capacity = capacity;
+                }
+                loops[loop_depth++] = statement_end_memo(tokens, token_count, brackets, k, ends);
+            } else if (token->type == TOKEN_IDENTIFIER && tokens[k + 1].type == TOKEN_LPAREN) {
+                CallSite call;
+                call.caller = f;
+                call.callee = name_slot(graph, tokens, token->value, NULL);
+                call.nameIndex = k;
+                call.argsStart = k + 1;
+                call.argsEnd = brackets[k + 1];
+                call.loopDepth = loop_depth;
+                ok = add_call(graph, &call_capacity, &call);
+                if (ok && call.callee >= 0) {
+                    graph->nodes[call.callee].callers++;
+                }
+            }
+        }
+        node->callCount = graph->callCount - node->firstCall;
+    }
+
+    ok = ok && mark_recursion(graph);
+    free(loops);
+    free(ends);
+    if (!ok) {
+        free_call_graph(graph);
+    }
+    return ok;
+}
+
+void free_call_graph(CallGraph *graph) {
+    free(graph->nodes);
+    free(graph->calls);
+    free(graph->nameSlots);
+    memset(graph, 0, sizeof(*graph));
+}
+
+// Token range [start, end) of argument n of a call; returns 0 if there is none
+static int nth_argument(const Token *tokens, const int *brackets, const CallSite *call,
+                        int n, int *start, int *end) {
+    int k = call->argsStart + 1;
+    if (k == call->argsEnd) {
+        return 0;
+    }
+    for (int arg = 0; ; arg++) {
+        int first = k;
+        while (k < call->argsEnd && tokens[k].type != TOKEN_COMMA) {
+            if (brackets[k] > k) {
+                k = brackets[k];
+            }
+            k++;
+        }
+        if (arg == n) {
+            *start = first;
+            *end = k;
+            return 1;
+        }
+        if (k >= call->argsEnd) {
+            return 0;
+        }
+        k++;    // Skip ','
+    }
+}
+
+// A literal, optionally negated
+static int is_constant_argument(const Token *tokens, int start, int end) {
+    if (end - start == 2 && tokens[start].type == TOKEN_MINUS) {
+        start++;
+    }
+    if (end - start != 1) {
+        return 0;
+    }
+    TokenType type = tokens[start].type;
+    return type == TOKEN_NUMBER_ZEC || type == TOKEN_NUMBER_HEX || type == TOKEN_NUMBER_OCT ||
+           type == TOKEN_REAL || type == TOKEN_CHAR_LITERAL || type == TOKEN_STRING;
+}
+
+// Interned strings are the same exactly when their pool indices are
+static int same_tokens(const Token *tokens, const StringPool *strings,
+                       int start1, int end1, int start2, int end2) {
+    if (end1 - start1 != end2 - start2) {
+        return 0;
+    }
+    for (int i = 0; i < end1 - start1; i++) {
+        const Token *a = &tokens[start1 + i], *b = &tokens[start2 + i];
+        if (a->type != b->type) {
+            return 0;
+        }
+        if (a->type == TOKEN_STRING && strings && a->literal.string >= 0 && b->literal.string >= 0) {
+            if (a->literal.string != b->literal.string) {
+                return 0;
+            }
+        } else if (strcmp(a->value, b->value) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Print an argument as written, except that a string is printed from its
+// decoded bytes between quotes, so f("1") and f(1) read differently
+static void print_argument(FILE *out, const Token *tokens, const StringPool *strings, int start, int end) {
+    for (int i = start; i < end; i++) {
+        const Token *token = &tokens[i];
+        if (token->type != TOKEN_STRING) {
+            fputs(token->value, out);
+            continue;
+        }
+        char decoded[sizeof(token->value)];
+        const char *bytes = decoded;
+        size_t length = 0;
+        if (strings && token->literal.string >= 0) {
+            bytes = string_pool_get(strings, token->literal.string, &length);
+        } else {
+            // The token keeps escapes as written
+            for (const char *p = token->value; *p; ) {
+                if (*p == '\\' && p[1]) {
+                    p++;
+                    decoded[length++] = (char)decode_escape(&p);
+                } else {
+                    decoded[length++] = *p++;
+                }
+            }
+        }
+        putc('"', out);
+        print_escaped(out, bytes, length);
+        putc('"', out);
+    }
+}
+
+static void print_remark_prefix(FILE *out, const char *filename, LineIndex *lines,
+                                const Token *tokens, int index) {
+    print_location(out, filename, lines, tokens[index].offset, index);
+    fprintf(out, ": remark: ");
+}
+
+void print_inline_remarks(const CallGraph *graph, const Token *tokens, const StringPool *strings,
+                          const char *filename, LineIndex *lines, FILE *out) {
+    // Inlining decision for every call site
+    for (int c = 0; c < graph->callCount; c++) {
+        const CallSite *call = &graph->calls[c];
+        const char *callee_name = tokens[call->nameIndex].value;
+        const char *caller_name = tokens[graph->nodes[call->caller].nameIndex].value;
+        print_remark_prefix(out, filename, lines, tokens, call->nameIndex);
+        if (call->callee < 0) {
+            fprintf(out, "'%s' not inlined into '%s': no definition\n", callee_name, caller_name);
+            continue;
+        }
+        const CallNode *callee = &graph->nodes[call->callee];
+        if (callee->recursive) {
+            fprintf(out, "'%s' not inlined into '%s': recursive\n", callee_name, caller_name);
+            continue;
+        }
+        int cost = callee->bodyEnd - callee->bodyStart - 1;
+        int threshold = INLINE_THRESHOLD;
+        const char *reason = "";
+        if (callee->callers == 1) {
+            threshold = INLINE_SINGLE_CALLER_THRESHOLD;
+            reason = ", single call site";
+        } else if (call->loopDepth > 0) {
+            threshold = INLINE_LOOP_THRESHOLD;
+            reason = ", called in a loop";
+        }
+        if (cost <= threshold) {
+            fprintf(out, "'%s' can be inlined into '%s' (cost %d, threshold %d%s)\n",
+                    callee_name, caller_name, cost, threshold, reason);
+        } else {
+            fprintf(out, "'%s' not inlined into '%s': cost %d exceeds threshold %d%s\n",
+                    callee_name, caller_name, cost, threshold, reason);
+        }
+    }
+
+    // Parameters that receive the same constant at every call site. Call
+    // sites are bucketed by callee first, so that every function only scans
+    // its own calls: sites[first[f]..first[f + 1]) call node f.
+    int *first = (int *)malloc((graph->count + 1) * sizeof(int));
+    int *sites = (int *)malloc((graph->callCount > 0 ? graph->callCount : 1) * sizeof(int));
+    if (!first || !sites) {
+        free(first);
+        free(sites);
+        return;
+    }
+    first[0] = 0;
+    for (int f = 0; f < graph->count; f++) {
+        first[f + 1] = first[f] + graph->nodes[f].callers;
+    }
+    for (int c = 0; c < graph->callCount; c++) {
+        int callee = graph->calls[c].callee;
+        if (callee >= 0) {
+            sites[first[callee]++] = c;
+        }
+    }
+    for (int f = graph->count; f > 0; f--) {
+        first[f] = first[f - 1];
+    }
+    first[0] = 0;
+
+    for (int f = 0; f < graph->count; f++) {
+        const CallNode *node = &graph->nodes[f];
+        if (node->callers == 0) {
+            if (strcmp(tokens[node->nameIndex].value, "main") != 0) {
+                print_remark_prefix(out, filename, lines, tokens, node->nameIndex);
+                fprintf(out, "'%s' is never called\n", tokens[node->nameIndex].value);
+            }
+            continue;
+        }
+        int param = 0;
+        for (int k = node->paramsStart + 1; k < node->paramsEnd; k++) {
+            TokenType next = tokens[k + 1].type;
+            if (tokens[k].type != TOKEN_IDENTIFIER ||
+                (next != TOKEN_COMMA && next != TOKEN_RPAREN && next != TOKEN_LBRACKET)) {
+                continue;
+            }
+            // Compare argument `param` of every call of this function
+            int first_start = -1, first_end = -1, constant = 1;
+            for (int s = first[f]; constant && s < first[f + 1]; s++) {
+                const CallSite *call = &graph->calls[sites[s]];
+                int start, end;
+                if (!nth_argument(tokens, graph->brackets, call, param, &start, &end) ||
+                    !is_constant_argument(tokens, start, end)) {
+                    constant = 0;
+                } else if (first_start < 0) {
+                    first_start = start;
+                    first_end = end;
+                } else if (!same_tokens(tokens, strings, first_start, first_end, start, end)) {
+                    constant = 0;
+                }
+            }
+            if (constant && first_start >= 0) {
+                print_remark_prefix(out, filename, lines, tokens, k);
+                fprintf(out, "parameter '%s' of '%s' is ", tokens[k].value, tokens[node->nameIndex].value);
+                print_argument(out, tokens, strings, first_start, first_end);
+                fprintf(out, " at every call site\n");
+            }
+            param++;
+        }
+    }
+    free(first);
+    free(sites);
+}
@@ -0,0 +1,62 @@
+#ifndef CALLGRAPH_H
+#define CALLGRAPH_H
+
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "lexer.h"
+#include "parser.h"
+#include "lineindex.h"
+#include "strpool.h"
+
+// One call of a function by name, found in a function body
+typedef struct {
+    int caller;         // Index of the calling function in CallGraph.nodes
+    int callee;         // Index of the called function, -1 if it is not defined here
+    int nameIndex;      // Token of the callee name
+    int argsStart;      // Token of '('
+    int argsEnd;        // Token of the matching ')'
+    int loopDepth;      // Number of for/while loops around the call
+} CallSite;
+
+typedef struct {
+    int nameIndex;      // Token of the function name
+    int paramsStart;    // Token of '(' of the parameter list
+    int paramsEnd;      // Token of ')'
+    int bodyStart;      // Token of '{'
+    int bodyEnd;        // Token of '}'
+    int firstCall;      // Calls made by this function are calls[firstCall..firstCall+callCount)
+    int callCount;
+    int callers;        // Call sites that call this function
+    bool recursive;     // On a cycle of the call graph
+} CallNode;
+
+typedef struct {
+    CallNode* nodes;
+    int count;
+    CallSite* calls;
+    int callCount;
+    const int* brackets;    // Bracket index the graph was built with
+    int* nameSlots;         // Open addressing table from function name to node, -1 if empty
+    size_t nameSlotCount;
+} CallGraph;
+
+// Build the call graph of the functions in outline (from parseOutline with
+// the same bracket index). brackets must outlive the graph. Returns 1 on
+// success, 0 if out of memory.
+int build_call_graph(const Token *tokens, int token_count, const int *brackets,
+                     const Outline *outline, CallGraph *graph);
+void free_call_graph(CallGraph *graph);
+
+// Index of the node of the function with this name, or -1 if it is not defined
+int call_graph_find(const CallGraph *graph, const Token *tokens, const char *name);
+
+// Print inlining decisions and constant arguments as remarks, one per line:
+// "file:line:column: remark: ...". Positions fall back to token indices
+// when lines is NULL. String arguments are compared and printed (quoted and
+// escaped) from their decoded bytes in strings, or from the token text when
+// strings is NULL.
+void print_inline_remarks(const CallGraph *graph, const Token *tokens, const StringPool *strings,
+                          const char *filename, LineIndex *lines, FILE *out);
+
+#endif
@@ -1,35 +1,443 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "lexer.h"
 #include "parser.h"
+#include "cache.h"
+#include "tokfile.h"
+#include "server.h"
+#include "parallel.h"
+#include "pipeline.h"
+#include "strpool.h"
+#include "callgraph.h"
+#include "bounds.h"
+#include "constfold.h"
+#include "layout.h"
+#include "watch.h"
+#include "xref.h"
+#include "lsp.h"
+#include "hugemem.h"
+#include "util.h"
+
+// List the top-level items of a program, skipping function bodies
+static int print_outline(Token *tokens, int token_count, ParseDiagnostics *diag) {
+    static const char *kinds[] = {"function", "variable", "struct"};
+    int *brackets = (int *)malloc((token_count + 1) * sizeof(int));
+    if (!brackets) {
+        printf("Out of memory\n");
+        return 0;
+    }
+    build_bracket_index(tokens, token_count, brackets);
+
+    Outline outline = {NULL, 0, 0};
+    int ok = parseOutline(tokens, token_count, brackets, &outline, diag);
+    for (int i = 0; i < outline.count; i++) {
+        const OutlineItem *item = &outline.items[i];
+        printf("%-8s %s", kinds[item->kind], tokens[item->nameIndex].value);
+        if (item->kind == OUTLINE_FUNCTION) {
+            printf("  (body: tokens %d-%d)", item->bodyStart, item->bodyEnd);
+        }
+        printf("\n");
+    }
+
+    free(outline.items);
+    free(brackets);
+    return ok;
+}
+
+// Check array indices against the declared sizes
+static int check_bounds(Token *tokens, int token_count, const char *filename, LineIndex *lines,
+                        int remarks) {
+    int *brackets = (int *)malloc((token_count + 1) * sizeof(int));
+    if (!brackets) {
+        printf("Out of memory\n");
+        return 0;
+    }
+    build_bracket_index(tokens, token_count, brackets);
+    int ok = check_array_bounds(tokens, token_count, brackets, filename, lines, remarks, stdout, NULL);
+    free(brackets);
+    return ok;
+}
+
+// Print sizes and offsets of structs and arrays of structs
+static int print_data_layout(Token *tokens, int token_count, int soa) {
+    int *brackets = (int *)malloc((token_count + 1) * sizeof(int));
+    if (!brackets) {
+        printf("Out of memory\n");
+        return 0;
+    }
+    build_bracket_index(tokens, token_count, brackets);
+
+    Layout layout;
+    int ok = compute_layout(tokens, token_count, brackets, soa, &layout);
+    if (ok) {
+        print_layout(&layout, tokens, stdout);
+        free_layout(&layout);
+    } else {
+        printf("Out of memory\n");
+    }
+    free(brackets);
+    return ok;
+}
+
+// Report which calls could be inlined, which parameters are constant and
+// which expressions fold to constants
+static int print_remarks(Token *tokens, int token_count, const StringPool *strings,
+                         const char *filename, LineIndex *lines) {
+    int *brackets = (int *)malloc((token_count + 1) * sizeof(int));
+    if (!brackets) {
+        printf("Out of memory\n");
+        return 0;
+    }
+    build_bracket_index(tokens, token_count, brackets);
+
+    Outline outline = {NULL, 0, 0};
+    CallGraph graph;
+    int ok = parseOutline(tokens, token_count, brackets, &outline, NULL) &&
+             build_call_graph(tokens, token_count, brackets, &outline, &graph);
+    if (ok) {
+        ConstEvaluator constants;
+        const_evaluator_init(&constants, tokens, token_count, brackets, &graph);
+        print_inline_remarks(&graph, tokens, strings, filename, lines, stdout);
+        print_fold_remarks(&constants, filename, lines, stdout);
+        free_call_graph(&graph);
+    }
+
+    free(outline.items);
+    free(brackets);
+    return ok;
+}
 
 int main(int argc, char *argv[]) {
-    if (argc != 2) {
-        printf("Usage: %s <filename>\n", argv[0]);
+    const char *filename = NULL;
+    const char *server_socket = NULL;
+    int jobs = 0;
+    const char *emit_tokens = NULL;
+    const char *from_tokens = NULL;
+    int dump_tokens = 0;
+    int dump_strings = 0;
+    int outline_only = 0;
+    int pipelined = 0;
+    int show_stats = 0;
+    int remarks = 0;
+    int bounds_check = 1;
+    int dump_layout = 0;
+    int soa = 0;
+    int watch = 0;
+    ParseDiagnostics diag = {NULL, 0, 0, 0, NULL, 0, 0};
+    const char *cache_dir = getenv("ATOMC_CACHE_DIR");
+    long long cache_max = CACHE_DEFAULT_MAX_BYTES;
+    HugePageMode huge_pages = HUGE_PAGES_OFF;
+
+    if (getenv("ATOMC_CACHE_MAX")) {
+        cache_max = atoll(getenv("ATOMC_CACHE_MAX"));
+    }
+    // Through the environment the setting reaches the server, index and LSP modes too
+    if (getenv("ATOMC_HUGE_PAGES") && !huge_parse_mode(getenv("ATOMC_HUGE_PAGES"), &huge_pages)) {
+        fprintf(stderr, "Unknown ATOMC_HUGE_PAGES mode %s, using off\n", getenv("ATOMC_HUGE_PAGES"));
+    }
+    huge_set_mode(huge_pages);
+
+    if (argc == 2 && strcmp(argv[1], "--lsp") == 0) {
+        return run_lsp();
+    }
+
+    // Client modes take a list of files
+    if (argc >= 3 && strncmp(argv[1], "--client=", 9) == 0) {
+        return run_client(argv[1] + 9, argc - 2, argv + 2);
+    }
+    if (argc >= 3 && strncmp(argv[1], "--bench-server=", 15) == 0) {
+        return run_server_benchmark(argv[1] + 15, argv[0], argc - 2, argv + 2);
+    }
+    if (argc >= 3 && strncmp(argv[1], "--index=", 8) == 0) {
+        int first = 2;
+        if (strncmp(argv[2], "--jobs=", 7) == 0) {
+            jobs = atoi(argv[2] + 7);
+            first = 3;
+        }
+        return run_indexer(argv[1] + 8, jobs, argc - first, argv + first);
+    }
+    if (argc >= 3 && strncmp(argv[1], "--query=", 8) == 0) {
+        return run_query(argv[1] + 8, argc - 2, argv + 2);
+    }
+
+    // Parse command line options
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--cache-dir=", 12) == 0) {
+            cache_dir = argv[i] + 12;
+        } else if (strncmp(argv[i], "--cache-max=", 12) == 0) {
+            cache_max = atoll(argv[i] + 12);
+        } else if (strncmp(argv[i], "--emit-tokens=", 14) == 0) {
+            emit_tokens = argv[i] + 14;
+        } else if (strncmp(argv[i], "--from-tokens=", 14) == 0) {
+            from_tokens = argv[i] + 14;
+        } else if (strcmp(argv[i], "--dump-tokens") == 0) {
+            dump_tokens = 1;
+        } else if (strcmp(argv[i], "--dump-strings") == 0) {
+            dump_strings = 1;
+        } else if (strncmp(argv[i], "--server=", 9) == 0) {
+            server_socket = argv[i] + 9;
+        } else if (strncmp(argv[i], "--jobs=", 7) == 0) {
+            jobs = atoi(argv[i] + 7);
+        } else if (strcmp(argv[i], "--outline") == 0) {
+            outline_only = 1;
+        } else if (strcmp(argv[i], "--pipeline") == 0) {
+            pipelined = 1;
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            show_stats = 1;
+        } else if (strcmp(argv[i], "--remarks") == 0) {
+            remarks = 1;
+        } else if (strcmp(argv[i], "--no-bounds-check") == 0) {
+            bounds_check = 0;
+        } else if (strcmp(argv[i], "--dump-layout") == 0) {
+            dump_layout = 1;
+        } else if (strcmp(argv[i], "--soa") == 0) {
+            soa = 1;
+        } else if (strncmp(argv[i], "--huge-pages=", 13) == 0 && huge_parse_mode(argv[i] + 13, &huge_pages)) {
+            huge_set_mode(huge_pages);
+        } else if (strcmp(argv[i], "--watch") == 0) {
+            watch = 1;
+        } else if (strcmp(argv[i], "--trace") == 0) {
+            diag.trace = 1;
+        } else if (argv[i][0] != '-' && !filename) {
+            filename = argv[i];
+        } else {
+            filename = NULL;
+            break;
+        }
+    }
+
+    if (server_socket) {
+        return run_server(server_socket, jobs);
+    }
+    if (watch && filename) {
+        return run_watch(filename, diag.trace, bounds_check);
+    }
+
+    if (!filename == !from_tokens) {
+        printf("Usage: %s [options] <filename>\n"
+               "       %s [options] --from-tokens=IN.tok\n"
+               "       %s --watch [--trace] <directory or filename>\n"
+               "       %s --lsp                 language server on stdin and stdout\n"
+               "       %s --server=SOCKET [--jobs=N]\n"
+               "       %s --client=SOCKET <filename>...\n"
+               "       %s --bench-server=SOCKET <filename>...\n"
+               "       %s --index=OUT.idx [--jobs=N] <filename>...\n"
+               "       %s --query=IN.idx <name>...\n"
+               "Options:\n"
+               "  --emit-tokens=OUT.tok  write the binary token stream and stop\n"
+               "  --dump-tokens          print every token\n"
+               "  --dump-strings         print the pool of decoded string literals\n"
+               "  --trace                print the parser's debug trace\n"
+               "  --jobs=N               parse function bodies on N threads\n"
+               "                         (with --server: number of worker threads)\n"
+               "  --outline              list top-level functions, variables and structs\n"
+               "                         without parsing function bodies\n"
+               "  --pipeline             lex on a separate thread while parsing\n"
+               "  --stats                print phase timings and dTLB misses to stderr\n"
+               "  --huge-pages=MODE      back token arrays with 2 MB pages: off, thp\n"
+               "                         (madvise) or hugetlb (reserved pool)\n"
+               "  --remarks              report inlining candidates, constant parameters,\n"
+               "                         proven array accesses, vectorizable loops and\n"
+               "                         expressions that fold to constants\n"
+               "  --no-bounds-check      do not check array indices against array sizes\n"
+               "  --dump-layout          print sizes and member offsets of structs\n"
+               "  --soa                  store arrays of structs whose members are used\n"
+               "                         separately in loops as structure of arrays\n"
+               "  --cache-dir=DIR        cache token streams and parse results in DIR\n"
+               "  --cache-max=BYTES      size limit of the cache directory\n",
+               argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0]);
         return -1;
     }
 
+    uint64_t key = 0;
+    size_t source_length = 0;
+    CacheEntry entry = {0};
     int token_count = 0;
-    Token *tokens = tokenize_file(argv[1], &token_count);
+    Token *tokens = NULL;
+    int parsed = 0, parse_ok = 0;
+    PipelineStats pipe_stats;
+    StringPool strings;
+    int interned = 1;
+    char *source = NULL;
+    LineIndex lines;
+    double lex_ms = 0, parse_ms = 0;
+    int tlb_counter = show_stats ? dtlb_counter_start() : -1;
+
+    if (from_tokens) {
+        // Lexing already happened elsewhere
+        tokens = read_token_file(from_tokens, &token_count);
+        cache_dir = NULL;
+        string_pool_init(&strings);
+        if (tokens) {
+            interned = intern_strings(NULL, tokens, token_count, &strings);
+        }
+    } else {
+        source = read_file(filename);
+
+        // Error messages map token offsets back to lines
+        line_index_init(&lines, source);
+        diag.lines = &lines;
+
+        // A cache hit replaces tokenization with a single mmap
+        if (cache_dir) {
+            source_length = strlen(source);
+            key = cache_key(source, source_length);
+            if (cache_lookup(cache_dir, key, source_length, &entry)) {
+                tokens = entry.tokens;
+                token_count = entry.tokenCount;
+            }
+        }
 
-    if (!tokens) {
+        if (!tokens && pipelined && !emit_tokens && !outline_only && jobs == 0) {
+            // Lexer thread and parser overlap; parsing is done on return
+            tokens = parse_pipelined(source, &token_count, &parse_ok, &diag, &pipe_stats);
+            parsed = 1;
+        } else if (!tokens) {
+            double start = now_ms();
+            tokens = tokenize_source(source, &token_count);
+            lex_ms = now_ms() - start;
+        }
+
+        // Decode string literals once, from the source so long ones are whole
+        string_pool_init(&strings);
+        if (tokens) {
+            interned = intern_strings(source, tokens, token_count, &strings);
+        }
+    }
+
+    if (!tokens || !interned) {
         printf("Tokenization failed!\n");
         return -1;
     }
 
-    printf("Tokens received from lexer:\n");
-    for (int i = 0; i < token_count; i++) {
-        printf("Token %d: Type=%d, Value='%s'\n", i + 1, tokens[i].type, tokens[i].value);
+    if (dump_tokens) {
+        printf("Tokens received from lexer:\n");
+        for (int i = 0; i < token_count; i++) {
+            if (tokens[i].type == TOKEN_REAL) {
+                printf("Token %d: Type=%d, Value='%s' (%.17g)\n", i + 1, tokens[i].type,
+                       tokens[i].value, tokens[i].literal.real);
+            } else if (tokens[i].type == TOKEN_NUMBER_ZEC || tokens[i].type == TOKEN_NUMBER_HEX ||
+                       tokens[i].type == TOKEN_NUMBER_OCT || tokens[i].type == TOKEN_CHAR_LITERAL) {
+                printf("Token %d: Type=%d, Value='%s' (%lld)\n", i + 1, tokens[i].type,
+                       tokens[i].value, (long long)tokens[i].literal.integer);
+            } else if (tokens[i].type == TOKEN_STRING) {
+                printf("Token %d: Type=%d, Value='%s' (string %d)\n", i + 1, tokens[i].type,
+                       tokens[i].value, tokens[i].literal.string);
+            } else {
+                printf("Token %d: Type=%d, Value='%s'\n", i + 1, tokens[i].type, tokens[i].value);
+            }
+        }
+    }
+
+    if (dump_strings) {
+        printf("String pool: %d strings, %zu bytes\n", strings.count, strings.length);
+        for (int i = 0; i < strings.count; i++) {
+            size_t length;
+            const char *bytes = string_pool_get(&strings, i, &length);
+            printf("String %d: \"", i);
+            print_escaped(stdout, bytes, length);
+            printf("\" (%zu bytes)\n", length);
+        }
+    }
+
+    if (emit_tokens) {
+        int written = write_token_file(emit_tokens, tokens, token_count);
+        string_pool_free(&strings);
+        if (source) {
+            line_index_free(&lines);
+            free(source);
+        }
+        if (entry.map) {
+            cache_release(&entry);
+        } else {
+            huge_free(tokens);
+        }
+        if (!written) {
+            printf("Failed to write token file %s\n", emit_tokens);
+            return -1;
+        }
+        return 0;
     }
 
-    // Call the syntactic analyzer
-    if (!parse(tokens, token_count)) {
+    // Call the syntactic analyzer (skipped when the cache already knows it passes)
+    int ok;
+    double parse_start = now_ms();
+    if (parsed) {
+        ok = parse_ok;
+    } else if (outline_only) {
+        ok = print_outline(tokens, token_count, &diag);
+        cache_dir = NULL;
+    } else if (entry.map && entry.parseOk) {
+        ok = 1;
+    } else if (jobs > 0) {
+        ok = parse_parallel(tokens, token_count, jobs, &diag);
+    } else {
+        ok = parseWithDiagnostics(tokens, token_count, &diag);
+    }
+    parse_ms = now_ms() - parse_start;
+
+    if (show_stats && parsed) {
+        double lex_end = pipe_stats.lexEnd;
+        double overlap = (lex_end < pipe_stats.parseEnd ? lex_end : pipe_stats.parseEnd) -
+                         (pipe_stats.lexStart > pipe_stats.parseStart ? pipe_stats.lexStart : pipe_stats.parseStart);
+        fprintf(stderr, "lex %.2f ms, parse %.2f ms (waiting %.2f ms), overlap %.2f ms, "
+                "lexer stalled %.2f ms, total %.2f ms, %d tokens\n",
+                pipe_stats.lexEnd - pipe_stats.lexStart,
+                pipe_stats.parseEnd - pipe_stats.parseStart, pipe_stats.parserWait,
+                overlap > 0 ? overlap : 0, pipe_stats.lexerWait,
+                (lex_end > pipe_stats.parseEnd ? lex_end : pipe_stats.parseEnd), token_count);
+    } else if (show_stats) {
+        fprintf(stderr, "lex %.2f ms, parse %.2f ms, total %.2f ms, %d tokens\n",
+                lex_ms, parse_ms, lex_ms + parse_ms, token_count);
+    }
+    if (show_stats) {
+        long long tlb_misses;
+        if (dtlb_counter_stop(tlb_counter, &tlb_misses)) {
+            fprintf(stderr, "dTLB load misses %lld (%.3f per token), huge pages %s\n", tlb_misses,
+                    token_count > 0 ? (double)tlb_misses / token_count : 0.0, huge_mode_name(huge_pages));
+        } else {
+            fprintf(stderr, "dTLB load misses unavailable, huge pages %s\n", huge_mode_name(huge_pages));
+        }
+    }
+
+    int bounds_ok = 1;
+    if (bounds_check && ok && !outline_only) {
+        ok = bounds_ok = check_bounds(tokens, token_count, filename ? filename : from_tokens,
+                                      source ? &lines : NULL, remarks);
+    }
+    if (dump_layout && ok && !outline_only) {
+        ok = print_data_layout(tokens, token_count, soa);
+    }
+    if (remarks && ok && !outline_only) {
+        ok = print_remarks(tokens, token_count, &strings, filename ? filename : from_tokens,
+                           source ? &lines : NULL);
+    }
+
+    if (cache_dir && !entry.map) {
+        cache_store(cache_dir, key, source_length, tokens, token_count, ok, cache_max);
+    }
+
+    if (entry.map) {
+        cache_release(&entry);
+    } else {
+        huge_free(tokens);  // Free allocated memory
+    }
+    string_pool_free(&strings);
+    if (source) {
+        line_index_free(&lines);
+        free(source);
+    }
+
+    if (!bounds_ok) {
+        printf("Array bounds check failed!\n");
+        return -1;
+    }
+    if (!ok) {
         printf("Syntax analysis failed!\n");
-        free(tokens);
         return -1;
     }
 
     printf("Syntax analysis successful!\n");
-    free(tokens);  // Free allocated memory
     return 0;
 }
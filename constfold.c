@@ -0,0 +1,696 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "constfold.h"
+
+#define MAX_LOCALS 64       // Parameters and locals of one interpreted call
+#define MAX_ARGS 16
+
+// Declared types the interpreter knows, with int and float 4 bytes and char
+// 1 as in layout.c
+typedef enum {
+    SCALAR_INT, SCALAR_CHAR, SCALAR_FLOAT, SCALAR_DOUBLE
+} ScalarType;
+
+typedef struct {
+    int name;               // Token of the declared name
+    ScalarType type;
+    ConstValue value;
+} Local;
+
+typedef struct {
+    Local locals[MAX_LOCALS];
+    int count;
+} Frame;
+
+// Cursor over one expression
+typedef struct {
+    ConstEvaluator *ev;
+    Frame *frame;           // Locals of the interpreted call, NULL outside calls
+    int pos;
+    int end;
+    bool skip;              // Parse only: the side of && and || that is not taken
+} Eval;
+
+typedef enum {
+    EXEC_NORMAL, EXEC_RETURN
+} ExecStatus;
+
+static int exec_statement(ConstEvaluator *ev, Frame *frame, int start, ExecStatus *status,
+                          bool *has_result, ConstValue *result);
+
+void const_evaluator_init(ConstEvaluator *ev, const Token *tokens, int token_count,
+                          const int *brackets, const CallGraph *graph) {
+    ev->tokens = tokens;
+    ev->tokenCount = token_count;
+    ev->brackets = brackets;
+    ev->graph = graph;
+    ev->steps = CONST_EVAL_STEPS;
+    ev->budget = -1;
+    ev->depth = 0;
+}
+
+// Count one step of work and one level of nesting; 0 when over budget
+static int enter(ConstEvaluator *ev) {
+    ev->steps--;
+    ev->depth++;
+    return ev->steps >= 0 && ev->depth <= CONST_EVAL_DEPTH;
+}
+
+static int leave(ConstEvaluator *ev, int ok) {
+    ev->depth--;
+    return ok;
+}
+
+static TokenType peek(const Eval *e) {
+    return e->pos < e->end ? e->ev->tokens[e->pos].type : TOKEN_EOF;
+}
+
+static ConstValue integer_value(int64_t integer) {
+    ConstValue value = {false, false, false, integer, 0};
+    return value;
+}
+
+static ConstValue long_value(int64_t integer) {
+    ConstValue value = {false, true, false, integer, 0};
+    return value;
+}
+
+static ConstValue real_value(double real) {
+    ConstValue value = {true, false, false, 0, real};
+    return value;
+}
+
+static ConstValue float_value(double real) {
+    ConstValue value = {true, false, true, 0, (float)real};
+    return value;
+}
+
+static double as_real(ConstValue value) {
+    return value.isReal ? value.real : (double)value.integer;
+}
+
+static bool is_true(ConstValue value) {
+    return value.isReal ? value.real != 0 : value.integer != 0;
+}
+
+// Wrap to the 32 bits of an int, as the compiled code would
+static ConstValue int_value(int64_t integer) {
+    return integer_value((int32_t)(uint32_t)(uint64_t)integer);
+}
+
+// Convert to a declared type: double, float, int or char
+static int convert(ConstValue value, ScalarType type, ConstValue *out) {
+    if (type == SCALAR_DOUBLE || type == SCALAR_FLOAT) {
+        *out = (type == SCALAR_FLOAT ? float_value : real_value)(as_real(value));
+        return 1;
+    }
+    if (value.isReal) {
+        if (!(value.real > INT32_MIN - 1.0 && value.real < INT32_MAX + 1.0)) {
+            return 0;   // NaN or out of the range of int
+        }
+        value = integer_value((int64_t)value.real);
+    }
+    *out = type == SCALAR_CHAR ? integer_value((int8_t)(uint8_t)(uint64_t)value.integer)
+                               : int_value(value.integer);
+    return 1;
+}
+
+static int is_scalar_type(const Token *token, ScalarType *type) {
+    if (token_is_keyword(token, KEYWORD_DOUBLE)) {
+        *type = SCALAR_DOUBLE;
+    } else if (token_is_keyword(token, KEYWORD_FLOAT)) {
+        *type = SCALAR_FLOAT;
+    } else if (token_is_keyword(token, KEYWORD_CHAR)) {
+        *type = SCALAR_CHAR;
+    } else {
+        *type = SCALAR_INT;
+        return token_is_keyword(token, KEYWORD_INT);
+    }
+    return 1;
+}
+
+static Local *find_local(const Eval *e, int name) {
+    if (!e->frame) {
+        return NULL;
+    }
+    const char *text = e->ev->tokens[name].value;
+    for (int i = e->frame->count - 1; i >= 0; i--) {
+        if (strcmp(e->ev->tokens[e->frame->locals[i].name].value, text) == 0) {
+            return &e->frame->locals[i];
+        }
+    }
+    return NULL;
+}
+
+static int binary(TokenType op, ConstValue a, ConstValue b, bool skip, ConstValue *out) {
+    if (a.isReal || b.isReal) {
+        // float unless one operand is a double
+        double x = as_real(a), y = as_real(b);
+        ConstValue (*real)(double) = (a.isFloat || !a.isReal) && (b.isFloat || !b.isReal) ? float_value : real_value;
+        switch (op) {
+            case TOKEN_PLUS: *out = real(x + y); return 1;
+            case TOKEN_MINUS: *out = real(x - y); return 1;
+            case TOKEN_MULTIPLY: *out = real(x * y); return 1;
+            case TOKEN_DIVIDE: *out = real(x / y); return 1;
+            case TOKEN_LESS: *out = integer_value(x < y); return 1;
+            case TOKEN_LESSEQUAL: *out = integer_value(x <= y); return 1;
+            case TOKEN_GREATER: *out = integer_value(x > y); return 1;
+            case TOKEN_GREATEREQUAL: *out = integer_value(x >= y); return 1;
+            case TOKEN_EQUAL: *out = integer_value(x == y); return 1;
+            case TOKEN_NOTEQUAL: *out = integer_value(x != y); return 1;
+            default: return 0;
+        }
+    }
+
+    // Operands are ints (char is promoted), or 64 bits wide if one of them
+    // is; the result wraps to that width instead of overflowing
+    uint64_t x = (uint64_t)a.integer, y = (uint64_t)b.integer;
+    ConstValue (*wrap)(int64_t) = a.isLong || b.isLong ? long_value : int_value;
+    switch (op) {
+        case TOKEN_PLUS: *out = wrap((int64_t)(x + y)); return 1;
+        case TOKEN_MINUS: *out = wrap((int64_t)(x - y)); return 1;
+        case TOKEN_MULTIPLY: *out = wrap((int64_t)(x * y)); return 1;
+        case TOKEN_DIVIDE:
+            if (b.integer == 0 || (a.integer == INT64_MIN && b.integer == -1)) {
+                *out = integer_value(0);
+                return skip;    // Only an error if it is evaluated
+            }
+            *out = wrap(a.integer / b.integer);
+            return 1;
+        case TOKEN_LESS: *out = integer_value(a.integer < b.integer); return 1;
+        case TOKEN_LESSEQUAL: *out = integer_value(a.integer <= b.integer); return 1;
+        case TOKEN_GREATER: *out = integer_value(a.integer > b.integer); return 1;
+        case TOKEN_GREATEREQUAL: *out = integer_value(a.integer >= b.integer); return 1;
+        case TOKEN_EQUAL: *out = integer_value(a.integer == b.integer); return 1;
+        case TOKEN_NOTEQUAL: *out = integer_value(a.integer != b.integer); return 1;
+        default: return 0;
+    }
+}
+
+static int eval_assign(Eval *e, ConstValue *value);
+
+// Run function node f of the call graph with args. Only scalar parameters
+// and return types qualify.
+static int call_function(ConstEvaluator *ev, int f, const ConstValue *args, int arg_count, ConstValue *result) {
+    const Token *tokens = ev->tokens;
+    const CallNode *node = &ev->graph->nodes[f];
+    ScalarType returns;
+    if (node->nameIndex < 1 || !is_scalar_type(&tokens[node->nameIndex - 1], &returns)) {
+        return 0;
+    }
+
+    Frame *frame = (Frame *)malloc(sizeof(Frame));
+    if (!frame) {
+        return 0;
+    }
+    frame->count = 0;
+    int ok = 1;
+    int p = node->paramsStart + 1;
+    if (p + 1 == node->paramsEnd && token_is_keyword(&tokens[p], KEYWORD_VOID)) {
+        p++;
+    }
+    while (ok && p < node->paramsEnd) {
+        ScalarType type;
+        ok = frame->count < arg_count && frame->count < MAX_LOCALS &&
+             is_scalar_type(&tokens[p], &type) && tokens[p + 1].type == TOKEN_IDENTIFIER &&
+             (tokens[p + 2].type == TOKEN_COMMA || tokens[p + 2].type == TOKEN_RPAREN);
+        if (ok) {
+            Local *local = &frame->locals[frame->count];
+            local->name = p + 1;
+            local->type = type;
+            ok = convert(args[frame->count], type, &local->value);
+            frame->count++;
+        }
+        p += 3;
+    }
+    ok = ok && frame->count == arg_count;
+
+    ExecStatus status = EXEC_NORMAL;
+    bool has_result = false;
+    ok = ok && exec_statement(ev, frame, node->bodyStart, &status, &has_result, result) &&
+         status == EXEC_RETURN && has_result && convert(*result, returns, result);
+    free(frame);
+    return ok;
+}
+
+static int eval_call(Eval *e, ConstValue *value) {
+    ConstEvaluator *ev = e->ev;
+    int name = e->pos;
+    int open = name + 1;
+    int close = ev->brackets[open];
+    ConstValue args[MAX_ARGS];
+    int arg_count = 0;
+
+    if (close < 0 || close >= e->end) {
+        return 0;
+    }
+    if (close > open + 1) {
+        Eval arg = {ev, e->frame, open + 1, close, e->skip};
+        for (;;) {
+            if (arg_count == MAX_ARGS || !eval_assign(&arg, &args[arg_count++])) {
+                return 0;
+            }
+            if (peek(&arg) != TOKEN_COMMA) {
+                break;
+            }
+            arg.pos++;
+        }
+        if (arg.pos != close) {
+            return 0;
+        }
+    }
+    e->pos = close + 1;
+    if (e->skip) {
+        *value = integer_value(0);
+        return 1;
+    }
+
+    int f = ev->graph ? call_graph_find(ev->graph, ev->tokens, ev->tokens[name].value) : -1;
+    return f >= 0 && call_function(ev, f, args, arg_count, value);
+}
+
+static int eval_primary(Eval *e, ConstValue *value) {
+    const Token *token = &e->ev->tokens[e->pos];
+    switch (peek(e)) {
+        case TOKEN_NUMBER_ZEC: case TOKEN_NUMBER_HEX: case TOKEN_NUMBER_OCT: case TOKEN_CHAR_LITERAL:
+            *value = token->literal.integer == (int32_t)token->literal.integer
+                     ? integer_value(token->literal.integer) : long_value(token->literal.integer);
+            e->pos++;
+            return 1;
+        case TOKEN_REAL:
+            *value = real_value(token->literal.real);
+            e->pos++;
+            return 1;
+        case TOKEN_LPAREN: {
+            int close = e->ev->brackets[e->pos];
+            if (close < 0 || close >= e->end) {
+                return 0;
+            }
+            Eval inner = {e->ev, e->frame, e->pos + 1, close, e->skip};
+            if (!eval_assign(&inner, value) || inner.pos != close) {
+                return 0;
+            }
+            e->pos = close + 1;
+            return 1;
+        }
+        case TOKEN_IDENTIFIER: {
+            if (e->pos + 1 < e->end && e->ev->tokens[e->pos + 1].type == TOKEN_LPAREN) {
+                return eval_call(e, value);
+            }
+            Local *local = find_local(e, e->pos);
+            if (!local && !e->skip) {
+                return 0;   // Globals, arrays and unknown names
+            }
+            *value = local ? local->value : integer_value(0);
+            e->pos++;
+            // x++ and x--
+            TokenType next = peek(e);
+            if (next == TOKEN_PLUS_1 || next == TOKEN_MINUS_1) {
+                ConstValue one = integer_value(1);
+                if (!local || (!e->skip &&
+                               (!binary(next == TOKEN_PLUS_1 ? TOKEN_PLUS : TOKEN_MINUS, local->value, one,
+                                        false, &local->value) ||
+                                !convert(local->value, local->type, &local->value)))) {
+                    return 0;
+                }
+                e->pos++;
+            }
+            return 1;
+        }
+        default:
+            return 0;   // Strings, arrays, fields and anything else
+    }
+}
+
+static int eval_unary(Eval *e, ConstValue *value) {
+    ConstEvaluator *ev = e->ev;
+    if (!enter(ev)) {
+        return leave(ev, 0);
+    }
+    TokenType type = peek(e);
+    ScalarType to_type;
+
+    if (type == TOKEN_MINUS || type == TOKEN_NOT) {
+        e->pos++;
+        if (!eval_unary(e, value)) {
+            return leave(ev, 0);
+        }
+        if (type == TOKEN_NOT) {
+            *value = integer_value(!is_true(*value));
+        } else if (value->isReal) {
+            value->real = -value->real;
+        } else {
+            *value = (value->isLong ? long_value : int_value)((int64_t)(0 - (uint64_t)value->integer));
+        }
+        return leave(ev, 1);
+    }
+    if (type == TOKEN_LPAREN && e->pos + 2 < e->end && ev->brackets[e->pos] == e->pos + 2 &&
+        is_scalar_type(&ev->tokens[e->pos + 1], &to_type)) {
+        // Cast to int, char, float or double
+        e->pos += 3;
+        return leave(ev, eval_unary(e, value) && convert(*value, to_type, value));
+    }
+    if ((type == TOKEN_PLUS_1 || type == TOKEN_MINUS_1) && e->pos + 1 < e->end) {
+        // ++x and --x
+        Local *local = find_local(e, e->pos + 1);
+        if (!local || ev->tokens[e->pos + 1].type != TOKEN_IDENTIFIER) {
+            return leave(ev, 0);
+        }
+        e->pos += 2;
+        if (!e->skip) {
+            ConstValue one = integer_value(1);
+            if (!binary(type == TOKEN_PLUS_1 ? TOKEN_PLUS : TOKEN_MINUS, local->value, one, false, &local->value) ||
+                !convert(local->value, local->type, &local->value)) {
+                return leave(ev, 0);
+            }
+        }
+        *value = local->value;
+        return leave(ev, 1);
+    }
+    return leave(ev, eval_primary(e, value));
+}
+
+// Binary operators from the loosest: || && (== !=) (< <= > >=) (+ -) (* /)
+static int binary_level(TokenType type) {
+    switch (type) {
+        case TOKEN_OR: return 1;
+        case TOKEN_AND: return 2;
+        case TOKEN_EQUAL: case TOKEN_NOTEQUAL: return 3;
+        case TOKEN_LESS: case TOKEN_LESSEQUAL: case TOKEN_GREATER: case TOKEN_GREATEREQUAL: return 4;
+        case TOKEN_PLUS: case TOKEN_MINUS: return 5;
+        case TOKEN_MULTIPLY: case TOKEN_DIVIDE: return 6;
+        default: return 0;
+    }
+}
+
+static int eval_binary(Eval *e, int min_level, ConstValue *value) {
+    if (!eval_unary(e, value)) {
+        return 0;
+    }
+    for (;;) {
+        TokenType op = peek(e);
+        int level = binary_level(op);
+        if (level == 0 || level < min_level) {
+            return 1;
+        }
+        e->pos++;
+
+        if (op == TOKEN_AND || op == TOKEN_OR) {
+            // The right side only runs when the left one does not decide
+            bool decided = (op == TOKEN_AND) != is_true(*value);
+            bool skip = e->skip;
+            ConstValue right;
+            e->skip = skip || decided;
+            int ok = eval_binary(e, level + 1, &right);
+            e->skip = skip;
+            if (!ok) {
+                return 0;
+            }
+            *value = integer_value(decided ? is_true(*value) : is_true(right));
+            continue;
+        }
+
+        ConstValue right;
+        if (!eval_binary(e, level + 1, &right) || !binary(op, *value, right, e->skip, value)) {
+            return 0;
+        }
+    }
+}
+
+static int eval_assign(Eval *e, ConstValue *value) {
+    if (peek(e) == TOKEN_IDENTIFIER && e->pos + 1 < e->end &&
+        e->ev->tokens[e->pos + 1].type == TOKEN_ASSIGN) {
+        Local *local = find_local(e, e->pos);
+        if (!local) {
+            return 0;   // Writes outside the interpreted call are side effects
+        }
+        e->pos += 2;
+        if (!eval_assign(e, value)) {
+            return 0;
+        }
+        if (e->skip) {
+            return 1;
+        }
+        if (!convert(*value, local->type, &local->value)) {
+            return 0;
+        }
+        *value = local->value;
+        return 1;
+    }
+    return eval_binary(e, 1, value);
+}
+
+static int eval_range(ConstEvaluator *ev, Frame *frame, int start, int end, ConstValue *value) {
+    Eval e = {ev, frame, start, end, false};
+    return start < end && eval_assign(&e, value) && e.pos == end;
+}
+
+int const_eval(ConstEvaluator *ev, int start, int end, ConstValue *value) {
+    long allowed = CONST_EVAL_STEPS;
+    if (ev->budget >= 0 && ev->budget < allowed) {
+        allowed = ev->budget;
+    }
+    ev->steps = allowed;
+    ev->depth = 0;
+    int ok = eval_range(ev, NULL, start, end, value);
+    if (ev->budget >= 0) {
+        long used = allowed - (ev->steps > 0 ? ev->steps : 0);
+        ev->budget = used < ev->budget ? ev->budget - used : 0;
+    }
+    return ok;
+}
+
+// Declare the locals of "type a = x, b;" at start; returns the ';' or -1
+static int exec_declaration(ConstEvaluator *ev, Frame *frame, int start, ScalarType type) {
+    const Token *tokens = ev->tokens;
+    int end = statement_end(tokens, ev->tokenCount, ev->brackets, start);
+    int p = start + 1;
+    for (;;) {
+        if (p >= end || tokens[p].type != TOKEN_IDENTIFIER || frame->count >= MAX_LOCALS) {
+            return -1;
+        }
+        Local *local = &frame->locals[frame->count];
+        local->name = p;
+        local->type = type;
+        local->value = integer_value(0);
+        int q = p + 1;
+        if (tokens[q].type == TOKEN_ASSIGN) {
+            // The initializer ends at the next ',' or ';' outside brackets
+            q++;
+            int init = q;
+            while (q < end && tokens[q].type != TOKEN_COMMA) {
+                if (ev->brackets[q] > q) {
+                    q = ev->brackets[q];
+                }
+                q++;
+            }
+            ConstValue value;
+            if (!eval_range(ev, frame, init, q, &value) || !convert(value, type, &local->value)) {
+                return -1;
+            }
+        }
+        frame->count++;
+        if (q == end) {
+            return end;
+        }
+        if (tokens[q].type != TOKEN_COMMA) {
+            return -1;   // Arrays
+        }
+        p = q + 1;
+    }
+}
+
+// Index of the ';' at depth 0 in (start, end), or -1
+static int find_semicolon(const ConstEvaluator *ev, int start, int end) {
+    for (int i = start; i < end; i++) {
+        if (ev->tokens[i].type == TOKEN_SEMICOLON) {
+            return i;
+        }
+        if (ev->brackets[i] > i) {
+            i = ev->brackets[i];
+        }
+    }
+    return -1;
+}
+
+static int exec_statement(ConstEvaluator *ev, Frame *frame, int start, ExecStatus *status,
+                          bool *has_result, ConstValue *result) {
+    const Token *tokens = ev->tokens;
+    const int *brackets = ev->brackets;
+    ConstValue value;
+    ScalarType type;
+
+    *status = EXEC_NORMAL;
+    if (start >= ev->tokenCount || !enter(ev)) {
+        return leave(ev, 0);
+    }
+    const Token *token = &tokens[start];
+    int end = statement_end(tokens, ev->tokenCount, brackets, start);
+
+    if (token->type == TOKEN_LBRACE) {
+        int saved = frame->count;
+        int close = brackets[start];
+        for (int k = start + 1; k < close; ) {
+            if (is_scalar_type(&tokens[k], &type)) {
+                k = exec_declaration(ev, frame, k, type);
+                if (k < 0) {
+                    return leave(ev, 0);
+                }
+                k++;
+                continue;
+            }
+            int next = statement_end(tokens, ev->tokenCount, brackets, k) + 1;
+            if (!exec_statement(ev, frame, k, status, has_result, result)) {
+                return leave(ev, 0);
+            }
+            if (*status == EXEC_RETURN) {
+                break;
+            }
+            k = next;
+        }
+        frame->count = saved;
+        return leave(ev, 1);
+    }
+    if (token->type == TOKEN_SEMICOLON) {
+        return leave(ev, 1);
+    }
+    if (token_is_keyword(token, KEYWORD_RETURN)) {
+        *status = EXEC_RETURN;
+        *has_result = end > start + 1;
+        return leave(ev, !*has_result || eval_range(ev, frame, start + 1, end, result));
+    }
+
+    if (token->type == TOKEN_KEYWORD && start + 1 < ev->tokenCount && tokens[start + 1].type == TOKEN_LPAREN) {
+        int open = start + 1;
+        int close = brackets[open];
+        int body = close + 1;
+        if (close < 0) {
+            return leave(ev, 0);
+        }
+
+        if (token_is_keyword(token, KEYWORD_IF)) {
+            int then_end = statement_end(tokens, ev->tokenCount, brackets, body);
+            int has_else = then_end + 1 < ev->tokenCount && token_is_keyword(&tokens[then_end + 1], KEYWORD_ELSE);
+            if (!eval_range(ev, frame, open + 1, close, &value)) {
+                return leave(ev, 0);
+            }
+            if (is_true(value)) {
+                return leave(ev, exec_statement(ev, frame, body, status, has_result, result));
+            }
+            return leave(ev, !has_else || exec_statement(ev, frame, then_end + 2, status, has_result, result));
+        }
+
+        // while (cond) and for (init; cond; step)
+        int cond_start = open + 1, cond_end = close, step_start = close, step_end = close;
+        if (token_is_keyword(token, KEYWORD_FOR)) {
+            int first = find_semicolon(ev, open + 1, close);
+            int second = first >= 0 ? find_semicolon(ev, first + 1, close) : -1;
+            if (second < 0 || (first > open + 1 && !eval_range(ev, frame, open + 1, first, &value))) {
+                return leave(ev, 0);
+            }
+            cond_start = first + 1;
+            cond_end = second;
+            step_start = second + 1;
+        } else if (!token_is_keyword(token, KEYWORD_WHILE)) {
+            return leave(ev, 0);
+        }
+        for (;;) {
+            if (cond_end > cond_start) {
+                if (!eval_range(ev, frame, cond_start, cond_end, &value)) {
+                    return leave(ev, 0);
+                }
+                if (!is_true(value)) {
+                    return leave(ev, 1);
+                }
+            }
+            if (!exec_statement(ev, frame, body, status, has_result, result)) {
+                return leave(ev, 0);
+            }
+            if (*status == EXEC_RETURN) {
+                return leave(ev, 1);
+            }
+            if (step_end > step_start && !eval_range(ev, frame, step_start, step_end, &value)) {
+                return leave(ev, 0);
+            }
+        }
+    }
+
+    // Expression statement
+    return leave(ev, eval_range(ev, frame, start, end, &value));
+}
+
+static bool is_trivial(const Token *tokens, int start, int end) {
+    return end - start == 1 || (end - start == 2 && tokens[start].type == TOKEN_MINUS);
+}
+
+// End of the expression starting at start: the first ';' or ',' outside
+// brackets, or the closer of the brackets around it
+static int expression_end(const ConstEvaluator *ev, int start) {
+    int i = start;
+    while (i < ev->tokenCount) {
+        TokenType type = ev->tokens[i].type;
+        if (type == TOKEN_SEMICOLON || type == TOKEN_COMMA || type == TOKEN_RPAREN ||
+            type == TOKEN_RBRACKET || type == TOKEN_RBRACE) {
+            break;
+        }
+        if (ev->brackets[i] > i) {
+            i = ev->brackets[i];
+        }
+        i++;
+    }
+    return i;
+}
+
+static void print_value(FILE *out, ConstValue value) {
+    if (value.isReal) {
+        fprintf(out, "%.*g", value.isFloat ? 9 : 17, value.real);
+    } else {
+        fprintf(out, "%lld", (long long)value.integer);
+    }
+}
+
+int print_fold_remarks(ConstEvaluator *ev, const char *filename, LineIndex *lines, FILE *out) {
+    const Token *tokens = ev->tokens;
+    int remarks = 0;
+
+    // Interpreting calls at every site must not make the pass superlinear
+    ev->budget = CONST_EVAL_STEPS + (long)CONST_EVAL_STEPS_PER_TOKEN * ev->tokenCount;
+    for (int k = 0; k < ev->tokenCount; k++) {
+        const Token *token = &tokens[k];
+        int start = -1, end = -1, condition = 0;
+        ConstValue value;
+
+        if ((token_is_keyword(token, KEYWORD_IF) || token_is_keyword(token, KEYWORD_WHILE)) &&
+            k + 1 < ev->tokenCount && ev->brackets[k + 1] > k + 1) {
+            start = k + 2;
+            end = ev->brackets[k + 1];
+            condition = 1;
+        } else if (token_is_keyword(token, KEYWORD_FOR) && k + 1 < ev->tokenCount && ev->brackets[k + 1] > k + 1) {
+            int first = find_semicolon(ev, k + 2, ev->brackets[k + 1]);
+            start = first + 1;
+            end = first >= 0 ? find_semicolon(ev, start, ev->brackets[k + 1]) : -1;
+            condition = 1;
+        } else if (token->type == TOKEN_ASSIGN || token_is_keyword(token, KEYWORD_RETURN) ||
+                   token->type == TOKEN_LBRACKET) {
+            start = k + 1;
+            end = expression_end(ev, start);
+        }
+        if (start < 0 || end <= start || (!condition && is_trivial(tokens, start, end)) ||
+            !const_eval(ev, start, end, &value)) {
+            continue;
+        }
+
+        print_location(out, filename, lines, tokens[start].offset, start);
+        if (condition) {
+            fprintf(out, ": remark: condition is always %s\n", is_true(value) ? "true" : "false");
+        } else {
+            fprintf(out, ": remark: expression folds to ");
+            print_value(out, value);
+            fputc('\n', out);
+        }
+        remarks++;
+    }
+    ev->budget = -1;
+    return remarks;
+}
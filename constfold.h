@@ -0,0 +1,52 @@
+#ifndef CONSTFOLD_H
+#define CONSTFOLD_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "lexer.h"
+#include "lineindex.h"
+#include "callgraph.h"
+
+// Steps (expressions and statements) one top-level evaluation may take,
+// including the functions it calls
+#define CONST_EVAL_STEPS 100000
+#define CONST_EVAL_DEPTH 200    // Nesting of expressions, statements and calls
+#define CONST_EVAL_STEPS_PER_TOKEN 16   // Shared budget of print_fold_remarks
+
+typedef struct {
+    bool isReal;
+    bool isLong;        // From an integer literal too wide for int, computed in 64 bits
+    bool isFloat;       // A real of type float, rounded to float after each operation
+    int64_t integer;
+    double real;
+} ConstValue;
+
+// Compile-time evaluator over a token array with its bracket index.
+// Functions of graph with only scalar parameters and locals, that read no
+// globals and call nothing undefined, are run by an interpreter within the
+// step budget; with graph == NULL no calls are constant.
+typedef struct {
+    const Token *tokens;
+    int tokenCount;
+    const int *brackets;
+    const CallGraph *graph;
+    long steps;     // Left for the current evaluation
+    long budget;    // Left for all further evaluations, -1 for no limit
+    int depth;
+} ConstEvaluator;
+
+void const_evaluator_init(ConstEvaluator *ev, const Token *tokens, int token_count,
+                          const int *brackets, const CallGraph *graph);
+
+// Evaluate the expression in tokens [start, end). Returns 1 and sets *value
+// if it is a constant, 0 otherwise.
+int const_eval(ConstEvaluator *ev, int start, int end, ConstValue *value);
+
+// Print a remark for every condition with a known outcome and every
+// non-trivial initializer, assigned value or returned value that folds to
+// a constant. Returns the number of remarks.
+int print_fold_remarks(ConstEvaluator *ev, const char *filename, LineIndex *lines, FILE *out);
+
+#endif
@@ -0,0 +1,602 @@
+int f0(){return f1();}
+int f1(){return f2();}
+int f2(){return f3();}
+int f3(){return f4();}
+int f4(){return f5();}
+int f5(){return f6();}
+int f6(){return f7();}
+int f7(){return f8();}
+int f8(){return f9();}
+int f9(){return f10();}
+int f10(){return f11();}
+int f11(){return f12();}
+int f12(){return f13();}
+int f13(){return f14();}
+int f14(){return f15();}
+int f15(){return f16();}
+int f16(){return f17();}
+int f17(){return f18();}
+int f18(){return f19();}
+int f19(){return f20();}
+int f20(){return f21();}
+int f21(){return f22();}
+int f22(){return f23();}
+int f23(){return f24();}
+int f24(){return f25();}
+int f25(){return f26();}
+int f26(){return f27();}
+int f27(){return f28();}
+int f28(){return f29();}
+int f29(){return f30();}
+int f30(){return f31();}
+int f31(){return f32();}
+int f32(){return f33();}
+int f33(){return f34();}
+int f34(){return f35();}
+int f35(){return f36();}
+int f36(){return f37();}
+int f37(){return f38();}
+int f38(){return f39();}
+int f39(){return f40();}
+int f40(){return f41();}
+int f41(){return f42();}
+int f42(){return f43();}
+int f43(){return f44();}
+int f44(){return f45();}
+int f45(){return f46();}
+int f46(){return f47();}
+int f47(){return f48();}
+int f48(){return f49();}
+int f49(){return f50();}
+int f50(){return f51();}
+int f51(){return f52();}
+int f52(){return f53();}
+int f53(){return f54();}
+int f54(){return f55();}
+int f55(){return f56();}
+int f56(){return f57();}
+int f57(){return f58();}
+int f58(){return f59();}
+int f59(){return f60();}
+int f60(){return f61();}
+int f61(){return f62();}
+int f62(){return f63();}
+int f63(){return f64();}
+int f64(){return f65();}
+int f65(){return f66();}
+int f66(){return f67();}
+int f67(){return f68();}
+int f68(){return f69();}
+int f69(){return f70();}
+int f70(){return f71();}
+int f71(){return f72();}
+int f72(){return f73();}
+int f73(){return f74();}
+int f74(){return f75();}
+int f75(){return f76();}
+int f76(){return f77();}
+int f77(){return f78();}
+int f78(){return f79();}
+int f79(){return f80();}
+int f80(){return f81();}
+int f81(){return f82();}
+int f82(){return f83();}
+int f83(){return f84();}
+int f84(){return f85();}
+int f85(){return f86();}
+int f86(){return f87();}
+int f87(){return f88();}
+int f88(){return f89();}
+int f89(){return f90();}
+int f90(){return f91();}
+int f91(){return f92();}
+int f92(){return f93();}
+int f93(){return f94();}
+int f94(){return f95();}
+int f95(){return f96();}
+int f96(){return f97();}
+int f97(){return f98();}
+int f98(){return f99();}
+int f99(){return f100();}
+int f100(){return f101();}
+int f101(){return f102();}
+int f102(){return f103();}
+int f103(){return f104();}
+int f104(){return f105();}
+int f105(){return f106();}
+int f106(){return f107();}
+int f107(){return f108();}
+int f108(){return f109();}
+int f109(){return f110();}
+int f110(){return f111();}
+int f111(){return f112();}
+int f112(){return f113();}
+int f113(){return f114();}
+int f114(){return f115();}
+int f115(){return f116();}
+int f116(){return f117();}
+int f117(){return f118();}
+int f118(){return f119();}
+int f119(){return f120();}
+int f120(){return f121();}
+int f121(){return f122();}
+int f122(){return f123();}
+int f123(){return f124();}
+int f124(){return f125();}
+int f125(){return f126();}
+int f126(){return f127();}
+int f127(){return f128();}
+int f128(){return f129();}
+int f129(){return f130();}
+int f130(){return f131();}
+int f131(){return f132();}
+int f132(){return f133();}
+int f133(){return f134();}
+int f134(){return f135();}
+int f135(){return f136();}
+int f136(){return f137();}
+int f137(){return f138();}
+int f138(){return f139();}
+int f139(){return f140();}
+int f140(){return f141();}
+int f141(){return f142();}
+int f142(){return f143();}
+int f143(){return f144();}
+int f144(){return f145();}
+int f145(){return f146();}
+int f146(){return f147();}
+int f147(){return f148();}
+int f148(){return f149();}
+int f149(){return f150();}
+int f150(){return f151();}
+int f151(){return f152();}
+int f152(){return f153();}
+int f153(){return f154();}
+int f154(){return f155();}
+int f155(){return f156();}
+int f156(){return f157();}
+int f157(){return f158();}
+int f158(){return f159();}
+int f159(){return f160();}
+int f160(){return f161();}
+int f161(){return f162();}
+int f162(){return f163();}
+int f163(){return f164();}
+int f164(){return f165();}
+int f165(){return f166();}
+int f166(){return f167();}
+int f167(){return f168();}
+int f168(){return f169();}
+int f169(){return f170();}
+int f170(){return f171();}
+int f171(){return f172();}
+int f172(){return f173();}
+int f173(){return f174();}
+int f174(){return f175();}
+int f175(){return f176();}
+int f176(){return f177();}
+int f177(){return f178();}
+int f178(){return f179();}
+int f179(){return f180();}
+int f180(){return f181();}
+int f181(){return f182();}
+int f182(){return f183();}
+int f183(){return f184();}
+int f184(){return f185();}
+int f185(){return f186();}
+int f186(){return f187();}
+int f187(){return f188();}
+int f188(){return f189();}
+int f189(){return f190();}
+int f190(){return f191();}
+int f191(){return f192();}
+int f192(){return f193();}
+int f193(){return f194();}
+int f194(){return f195();}
+int f195(){return f196();}
+int f196(){return f197();}
+int f197(){return f198();}
+int f198(){return f199();}
+int f199(){return f200();}
+int f200(){return f201();}
+int f201(){return f202();}
+int f202(){return f203();}
+int f203(){return f204();}
+int f204(){return f205();}
+int f205(){return f206();}
+int f206(){return f207();}
+int f207(){return f208();}
+int f208(){return f209();}
+int f209(){return f210();}
+int f210(){return f211();}
+int f211(){return f212();}
+int f212(){return f213();}
+int f213(){return f214();}
+int f214(){return f215();}
+int f215(){return f216();}
+int f216(){return f217();}
+int f217(){return f218();}
+int f218(){return f219();}
+int f219(){return f220();}
+int f220(){return f221();}
+int f221(){return f222();}
+int f222(){return f223();}
+int f223(){return f224();}
+int f224(){return f225();}
+int f225(){return f226();}
+int f226(){return f227();}
+int f227(){return f228();}
+int f228(){return f229();}
+int f229(){return f230();}
+int f230(){return f231();}
+int f231(){return f232();}
+int f232(){return f233();}
+int f233(){return f234();}
+int f234(){return f235();}
+int f235(){return f236();}
+int f236(){return f237();}
+int f237(){return f238();}
+int f238(){return f239();}
+int f239(){return f240();}
+int f240(){return f241();}
+int f241(){return f242();}
+int f242(){return f243();}
+int f243(){return f244();}
+int f244(){return f245();}
+int f245(){return f246();}
+int f246(){return f247();}
+int f247(){return f248();}
+int f248(){return f249();}
+int f249(){return f250();}
+int f250(){return f251();}
+int f251(){return f252();}
+int f252(){return f253();}
+int f253(){return f254();}
+int f254(){return f255();}
+int f255(){return f256();}
+int f256(){return f257();}
+int f257(){return f258();}
+int f258(){return f259();}
+int f259(){return f260();}
+int f260(){return f261();}
+int f261(){return f262();}
+int f262(){return f263();}
+int f263(){return f264();}
+int f264(){return f265();}
+int f265(){return f266();}
+int f266(){return f267();}
+int f267(){return f268();}
+int f268(){return f269();}
+int f269(){return f270();}
+int f270(){return f271();}
+int f271(){return f272();}
+int f272(){return f273();}
+int f273(){return f274();}
+int f274(){return f275();}
+int f275(){return f276();}
+int f276(){return f277();}
+int f277(){return f278();}
+int f278(){return f279();}
+int f279(){return f280();}
+int f280(){return f281();}
+int f281(){return f282();}
+int f282(){return f283();}
+int f283(){return f284();}
+int f284(){return f285();}
+int f285(){return f286();}
+int f286(){return f287();}
+int f287(){return f288();}
+int f288(){return f289();}
+int f289(){return f290();}
+int f290(){return f291();}
+int f291(){return f292();}
+int f292(){return f293();}
+int f293(){return f294();}
+int f294(){return f295();}
+int f295(){return f296();}
+int f296(){return f297();}
+int f297(){return f298();}
+int f298(){return f299();}
+int f299(){return f300();}
+int f300(){return f301();}
+int f301(){return f302();}
+int f302(){return f303();}
+int f303(){return f304();}
+int f304(){return f305();}
+int f305(){return f306();}
+int f306(){return f307();}
+int f307(){return f308();}
+int f308(){return f309();}
+int f309(){return f310();}
+int f310(){return f311();}
+int f311(){return f312();}
+int f312(){return f313();}
+int f313(){return f314();}
+int f314(){return f315();}
+int f315(){return f316();}
+int f316(){return f317();}
+int f317(){return f318();}
+int f318(){return f319();}
+int f319(){return f320();}
+int f320(){return f321();}
+int f321(){return f322();}
+int f322(){return f323();}
+int f323(){return f324();}
+int f324(){return f325();}
+int f325(){return f326();}
+int f326(){return f327();}
+int f327(){return f328();}
+int f328(){return f329();}
+int f329(){return f330();}
+int f330(){return f331();}
+int f331(){return f332();}
+int f332(){return f333();}
+int f333(){return f334();}
+int f334(){return f335();}
+int f335(){return f336();}
+int f336(){return f337();}
+int f337(){return f338();}
+int f338(){return f339();}
+int f339(){return f340();}
+int f340(){return f341();}
+int f341(){return f342();}
+int f342(){return f343();}
+int f343(){return f344();}
+int f344(){return f345();}
+int f345(){return f346();}
+int f346(){return f347();}
+int f347(){return f348();}
+int f348(){return f349();}
+int f349(){return f350();}
+int f350(){return f351();}
+int f351(){return f352();}
+int f352(){return f353();}
+int f353(){return f354();}
+int f354(){return f355();}
+int f355(){return f356();}
+int f356(){return f357();}
+int f357(){return f358();}
+int f358(){return f359();}
+int f359(){return f360();}
+int f360(){return f361();}
+int f361(){return f362();}
+int f362(){return f363();}
+int f363(){return f364();}
+int f364(){return f365();}
+int f365(){return f366();}
+int f366(){return f367();}
+int f367(){return f368();}
+int f368(){return f369();}
+int f369(){return f370();}
+int f370(){return f371();}
+int f371(){return f372();}
+int f372(){return f373();}
+int f373(){return f374();}
+int f374(){return f375();}
+int f375(){return f376();}
+int f376(){return f377();}
+int f377(){return f378();}
+int f378(){return f379();}
+int f379(){return f380();}
+int f380(){return f381();}
+int f381(){return f382();}
+int f382(){return f383();}
+int f383(){return f384();}
+int f384(){return f385();}
+int f385(){return f386();}
+int f386(){return f387();}
+int f387(){return f388();}
+int f388(){return f389();}
+int f389(){return f390();}
+int f390(){return f391();}
+int f391(){return f392();}
+int f392(){return f393();}
+int f393(){return f394();}
+int f394(){return f395();}
+int f395(){return f396();}
+int f396(){return f397();}
+int f397(){return f398();}
+int f398(){return f399();}
+int f399(){return f400();}
+int f400(){return f401();}
+int f401(){return f402();}
+int f402(){return f403();}
+int f403(){return f404();}
+int f404(){return f405();}
+int f405(){return f406();}
+int f406(){return f407();}
+int f407(){return f408();}
+int f408(){return f409();}
+int f409(){return f410();}
+int f410(){return f411();}
+int f411(){return f412();}
+int f412(){return f413();}
+int f413(){return f414();}
+int f414(){return f415();}
+int f415(){return f416();}
+int f416(){return f417();}
+int f417(){return f418();}
+int f418(){return f419();}
+int f419(){return f420();}
+int f420(){return f421();}
+int f421(){return f422();}
+int f422(){return f423();}
+int f423(){return f424();}
+int f424(){return f425();}
+int f425(){return f426();}
+int f426(){return f427();}
+int f427(){return f428();}
+int f428(){return f429();}
+int f429(){return f430();}
+int f430(){return f431();}
+int f431(){return f432();}
+int f432(){return f433();}
+int f433(){return f434();}
+int f434(){return f435();}
+int f435(){return f436();}
+int f436(){return f437();}
+int f437(){return f438();}
+int f438(){return f439();}
+int f439(){return f440();}
+int f440(){return f441();}
+int f441(){return f442();}
+int f442(){return f443();}
+int f443(){return f444();}
+int f444(){return f445();}
+int f445(){return f446();}
+int f446(){return f447();}
+int f447(){return f448();}
+int f448(){return f449();}
+int f449(){return f450();}
+int f450(){return f451();}
+int f451(){return f452();}
+int f452(){return f453();}
+int f453(){return f454();}
+int f454(){return f455();}
+int f455(){return f456();}
+int f456(){return f457();}
+int f457(){return f458();}
+int f458(){return f459();}
+int f459(){return f460();}
+int f460(){return f461();}
+int f461(){return f462();}
+int f462(){return f463();}
+int f463(){return f464();}
+int f464(){return f465();}
+int f465(){return f466();}
+int f466(){return f467();}
+int f467(){return f468();}
+int f468(){return f469();}
+int f469(){return f470();}
+int f470(){return f471();}
+int f471(){return f472();}
+int f472(){return f473();}
+int f473(){return f474();}
+int f474(){return f475();}
+int f475(){return f476();}
+int f476(){return f477();}
+int f477(){return f478();}
+int f478(){return f479();}
+int f479(){return f480();}
+int f480(){return f481();}
+int f481(){return f482();}
+int f482(){return f483();}
+int f483(){return f484();}
+int f484(){return f485();}
+int f485(){return f486();}
+int f486(){return f487();}
+int f487(){return f488();}
+int f488(){return f489();}
+int f489(){return f490();}
+int f490(){return f491();}
+int f491(){return f492();}
+int f492(){return f493();}
+int f493(){return f494();}
+int f494(){return f495();}
+int f495(){return f496();}
+int f496(){return f497();}
+int f497(){return f498();}
+int f498(){return f499();}
+int f499(){return f500();}
+int f500(){return f501();}
+int f501(){return f502();}
+int f502(){return f503();}
+int f503(){return f504();}
+int f504(){return f505();}
+int f505(){return f506();}
+int f506(){return f507();}
+int f507(){return f508();}
+int f508(){return f509();}
+int f509(){return f510();}
+int f510(){return f511();}
+int f511(){return f512();}
+int f512(){return f513();}
+int f513(){return f514();}
+int f514(){return f515();}
+int f515(){return f516();}
+int f516(){return f517();}
+int f517(){return f518();}
+int f518(){return f519();}
+int f519(){return f520();}
+int f520(){return f521();}
+int f521(){return f522();}
+int f522(){return f523();}
+int f523(){return f524();}
+int f524(){return f525();}
+int f525(){return f526();}
+int f526(){return f527();}
+int f527(){return f528();}
+int f528(){return f529();}
+int f529(){return f530();}
+int f530(){return f531();}
+int f531(){return f532();}
+int f532(){return f533();}
+int f533(){return f534();}
+int f534(){return f535();}
+int f535(){return f536();}
+int f536(){return f537();}
+int f537(){return f538();}
+int f538(){return f539();}
+int f539(){return f540();}
+int f540(){return f541();}
+int f541(){return f542();}
+int f542(){return f543();}
+int f543(){return f544();}
+int f544(){return f545();}
+int f545(){return f546();}
+int f546(){return f547();}
+int f547(){return f548();}
+int f548(){return f549();}
+int f549(){return f550();}
+int f550(){return f551();}
+int f551(){return f552();}
+int f552(){return f553();}
+int f553(){return f554();}
+int f554(){return f555();}
+int f555(){return f556();}
+int f556(){return f557();}
+int f557(){return f558();}
+int f558(){return f559();}
+int f559(){return f560();}
+int f560(){return f561();}
+int f561(){return f562();}
+int f562(){return f563();}
+int f563(){return f564();}
+int f564(){return f565();}
+int f565(){return f566();}
+int f566(){return f567();}
+int f567(){return f568();}
+int f568(){return f569();}
+int f569(){return f570();}
+int f570(){return f571();}
+int f571(){return f572();}
+int f572(){return f573();}
+int f573(){return f574();}
+int f574(){return f575();}
+int f575(){return f576();}
+int f576(){return f577();}
+int f577(){return f578();}
+int f578(){return f579();}
+int f579(){return f580();}
+int f580(){return f581();}
+int f581(){return f582();}
+int f582(){return f583();}
+int f583(){return f584();}
+int f584(){return f585();}
+int f585(){return f586();}
+int f586(){return f587();}
+int f587(){return f588();}
+int f588(){return f589();}
+int f589(){return f590();}
+int f590(){return f591();}
+int f591(){return f592();}
+int f592(){return f593();}
+int f593(){return f594();}
+int f594(){return f595();}
+int f595(){return f596();}
+int f596(){return f597();}
+int f597(){return f598();}
+int f598(){return f599();}
+int f599(){return f600();}
+int f600(){return 1;}
+void main(){int a; a=f0();}
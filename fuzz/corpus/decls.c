@@ -0,0 +1,1001 @@
+int v0[4];
+int v1[4];
+int v2[4];
+int v3[4];
+int v4[4];
+int v5[4];
+int v6[4];
+int v7[4];
+int v8[4];
+int v9[4];
+int v10[4];
+int v11[4];
+int v12[4];
+int v13[4];
+int v14[4];
+int v15[4];
+int v16[4];
+int v17[4];
+int v18[4];
+int v19[4];
+int v20[4];
+int v21[4];
+int v22[4];
+int v23[4];
+int v24[4];
+int v25[4];
+int v26[4];
+int v27[4];
+int v28[4];
+int v29[4];
+int v30[4];
+int v31[4];
+int v32[4];
+int v33[4];
+int v34[4];
+int v35[4];
+int v36[4];
+int v37[4];
+int v38[4];
+int v39[4];
+int v40[4];
+int v41[4];
+int v42[4];
+int v43[4];
+int v44[4];
+int v45[4];
+int v46[4];
+int v47[4];
+int v48[4];
+int v49[4];
+int v50[4];
+int v51[4];
+int v52[4];
+int v53[4];
+int v54[4];
+int v55[4];
+int v56[4];
+int v57[4];
+int v58[4];
+int v59[4];
+int v60[4];
+int v61[4];
+int v62[4];
+int v63[4];
+int v64[4];
+int v65[4];
+int v66[4];
+int v67[4];
+int v68[4];
+int v69[4];
+int v70[4];
+int v71[4];
+int v72[4];
+int v73[4];
+int v74[4];
+int v75[4];
+int v76[4];
+int v77[4];
+int v78[4];
+int v79[4];
+int v80[4];
+int v81[4];
+int v82[4];
+int v83[4];
+int v84[4];
+int v85[4];
+int v86[4];
+int v87[4];
+int v88[4];
+int v89[4];
+int v90[4];
+int v91[4];
+int v92[4];
+int v93[4];
+int v94[4];
+int v95[4];
+int v96[4];
+int v97[4];
+int v98[4];
+int v99[4];
+int v100[4];
+int v101[4];
+int v102[4];
+int v103[4];
+int v104[4];
+int v105[4];
+int v106[4];
+int v107[4];
+int v108[4];
+int v109[4];
+int v110[4];
+int v111[4];
+int v112[4];
+int v113[4];
+int v114[4];
+int v115[4];
+int v116[4];
+int v117[4];
+int v118[4];
+int v119[4];
+int v120[4];
+int v121[4];
+int v122[4];
+int v123[4];
+int v124[4];
+int v125[4];
+int v126[4];
+int v127[4];
+int v128[4];
+int v129[4];
+int v130[4];
+int v131[4];
+int v132[4];
+int v133[4];
+int v134[4];
+int v135[4];
+int v136[4];
+int v137[4];
+int v138[4];
+int v139[4];
+int v140[4];
+int v141[4];
+int v142[4];
+int v143[4];
+int v144[4];
+int v145[4];
+int v146[4];
+int v147[4];
+int v148[4];
+int v149[4];
+int v150[4];
+int v151[4];
+int v152[4];
+int v153[4];
+int v154[4];
+int v155[4];
+int v156[4];
+int v157[4];
+int v158[4];
+int v159[4];
+int v160[4];
+int v161[4];
+int v162[4];
+int v163[4];
+int v164[4];
+int v165[4];
+int v166[4];
+int v167[4];
+int v168[4];
+int v169[4];
+int v170[4];
+int v171[4];
+int v172[4];
+int v173[4];
+int v174[4];
+int v175[4];
+int v176[4];
+int v177[4];
+int v178[4];
+int v179[4];
+int v180[4];
+int v181[4];
+int v182[4];
+int v183[4];
+int v184[4];
+int v185[4];
+int v186[4];
+int v187[4];
+int v188[4];
+int v189[4];
+int v190[4];
+int v191[4];
+int v192[4];
+int v193[4];
+int v194[4];
+int v195[4];
+int v196[4];
+int v197[4];
+int v198[4];
+int v199[4];
+int v200[4];
+int v201[4];
+int v202[4];
+int v203[4];
+int v204[4];
+int v205[4];
+int v206[4];
+int v207[4];
+int v208[4];
+int v209[4];
+int v210[4];
+int v211[4];
+int v212[4];
+int v213[4];
+int v214[4];
+int v215[4];
+int v216[4];
+int v217[4];
+int v218[4];
+int v219[4];
+int v220[4];
+int v221[4];
+int v222[4];
+int v223[4];
+int v224[4];
+int v225[4];
+int v226[4];
+int v227[4];
+int v228[4];
+int v229[4];
+int v230[4];
+int v231[4];
+int v232[4];
+int v233[4];
+int v234[4];
+int v235[4];
+int v236[4];
+int v237[4];
+int v238[4];
+int v239[4];
+int v240[4];
+int v241[4];
+int v242[4];
+int v243[4];
+int v244[4];
+int v245[4];
+int v246[4];
+int v247[4];
+int v248[4];
+int v249[4];
+int v250[4];
+int v251[4];
+int v252[4];
+int v253[4];
+int v254[4];
+int v255[4];
+int v256[4];
+int v257[4];
+int v258[4];
+int v259[4];
+int v260[4];
+int v261[4];
+int v262[4];
+int v263[4];
+int v264[4];
+int v265[4];
+int v266[4];
+int v267[4];
+int v268[4];
+int v269[4];
+int v270[4];
+int v271[4];
+int v272[4];
+int v273[4];
+int v274[4];
+int v275[4];
+int v276[4];
+int v277[4];
+int v278[4];
+int v279[4];
+int v280[4];
+int v281[4];
+int v282[4];
+int v283[4];
+int v284[4];
+int v285[4];
+int v286[4];
+int v287[4];
+int v288[4];
+int v289[4];
+int v290[4];
+int v291[4];
+int v292[4];
+int v293[4];
+int v294[4];
+int v295[4];
+int v296[4];
+int v297[4];
+int v298[4];
+int v299[4];
+int v300[4];
+int v301[4];
+int v302[4];
+int v303[4];
+int v304[4];
+int v305[4];
+int v306[4];
+int v307[4];
+int v308[4];
+int v309[4];
+int v310[4];
+int v311[4];
+int v312[4];
+int v313[4];
+int v314[4];
+int v315[4];
+int v316[4];
+int v317[4];
+int v318[4];
+int v319[4];
+int v320[4];
+int v321[4];
+int v322[4];
+int v323[4];
+int v324[4];
+int v325[4];
+int v326[4];
+int v327[4];
+int v328[4];
+int v329[4];
+int v330[4];
+int v331[4];
+int v332[4];
+int v333[4];
+int v334[4];
+int v335[4];
+int v336[4];
+int v337[4];
+int v338[4];
+int v339[4];
+int v340[4];
+int v341[4];
+int v342[4];
+int v343[4];
+int v344[4];
+int v345[4];
+int v346[4];
+int v347[4];
+int v348[4];
+int v349[4];
+int v350[4];
+int v351[4];
+int v352[4];
+int v353[4];
+int v354[4];
+int v355[4];
+int v356[4];
+int v357[4];
+int v358[4];
+int v359[4];
+int v360[4];
+int v361[4];
+int v362[4];
+int v363[4];
+int v364[4];
+int v365[4];
+int v366[4];
+int v367[4];
+int v368[4];
+int v369[4];
+int v370[4];
+int v371[4];
+int v372[4];
+int v373[4];
+int v374[4];
+int v375[4];
+int v376[4];
+int v377[4];
+int v378[4];
+int v379[4];
+int v380[4];
+int v381[4];
+int v382[4];
+int v383[4];
+int v384[4];
+int v385[4];
+int v386[4];
+int v387[4];
+int v388[4];
+int v389[4];
+int v390[4];
+int v391[4];
+int v392[4];
+int v393[4];
+int v394[4];
+int v395[4];
+int v396[4];
+int v397[4];
+int v398[4];
+int v399[4];
+int v400[4];
+int v401[4];
+int v402[4];
+int v403[4];
+int v404[4];
+int v405[4];
+int v406[4];
+int v407[4];
+int v408[4];
+int v409[4];
+int v410[4];
+int v411[4];
+int v412[4];
+int v413[4];
+int v414[4];
+int v415[4];
+int v416[4];
+int v417[4];
+int v418[4];
+int v419[4];
+int v420[4];
+int v421[4];
+int v422[4];
+int v423[4];
+int v424[4];
+int v425[4];
+int v426[4];
+int v427[4];
+int v428[4];
+int v429[4];
+int v430[4];
+int v431[4];
+int v432[4];
+int v433[4];
+int v434[4];
+int v435[4];
+int v436[4];
+int v437[4];
+int v438[4];
+int v439[4];
+int v440[4];
+int v441[4];
+int v442[4];
+int v443[4];
+int v444[4];
+int v445[4];
+int v446[4];
+int v447[4];
+int v448[4];
+int v449[4];
+int v450[4];
+int v451[4];
+int v452[4];
+int v453[4];
+int v454[4];
+int v455[4];
+int v456[4];
+int v457[4];
+int v458[4];
+int v459[4];
+int v460[4];
+int v461[4];
+int v462[4];
+int v463[4];
+int v464[4];
+int v465[4];
+int v466[4];
+int v467[4];
+int v468[4];
+int v469[4];
+int v470[4];
+int v471[4];
+int v472[4];
+int v473[4];
+int v474[4];
+int v475[4];
+int v476[4];
+int v477[4];
+int v478[4];
+int v479[4];
+int v480[4];
+int v481[4];
+int v482[4];
+int v483[4];
+int v484[4];
+int v485[4];
+int v486[4];
+int v487[4];
+int v488[4];
+int v489[4];
+int v490[4];
+int v491[4];
+int v492[4];
+int v493[4];
+int v494[4];
+int v495[4];
+int v496[4];
+int v497[4];
+int v498[4];
+int v499[4];
+int v500[4];
+int v501[4];
+int v502[4];
+int v503[4];
+int v504[4];
+int v505[4];
+int v506[4];
+int v507[4];
+int v508[4];
+int v509[4];
+int v510[4];
+int v511[4];
+int v512[4];
+int v513[4];
+int v514[4];
+int v515[4];
+int v516[4];
+int v517[4];
+int v518[4];
+int v519[4];
+int v520[4];
+int v521[4];
+int v522[4];
+int v523[4];
+int v524[4];
+int v525[4];
+int v526[4];
+int v527[4];
+int v528[4];
+int v529[4];
+int v530[4];
+int v531[4];
+int v532[4];
+int v533[4];
+int v534[4];
+int v535[4];
+int v536[4];
+int v537[4];
+int v538[4];
+int v539[4];
+int v540[4];
+int v541[4];
+int v542[4];
+int v543[4];
+int v544[4];
+int v545[4];
+int v546[4];
+int v547[4];
+int v548[4];
+int v549[4];
+int v550[4];
+int v551[4];
+int v552[4];
+int v553[4];
+int v554[4];
+int v555[4];
+int v556[4];
+int v557[4];
+int v558[4];
+int v559[4];
+int v560[4];
+int v561[4];
+int v562[4];
+int v563[4];
+int v564[4];
+int v565[4];
+int v566[4];
+int v567[4];
+int v568[4];
+int v569[4];
+int v570[4];
+int v571[4];
+int v572[4];
+int v573[4];
+int v574[4];
+int v575[4];
+int v576[4];
+int v577[4];
+int v578[4];
+int v579[4];
+int v580[4];
+int v581[4];
+int v582[4];
+int v583[4];
+int v584[4];
+int v585[4];
+int v586[4];
+int v587[4];
+int v588[4];
+int v589[4];
+int v590[4];
+int v591[4];
+int v592[4];
+int v593[4];
+int v594[4];
+int v595[4];
+int v596[4];
+int v597[4];
+int v598[4];
+int v599[4];
+int v600[4];
+int v601[4];
+int v602[4];
+int v603[4];
+int v604[4];
+int v605[4];
+int v606[4];
+int v607[4];
+int v608[4];
+int v609[4];
+int v610[4];
+int v611[4];
+int v612[4];
+int v613[4];
+int v614[4];
+int v615[4];
+int v616[4];
+int v617[4];
+int v618[4];
+int v619[4];
+int v620[4];
+int v621[4];
+int v622[4];
+int v623[4];
+int v624[4];
+int v625[4];
+int v626[4];
+int v627[4];
+int v628[4];
+int v629[4];
+int v630[4];
+int v631[4];
+int v632[4];
+int v633[4];
+int v634[4];
+int v635[4];
+int v636[4];
+int v637[4];
+int v638[4];
+int v639[4];
+int v640[4];
+int v641[4];
+int v642[4];
+int v643[4];
+int v644[4];
+int v645[4];
+int v646[4];
+int v647[4];
+int v648[4];
+int v649[4];
+int v650[4];
+int v651[4];
+int v652[4];
+int v653[4];
+int v654[4];
+int v655[4];
+int v656[4];
+int v657[4];
+int v658[4];
+int v659[4];
+int v660[4];
+int v661[4];
+int v662[4];
+int v663[4];
+int v664[4];
+int v665[4];
+int v666[4];
+int v667[4];
+int v668[4];
+int v669[4];
+int v670[4];
+int v671[4];
+int v672[4];
+int v673[4];
+int v674[4];
+int v675[4];
+int v676[4];
+int v677[4];
+int v678[4];
+int v679[4];
+int v680[4];
+int v681[4];
+int v682[4];
+int v683[4];
+int v684[4];
+int v685[4];
+int v686[4];
+int v687[4];
+int v688[4];
+int v689[4];
+int v690[4];
+int v691[4];
+int v692[4];
+int v693[4];
+int v694[4];
+int v695[4];
+int v696[4];
+int v697[4];
+int v698[4];
+int v699[4];
+int v700[4];
+int v701[4];
+int v702[4];
+int v703[4];
+int v704[4];
+int v705[4];
+int v706[4];
+int v707[4];
+int v708[4];
+int v709[4];
+int v710[4];
+int v711[4];
+int v712[4];
+int v713[4];
+int v714[4];
+int v715[4];
+int v716[4];
+int v717[4];
+int v718[4];
+int v719[4];
+int v720[4];
+int v721[4];
+int v722[4];
+int v723[4];
+int v724[4];
+int v725[4];
+int v726[4];
+int v727[4];
+int v728[4];
+int v729[4];
+int v730[4];
+int v731[4];
+int v732[4];
+int v733[4];
+int v734[4];
+int v735[4];
+int v736[4];
+int v737[4];
+int v738[4];
+int v739[4];
+int v740[4];
+int v741[4];
+int v742[4];
+int v743[4];
+int v744[4];
+int v745[4];
+int v746[4];
+int v747[4];
+int v748[4];
+int v749[4];
+int v750[4];
+int v751[4];
+int v752[4];
+int v753[4];
+int v754[4];
+int v755[4];
+int v756[4];
+int v757[4];
+int v758[4];
+int v759[4];
+int v760[4];
+int v761[4];
+int v762[4];
+int v763[4];
+int v764[4];
+int v765[4];
+int v766[4];
+int v767[4];
+int v768[4];
+int v769[4];
+int v770[4];
+int v771[4];
+int v772[4];
+int v773[4];
+int v774[4];
+int v775[4];
+int v776[4];
+int v777[4];
+int v778[4];
+int v779[4];
+int v780[4];
+int v781[4];
+int v782[4];
+int v783[4];
+int v784[4];
+int v785[4];
+int v786[4];
+int v787[4];
+int v788[4];
+int v789[4];
+int v790[4];
+int v791[4];
+int v792[4];
+int v793[4];
+int v794[4];
+int v795[4];
+int v796[4];
+int v797[4];
+int v798[4];
+int v799[4];
+int v800[4];
+int v801[4];
+int v802[4];
+int v803[4];
+int v804[4];
+int v805[4];
+int v806[4];
+int v807[4];
+int v808[4];
+int v809[4];
+int v810[4];
+int v811[4];
+int v812[4];
+int v813[4];
+int v814[4];
+int v815[4];
+int v816[4];
+int v817[4];
+int v818[4];
+int v819[4];
+int v820[4];
+int v821[4];
+int v822[4];
+int v823[4];
+int v824[4];
+int v825[4];
+int v826[4];
+int v827[4];
+int v828[4];
+int v829[4];
+int v830[4];
+int v831[4];
+int v832[4];
+int v833[4];
+int v834[4];
+int v835[4];
+int v836[4];
+int v837[4];
+int v838[4];
+int v839[4];
+int v840[4];
+int v841[4];
+int v842[4];
+int v843[4];
+int v844[4];
+int v845[4];
+int v846[4];
+int v847[4];
+int v848[4];
+int v849[4];
+int v850[4];
+int v851[4];
+int v852[4];
+int v853[4];
+int v854[4];
+int v855[4];
+int v856[4];
+int v857[4];
+int v858[4];
+int v859[4];
+int v860[4];
+int v861[4];
+int v862[4];
+int v863[4];
+int v864[4];
+int v865[4];
+int v866[4];
+int v867[4];
+int v868[4];
+int v869[4];
+int v870[4];
+int v871[4];
+int v872[4];
+int v873[4];
+int v874[4];
+int v875[4];
+int v876[4];
+int v877[4];
+int v878[4];
+int v879[4];
+int v880[4];
+int v881[4];
+int v882[4];
+int v883[4];
+int v884[4];
+int v885[4];
+int v886[4];
+int v887[4];
+int v888[4];
+int v889[4];
+int v890[4];
+int v891[4];
+int v892[4];
+int v893[4];
+int v894[4];
+int v895[4];
+int v896[4];
+int v897[4];
+int v898[4];
+int v899[4];
+int v900[4];
+int v901[4];
+int v902[4];
+int v903[4];
+int v904[4];
+int v905[4];
+int v906[4];
+int v907[4];
+int v908[4];
+int v909[4];
+int v910[4];
+int v911[4];
+int v912[4];
+int v913[4];
+int v914[4];
+int v915[4];
+int v916[4];
+int v917[4];
+int v918[4];
+int v919[4];
+int v920[4];
+int v921[4];
+int v922[4];
+int v923[4];
+int v924[4];
+int v925[4];
+int v926[4];
+int v927[4];
+int v928[4];
+int v929[4];
+int v930[4];
+int v931[4];
+int v932[4];
+int v933[4];
+int v934[4];
+int v935[4];
+int v936[4];
+int v937[4];
+int v938[4];
+int v939[4];
+int v940[4];
+int v941[4];
+int v942[4];
+int v943[4];
+int v944[4];
+int v945[4];
+int v946[4];
+int v947[4];
+int v948[4];
+int v949[4];
+int v950[4];
+int v951[4];
+int v952[4];
+int v953[4];
+int v954[4];
+int v955[4];
+int v956[4];
+int v957[4];
+int v958[4];
+int v959[4];
+int v960[4];
+int v961[4];
+int v962[4];
+int v963[4];
+int v964[4];
+int v965[4];
+int v966[4];
+int v967[4];
+int v968[4];
+int v969[4];
+int v970[4];
+int v971[4];
+int v972[4];
+int v973[4];
+int v974[4];
+int v975[4];
+int v976[4];
+int v977[4];
+int v978[4];
+int v979[4];
+int v980[4];
+int v981[4];
+int v982[4];
+int v983[4];
+int v984[4];
+int v985[4];
+int v986[4];
+int v987[4];
+int v988[4];
+int v989[4];
+int v990[4];
+int v991[4];
+int v992[4];
+int v993[4];
+int v994[4];
+int v995[4];
+int v996[4];
+int v997[4];
+int v998[4];
+int v999[4];
+void main(){v0[3]=1;v1[3]=1;v2[3]=1;v3[3]=1;v4[3]=1;v5[3]=1;v6[3]=1;v7[3]=1;v8[3]=1;v9[3]=1;v10[3]=1;v11[3]=1;v12[3]=1;v13[3]=1;v14[3]=1;v15[3]=1;v16[3]=1;v17[3]=1;v18[3]=1;v19[3]=1;v20[3]=1;v21[3]=1;v22[3]=1;v23[3]=1;v24[3]=1;v25[3]=1;v26[3]=1;v27[3]=1;v28[3]=1;v29[3]=1;v30[3]=1;v31[3]=1;v32[3]=1;v33[3]=1;v34[3]=1;v35[3]=1;v36[3]=1;v37[3]=1;v38[3]=1;v39[3]=1;v40[3]=1;v41[3]=1;v42[3]=1;v43[3]=1;v44[3]=1;v45[3]=1;v46[3]=1;v47[3]=1;v48[3]=1;v49[3]=1;v50[3]=1;v51[3]=1;v52[3]=1;v53[3]=1;v54[3]=1;v55[3]=1;v56[3]=1;v57[3]=1;v58[3]=1;v59[3]=1;v60[3]=1;v61[3]=1;v62[3]=1;v63[3]=1;v64[3]=1;v65[3]=1;v66[3]=1;v67[3]=1;v68[3]=1;v69[3]=1;v70[3]=1;v71[3]=1;v72[3]=1;v73[3]=1;v74[3]=1;v75[3]=1;v76[3]=1;v77[3]=1;v78[3]=1;v79[3]=1;v80[3]=1;v81[3]=1;v82[3]=1;v83[3]=1;v84[3]=1;v85[3]=1;v86[3]=1;v87[3]=1;v88[3]=1;v89[3]=1;v90[3]=1;v91[3]=1;v92[3]=1;v93[3]=1;v94[3]=1;v95[3]=1;v96[3]=1;v97[3]=1;v98[3]=1;v99[3]=1;v100[3]=1;v101[3]=1;v102[3]=1;v103[3]=1;v104[3]=1;v105[3]=1;v106[3]=1;v107[3]=1;v108[3]=1;v109[3]=1;v110[3]=1;v111[3]=1;v112[3]=1;v113[3]=1;v114[3]=1;v115[3]=1;v116[3]=1;v117[3]=1;v118[3]=1;v119[3]=1;v120[3]=1;v121[3]=1;v122[3]=1;v123[3]=1;v124[3]=1;v125[3]=1;v126[3]=1;v127[3]=1;v128[3]=1;v129[3]=1;v130[3]=1;v131[3]=1;v132[3]=1;v133[3]=1;v134[3]=1;v135[3]=1;v136[3]=1;v137[3]=1;v138[3]=1;v139[3]=1;v140[3]=1;v141[3]=1;v142[3]=1;v143[3]=1;v144[3]=1;v145[3]=1;v146[3]=1;v147[3]=1;v148[3]=1;v149[3]=1;v150[3]=1;v151[3]=1;v152[3]=1;v153[3]=1;v154[3]=1;v155[3]=1;v156[3]=1;v157[3]=1;v158[3]=1;v159[3]=1;v160[3]=1;v161[3]=1;v162[3]=1;v163[3]=1;v164[3]=1;v165[3]=1;v166[3]=1;v167[3]=1;v168[3]=1;v169[3]=1;v170[3]=1;v171[3]=1;v172[3]=1;v173[3]=1;v174[3]=1;v175[3]=1;v176[3]=1;v177[3]=1;v178[3]=1;v179[3]=1;v180[3]=1;v181[3]=1;v182[3]=1;v183[3]=1;v184[3]=1;v185[3]=1;v186[3]=1;v187[3]=1;v188[3]=1;v189[3]=1;v190[3]=1;v191[3]=1;v192[3]=1;v193[3]=1;v194[3]=1;v195[3]=1;v196[3]=1;v197[3]=1;v198[3]=1;v199[3]=1;v200[3]=1;v201[3]=1;v202[3]=1;v203[3]=1;v204[3]=1;v205[3]=1;v206[3]=1;v207[3]=1;v208[3]=1;v209[3]=1;v210[3]=1;v211[3]=1;v212[3]=1;v213[3]=1;v214[3]=1;v215[3]=1;v216[3]=1;v217[3]=1;v218[3]=1;v219[3]=1;v220[3]=1;v221[3]=1;v222[3]=1;v223[3]=1;v224[3]=1;v225[3]=1;v226[3]=1;v227[3]=1;v228[3]=1;v229[3]=1;v230[3]=1;v231[3]=1;v232[3]=1;v233[3]=1;v234[3]=1;v235[3]=1;v236[3]=1;v237[3]=1;v238[3]=1;v239[3]=1;v240[3]=1;v241[3]=1;v242[3]=1;v243[3]=1;v244[3]=1;v245[3]=1;v246[3]=1;v247[3]=1;v248[3]=1;v249[3]=1;v250[3]=1;v251[3]=1;v252[3]=1;v253[3]=1;v254[3]=1;v255[3]=1;v256[3]=1;v257[3]=1;v258[3]=1;v259[3]=1;v260[3]=1;v261[3]=1;v262[3]=1;v263[3]=1;v264[3]=1;v265[3]=1;v266[3]=1;v267[3]=1;v268[3]=1;v269[3]=1;v270[3]=1;v271[3]=1;v272[3]=1;v273[3]=1;v274[3]=1;v275[3]=1;v276[3]=1;v277[3]=1;v278[3]=1;v279[3]=1;v280[3]=1;v281[3]=1;v282[3]=1;v283[3]=1;v284[3]=1;v285[3]=1;v286[3]=1;v287[3]=1;v288[3]=1;v289[3]=1;v290[3]=1;v291[3]=1;v292[3]=1;v293[3]=1;v294[3]=1;v295[3]=1;v296[3]=1;v297[3]=1;v298[3]=1;v299[3]=1;v300[3]=1;v301[3]=1;v302[3]=1;v303[3]=1;v304[3]=1;v305[3]=1;v306[3]=1;v307[3]=1;v308[3]=1;v309[3]=1;v310[3]=1;v311[3]=1;v312[3]=1;v313[3]=1;v314[3]=1;v315[3]=1;v316[3]=1;v317[3]=1;v318[3]=1;v319[3]=1;v320[3]=1;v321[3]=1;v322[3]=1;v323[3]=1;v324[3]=1;v325[3]=1;v326[3]=1;v327[3]=1;v328[3]=1;v329[3]=1;v330[3]=1;v331[3]=1;v332[3]=1;v333[3]=1;v334[3]=1;v335[3]=1;v336[3]=1;v337[3]=1;v338[3]=1;v339[3]=1;v340[3]=1;v341[3]=1;v342[3]=1;v343[3]=1;v344[3]=1;v345[3]=1;v346[3]=1;v347[3]=1;v348[3]=1;v349[3]=1;v350[3]=1;v351[3]=1;v352[3]=1;v353[3]=1;v354[3]=1;v355[3]=1;v356[3]=1;v357[3]=1;v358[3]=1;v359[3]=1;v360[3]=1;v361[3]=1;v362[3]=1;v363[3]=1;v364[3]=1;v365[3]=1;v366[3]=1;v367[3]=1;v368[3]=1;v369[3]=1;v370[3]=1;v371[3]=1;v372[3]=1;v373[3]=1;v374[3]=1;v375[3]=1;v376[3]=1;v377[3]=1;v378[3]=1;v379[3]=1;v380[3]=1;v381[3]=1;v382[3]=1;v383[3]=1;v384[3]=1;v385[3]=1;v386[3]=1;v387[3]=1;v388[3]=1;v389[3]=1;v390[3]=1;v391[3]=1;v392[3]=1;v393[3]=1;v394[3]=1;v395[3]=1;v396[3]=1;v397[3]=1;v398[3]=1;v399[3]=1;v400[3]=1;v401[3]=1;v402[3]=1;v403[3]=1;v404[3]=1;v405[3]=1;v406[3]=1;v407[3]=1;v408[3]=1;v409[3]=1;v410[3]=1;v411[3]=1;v412[3]=1;v413[3]=1;v414[3]=1;v415[3]=1;v416[3]=1;v417[3]=1;v418[3]=1;v419[3]=1;v420[3]=1;v421[3]=1;v422[3]=1;v423[3]=1;v424[3]=1;v425[3]=1;v426[3]=1;v427[3]=1;v428[3]=1;v429[3]=1;v430[3]=1;v431[3]=1;v432[3]=1;v433[3]=1;v434[3]=1;v435[3]=1;v436[3]=1;v437[3]=1;v438[3]=1;v439[3]=1;v440[3]=1;v441[3]=1;v442[3]=1;v443[3]=1;v444[3]=1;v445[3]=1;v446[3]=1;v447[3]=1;v448[3]=1;v449[3]=1;v450[3]=1;v451[3]=1;v452[3]=1;v453[3]=1;v454[3]=1;v455[3]=1;v456[3]=1;v457[3]=1;v458[3]=1;v459[3]=1;v460[3]=1;v461[3]=1;v462[3]=1;v463[3]=1;v464[3]=1;v465[3]=1;v466[3]=1;v467[3]=1;v468[3]=1;v469[3]=1;v470[3]=1;v471[3]=1;v472[3]=1;v473[3]=1;v474[3]=1;v475[3]=1;v476[3]=1;v477[3]=1;v478[3]=1;v479[3]=1;v480[3]=1;v481[3]=1;v482[3]=1;v483[3]=1;v484[3]=1;v485[3]=1;v486[3]=1;v487[3]=1;v488[3]=1;v489[3]=1;v490[3]=1;v491[3]=1;v492[3]=1;v493[3]=1;v494[3]=1;v495[3]=1;v496[3]=1;v497[3]=1;v498[3]=1;v499[3]=1;v500[3]=1;v501[3]=1;v502[3]=1;v503[3]=1;v504[3]=1;v505[3]=1;v506[3]=1;v507[3]=1;v508[3]=1;v509[3]=1;v510[3]=1;v511[3]=1;v512[3]=1;v513[3]=1;v514[3]=1;v515[3]=1;v516[3]=1;v517[3]=1;v518[3]=1;v519[3]=1;v520[3]=1;v521[3]=1;v522[3]=1;v523[3]=1;v524[3]=1;v525[3]=1;v526[3]=1;v527[3]=1;v528[3]=1;v529[3]=1;v530[3]=1;v531[3]=1;v532[3]=1;v533[3]=1;v534[3]=1;v535[3]=1;v536[3]=1;v537[3]=1;v538[3]=1;v539[3]=1;v540[3]=1;v541[3]=1;v542[3]=1;v543[3]=1;v544[3]=1;v545[3]=1;v546[3]=1;v547[3]=1;v548[3]=1;v549[3]=1;v550[3]=1;v551[3]=1;v552[3]=1;v553[3]=1;v554[3]=1;v555[3]=1;v556[3]=1;v557[3]=1;v558[3]=1;v559[3]=1;v560[3]=1;v561[3]=1;v562[3]=1;v563[3]=1;v564[3]=1;v565[3]=1;v566[3]=1;v567[3]=1;v568[3]=1;v569[3]=1;v570[3]=1;v571[3]=1;v572[3]=1;v573[3]=1;v574[3]=1;v575[3]=1;v576[3]=1;v577[3]=1;v578[3]=1;v579[3]=1;v580[3]=1;v581[3]=1;v582[3]=1;v583[3]=1;v584[3]=1;v585[3]=1;v586[3]=1;v587[3]=1;v588[3]=1;v589[3]=1;v590[3]=1;v591[3]=1;v592[3]=1;v593[3]=1;v594[3]=1;v595[3]=1;v596[3]=1;v597[3]=1;v598[3]=1;v599[3]=1;v600[3]=1;v601[3]=1;v602[3]=1;v603[3]=1;v604[3]=1;v605[3]=1;v606[3]=1;v607[3]=1;v608[3]=1;v609[3]=1;v610[3]=1;v611[3]=1;v612[3]=1;v613[3]=1;v614[3]=1;v615[3]=1;v616[3]=1;v617[3]=1;v618[3]=1;v619[3]=1;v620[3]=1;v621[3]=1;v622[3]=1;v623[3]=1;v624[3]=1;v625[3]=1;v626[3]=1;v627[3]=1;v628[3]=1;v629[3]=1;v630[3]=1;v631[3]=1;v632[3]=1;v633[3]=1;v634[3]=1;v635[3]=1;v636[3]=1;v637[3]=1;v638[3]=1;v639[3]=1;v640[3]=1;v641[3]=1;v642[3]=1;v643[3]=1;v644[3]=1;v645[3]=1;v646[3]=1;v647[3]=1;v648[3]=1;v649[3]=1;v650[3]=1;v651[3]=1;v652[3]=1;v653[3]=1;v654[3]=1;v655[3]=1;v656[3]=1;v657[3]=1;v658[3]=1;v659[3]=1;v660[3]=1;v661[3]=1;v662[3]=1;v663[3]=1;v664[3]=1;v665[3]=1;v666[3]=1;v667[3]=1;v668[3]=1;v669[3]=1;v670[3]=1;v671[3]=1;v672[3]=1;v673[3]=1;v674[3]=1;v675[3]=1;v676[3]=1;v677[3]=1;v678[3]=1;v679[3]=1;v680[3]=1;v681[3]=1;v682[3]=1;v683[3]=1;v684[3]=1;v685[3]=1;v686[3]=1;v687[3]=1;v688[3]=1;v689[3]=1;v690[3]=1;v691[3]=1;v692[3]=1;v693[3]=1;v694[3]=1;v695[3]=1;v696[3]=1;v697[3]=1;v698[3]=1;v699[3]=1;v700[3]=1;v701[3]=1;v702[3]=1;v703[3]=1;v704[3]=1;v705[3]=1;v706[3]=1;v707[3]=1;v708[3]=1;v709[3]=1;v710[3]=1;v711[3]=1;v712[3]=1;v713[3]=1;v714[3]=1;v715[3]=1;v716[3]=1;v717[3]=1;v718[3]=1;v719[3]=1;v720[3]=1;v721[3]=1;v722[3]=1;v723[3]=1;v724[3]=1;v725[3]=1;v726[3]=1;v727[3]=1;v728[3]=1;v729[3]=1;v730[3]=1;v731[3]=1;v732[3]=1;v733[3]=1;v734[3]=1;v735[3]=1;v736[3]=1;v737[3]=1;v738[3]=1;v739[3]=1;v740[3]=1;v741[3]=1;v742[3]=1;v743[3]=1;v744[3]=1;v745[3]=1;v746[3]=1;v747[3]=1;v748[3]=1;v749[3]=1;v750[3]=1;v751[3]=1;v752[3]=1;v753[3]=1;v754[3]=1;v755[3]=1;v756[3]=1;v757[3]=1;v758[3]=1;v759[3]=1;v760[3]=1;v761[3]=1;v762[3]=1;v763[3]=1;v764[3]=1;v765[3]=1;v766[3]=1;v767[3]=1;v768[3]=1;v769[3]=1;v770[3]=1;v771[3]=1;v772[3]=1;v773[3]=1;v774[3]=1;v775[3]=1;v776[3]=1;v777[3]=1;v778[3]=1;v779[3]=1;v780[3]=1;v781[3]=1;v782[3]=1;v783[3]=1;v784[3]=1;v785[3]=1;v786[3]=1;v787[3]=1;v788[3]=1;v789[3]=1;v790[3]=1;v791[3]=1;v792[3]=1;v793[3]=1;v794[3]=1;v795[3]=1;v796[3]=1;v797[3]=1;v798[3]=1;v799[3]=1;v800[3]=1;v801[3]=1;v802[3]=1;v803[3]=1;v804[3]=1;v805[3]=1;v806[3]=1;v807[3]=1;v808[3]=1;v809[3]=1;v810[3]=1;v811[3]=1;v812[3]=1;v813[3]=1;v814[3]=1;v815[3]=1;v816[3]=1;v817[3]=1;v818[3]=1;v819[3]=1;v820[3]=1;v821[3]=1;v822[3]=1;v823[3]=1;v824[3]=1;v825[3]=1;v826[3]=1;v827[3]=1;v828[3]=1;v829[3]=1;v830[3]=1;v831[3]=1;v832[3]=1;v833[3]=1;v834[3]=1;v835[3]=1;v836[3]=1;v837[3]=1;v838[3]=1;v839[3]=1;v840[3]=1;v841[3]=1;v842[3]=1;v843[3]=1;v844[3]=1;v845[3]=1;v846[3]=1;v847[3]=1;v848[3]=1;v849[3]=1;v850[3]=1;v851[3]=1;v852[3]=1;v853[3]=1;v854[3]=1;v855[3]=1;v856[3]=1;v857[3]=1;v858[3]=1;v859[3]=1;v860[3]=1;v861[3]=1;v862[3]=1;v863[3]=1;v864[3]=1;v865[3]=1;v866[3]=1;v867[3]=1;v868[3]=1;v869[3]=1;v870[3]=1;v871[3]=1;v872[3]=1;v873[3]=1;v874[3]=1;v875[3]=1;v876[3]=1;v877[3]=1;v878[3]=1;v879[3]=1;v880[3]=1;v881[3]=1;v882[3]=1;v883[3]=1;v884[3]=1;v885[3]=1;v886[3]=1;v887[3]=1;v888[3]=1;v889[3]=1;v890[3]=1;v891[3]=1;v892[3]=1;v893[3]=1;v894[3]=1;v895[3]=1;v896[3]=1;v897[3]=1;v898[3]=1;v899[3]=1;v900[3]=1;v901[3]=1;v902[3]=1;v903[3]=1;v904[3]=1;v905[3]=1;v906[3]=1;v907[3]=1;v908[3]=1;v909[3]=1;v910[3]=1;v911[3]=1;v912[3]=1;v913[3]=1;v914[3]=1;v915[3]=1;v916[3]=1;v917[3]=1;v918[3]=1;v919[3]=1;v920[3]=1;v921[3]=1;v922[3]=1;v923[3]=1;v924[3]=1;v925[3]=1;v926[3]=1;v927[3]=1;v928[3]=1;v929[3]=1;v930[3]=1;v931[3]=1;v932[3]=1;v933[3]=1;v934[3]=1;v935[3]=1;v936[3]=1;v937[3]=1;v938[3]=1;v939[3]=1;v940[3]=1;v941[3]=1;v942[3]=1;v943[3]=1;v944[3]=1;v945[3]=1;v946[3]=1;v947[3]=1;v948[3]=1;v949[3]=1;v950[3]=1;v951[3]=1;v952[3]=1;v953[3]=1;v954[3]=1;v955[3]=1;v956[3]=1;v957[3]=1;v958[3]=1;v959[3]=1;v960[3]=1;v961[3]=1;v962[3]=1;v963[3]=1;v964[3]=1;v965[3]=1;v966[3]=1;v967[3]=1;v968[3]=1;v969[3]=1;v970[3]=1;v971[3]=1;v972[3]=1;v973[3]=1;v974[3]=1;v975[3]=1;v976[3]=1;v977[3]=1;v978[3]=1;v979[3]=1;v980[3]=1;v981[3]=1;v982[3]=1;v983[3]=1;v984[3]=1;v985[3]=1;v986[3]=1;v987[3]=1;v988[3]=1;v989[3]=1;v990[3]=1;v991[3]=1;v992[3]=1;v993[3]=1;v994[3]=1;v995[3]=1;v996[3]=1;v997[3]=1;v998[3]=1;v999[3]=1;}
@@ -0,0 +1,2 @@
+int f(int n){int s=0,i; for(i=0;i<n;i++) s=s+i; return s;}
+void main(){int a;a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);a=f(1000000);}
@@ -0,0 +1 @@
+void main(){int a; if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1; else if(a) a=1;}
@@ -0,0 +1,20002 @@
+void main(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+int f(){
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
@@ -0,0 +1 @@
+void main(){int i,a[4];for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)for(i=0;i<4;i++)a[i]=i;}
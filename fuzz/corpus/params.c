@@ -0,0 +1,4002 @@
+int p0(int a){return a+1;}
+int p1(int a){return a+1;}
+int p2(int a){return a+1;}
+int p3(int a){return a+1;}
+int p4(int a){return a+1;}
+int p5(int a){return a+1;}
+int p6(int a){return a+1;}
+int p7(int a){return a+1;}
+int p8(int a){return a+1;}
+int p9(int a){return a+1;}
+int p10(int a){return a+1;}
+int p11(int a){return a+1;}
+int p12(int a){return a+1;}
+int p13(int a){return a+1;}
+int p14(int a){return a+1;}
+int p15(int a){return a+1;}
+int p16(int a){return a+1;}
+int p17(int a){return a+1;}
+int p18(int a){return a+1;}
+int p19(int a){return a+1;}
+int p20(int a){return a+1;}
+int p21(int a){return a+1;}
+int p22(int a){return a+1;}
+int p23(int a){return a+1;}
+int p24(int a){return a+1;}
+int p25(int a){return a+1;}
+int p26(int a){return a+1;}
+int p27(int a){return a+1;}
+int p28(int a){return a+1;}
+int p29(int a){return a+1;}
+int p30(int a){return a+1;}
+int p31(int a){return a+1;}
+int p32(int a){return a+1;}
+int p33(int a){return a+1;}
+int p34(int a){return a+1;}
+int p35(int a){return a+1;}
+int p36(int a){return a+1;}
+int p37(int a){return a+1;}
+int p38(int a){return a+1;}
+int p39(int a){return a+1;}
+int p40(int a){return a+1;}
+int p41(int a){return a+1;}
+int p42(int a){return a+1;}
+int p43(int a){return a+1;}
+int p44(int a){return a+1;}
+int p45(int a){return a+1;}
+int p46(int a){return a+1;}
+int p47(int a){return a+1;}
+int p48(int a){return a+1;}
+int p49(int a){return a+1;}
+int p50(int a){return a+1;}
+int p51(int a){return a+1;}
+int p52(int a){return a+1;}
+int p53(int a){return a+1;}
+int p54(int a){return a+1;}
+int p55(int a){return a+1;}
+int p56(int a){return a+1;}
+int p57(int a){return a+1;}
+int p58(int a){return a+1;}
+int p59(int a){return a+1;}
+int p60(int a){return a+1;}
+int p61(int a){return a+1;}
+int p62(int a){return a+1;}
+int p63(int a){return a+1;}
+int p64(int a){return a+1;}
+int p65(int a){return a+1;}
+int p66(int a){return a+1;}
+int p67(int a){return a+1;}
+int p68(int a){return a+1;}
+int p69(int a){return a+1;}
+int p70(int a){return a+1;}
+int p71(int a){return a+1;}
+int p72(int a){return a+1;}
+int p73(int a){return a+1;}
+int p74(int a){return a+1;}
+int p75(int a){return a+1;}
+int p76(int a){return a+1;}
+int p77(int a){return a+1;}
+int p78(int a){return a+1;}
+int p79(int a){return a+1;}
+int p80(int a){return a+1;}
+int p81(int a){return a+1;}
+int p82(int a){return a+1;}
+int p83(int a){return a+1;}
+int p84(int a){return a+1;}
+int p85(int a){return a+1;}
+int p86(int a){return a+1;}
+int p87(int a){return a+1;}
+int p88(int a){return a+1;}
+int p89(int a){return a+1;}
+int p90(int a){return a+1;}
+int p91(int a){return a+1;}
+int p92(int a){return a+1;}
+int p93(int a){return a+1;}
+int p94(int a){return a+1;}
+int p95(int a){return a+1;}
+int p96(int a){return a+1;}
+int p97(int a){return a+1;}
+int p98(int a){return a+1;}
+int p99(int a){return a+1;}
+int p100(int a){return a+1;}
+int p101(int a){return a+1;}
+int p102(int a){return a+1;}
+int p103(int a){return a+1;}
+int p104(int a){return a+1;}
+int p105(int a){return a+1;}
+int p106(int a){return a+1;}
+int p107(int a){return a+1;}
+int p108(int a){return a+1;}
+int p109(int a){return a+1;}
+int p110(int a){return a+1;}
+int p111(int a){return a+1;}
+int p112(int a){return a+1;}
+int p113(int a){return a+1;}
+int p114(int a){return a+1;}
+int p115(int a){return a+1;}
+int p116(int a){return a+1;}
+int p117(int a){return a+1;}
+int p118(int a){return a+1;}
+int p119(int a){return a+1;}
+int p120(int a){return a+1;}
+int p121(int a){return a+1;}
+int p122(int a){return a+1;}
+int p123(int a){return a+1;}
+int p124(int a){return a+1;}
+int p125(int a){return a+1;}
+int p126(int a){return a+1;}
+int p127(int a){return a+1;}
+int p128(int a){return a+1;}
+int p129(int a){return a+1;}
+int p130(int a){return a+1;}
+int p131(int a){return a+1;}
+int p132(int a){return a+1;}
+int p133(int a){return a+1;}
+int p134(int a){return a+1;}
+int p135(int a){return a+1;}
+int p136(int a){return a+1;}
+int p137(int a){return a+1;}
+int p138(int a){return a+1;}
+int p139(int a){return a+1;}
+int p140(int a){return a+1;}
+int p141(int a){return a+1;}
+int p142(int a){return a+1;}
+int p143(int a){return a+1;}
+int p144(int a){return a+1;}
+int p145(int a){return a+1;}
+int p146(int a){return a+1;}
+int p147(int a){return a+1;}
+int p148(int a){return a+1;}
+int p149(int a){return a+1;}
+int p150(int a){return a+1;}
+int p151(int a){return a+1;}
+int p152(int a){return a+1;}
+int p153(int a){return a+1;}
+int p154(int a){return a+1;}
+int p155(int a){return a+1;}
+int p156(int a){return a+1;}
+int p157(int a){return a+1;}
+int p158(int a){return a+1;}
+int p159(int a){return a+1;}
+int p160(int a){return a+1;}
+int p161(int a){return a+1;}
+int p162(int a){return a+1;}
+int p163(int a){return a+1;}
+int p164(int a){return a+1;}
+int p165(int a){return a+1;}
+int p166(int a){return a+1;}
+int p167(int a){return a+1;}
+int p168(int a){return a+1;}
+int p169(int a){return a+1;}
+int p170(int a){return a+1;}
+int p171(int a){return a+1;}
+int p172(int a){return a+1;}
+int p173(int a){return a+1;}
+int p174(int a){return a+1;}
+int p175(int a){return a+1;}
+int p176(int a){return a+1;}
+int p177(int a){return a+1;}
+int p178(int a){return a+1;}
+int p179(int a){return a+1;}
+int p180(int a){return a+1;}
+int p181(int a){return a+1;}
+int p182(int a){return a+1;}
+int p183(int a){return a+1;}
+int p184(int a){return a+1;}
+int p185(int a){return a+1;}
+int p186(int a){return a+1;}
+int p187(int a){return a+1;}
+int p188(int a){return a+1;}
+int p189(int a){return a+1;}
+int p190(int a){return a+1;}
+int p191(int a){return a+1;}
+int p192(int a){return a+1;}
+int p193(int a){return a+1;}
+int p194(int a){return a+1;}
+int p195(int a){return a+1;}
+int p196(int a){return a+1;}
+int p197(int a){return a+1;}
+int p198(int a){return a+1;}
+int p199(int a){return a+1;}
+int p200(int a){return a+1;}
+int p201(int a){return a+1;}
+int p202(int a){return a+1;}
+int p203(int a){return a+1;}
+int p204(int a){return a+1;}
+int p205(int a){return a+1;}
+int p206(int a){return a+1;}
+int p207(int a){return a+1;}
+int p208(int a){return a+1;}
+int p209(int a){return a+1;}
+int p210(int a){return a+1;}
+int p211(int a){return a+1;}
+int p212(int a){return a+1;}
+int p213(int a){return a+1;}
+int p214(int a){return a+1;}
+int p215(int a){return a+1;}
+int p216(int a){return a+1;}
+int p217(int a){return a+1;}
+int p218(int a){return a+1;}
+int p219(int a){return a+1;}
+int p220(int a){return a+1;}
+int p221(int a){return a+1;}
+int p222(int a){return a+1;}
+int p223(int a){return a+1;}
+int p224(int a){return a+1;}
+int p225(int a){return a+1;}
+int p226(int a){return a+1;}
+int p227(int a){return a+1;}
+int p228(int a){return a+1;}
+int p229(int a){return a+1;}
+int p230(int a){return a+1;}
+int p231(int a){return a+1;}
+int p232(int a){return a+1;}
+int p233(int a){return a+1;}
+int p234(int a){return a+1;}
+int p235(int a){return a+1;}
+int p236(int a){return a+1;}
+int p237(int a){return a+1;}
+int p238(int a){return a+1;}
+int p239(int a){return a+1;}
+int p240(int a){return a+1;}
+int p241(int a){return a+1;}
+int p242(int a){return a+1;}
+int p243(int a){return a+1;}
+int p244(int a){return a+1;}
+int p245(int a){return a+1;}
+int p246(int a){return a+1;}
+int p247(int a){return a+1;}
+int p248(int a){return a+1;}
+int p249(int a){return a+1;}
+int p250(int a){return a+1;}
+int p251(int a){return a+1;}
+int p252(int a){return a+1;}
+int p253(int a){return a+1;}
+int p254(int a){return a+1;}
+int p255(int a){return a+1;}
+int p256(int a){return a+1;}
+int p257(int a){return a+1;}
+int p258(int a){return a+1;}
+int p259(int a){return a+1;}
+int p260(int a){return a+1;}
+int p261(int a){return a+1;}
+int p262(int a){return a+1;}
+int p263(int a){return a+1;}
+int p264(int a){return a+1;}
+int p265(int a){return a+1;}
+int p266(int a){return a+1;}
+int p267(int a){return a+1;}
+int p268(int a){return a+1;}
+int p269(int a){return a+1;}
+int p270(int a){return a+1;}
+int p271(int a){return a+1;}
+int p272(int a){return a+1;}
+int p273(int a){return a+1;}
+int p274(int a){return a+1;}
+int p275(int a){return a+1;}
+int p276(int a){return a+1;}
+int p277(int a){return a+1;}
+int p278(int a){return a+1;}
+int p279(int a){return a+1;}
+int p280(int a){return a+1;}
+int p281(int a){return a+1;}
+int p282(int a){return a+1;}
+int p283(int a){return a+1;}
+int p284(int a){return a+1;}
+int p285(int a){return a+1;}
+int p286(int a){return a+1;}
+int p287(int a){return a+1;}
+int p288(int a){return a+1;}
+int p289(int a){return a+1;}
+int p290(int a){return a+1;}
+int p291(int a){return a+1;}
+int p292(int a){return a+1;}
+int p293(int a){return a+1;}
+int p294(int a){return a+1;}
+int p295(int a){return a+1;}
+int p296(int a){return a+1;}
+int p297(int a){return a+1;}
+int p298(int a){return a+1;}
+int p299(int a){return a+1;}
+int p300(int a){return a+1;}
+int p301(int a){return a+1;}
+int p302(int a){return a+1;}
+int p303(int a){return a+1;}
+int p304(int a){return a+1;}
+int p305(int a){return a+1;}
+int p306(int a){return a+1;}
+int p307(int a){return a+1;}
+int p308(int a){return a+1;}
+int p309(int a){return a+1;}
+int p310(int a){return a+1;}
+int p311(int a){return a+1;}
+int p312(int a){return a+1;}
+int p313(int a){return a+1;}
+int p314(int a){return a+1;}
+int p315(int a){return a+1;}
+int p316(int a){return a+1;}
+int p317(int a){return a+1;}
+int p318(int a){return a+1;}
+int p319(int a){return a+1;}
+int p320(int a){return a+1;}
+int p321(int a){return a+1;}
+int p322(int a){return a+1;}
+int p323(int a){return a+1;}
+int p324(int a){return a+1;}
+int p325(int a){return a+1;}
+int p326(int a){return a+1;}
+int p327(int a){return a+1;}
+int p328(int a){return a+1;}
+int p329(int a){return a+1;}
+int p330(int a){return a+1;}
+int p331(int a){return a+1;}
+int p332(int a){return a+1;}
+int p333(int a){return a+1;}
+int p334(int a){return a+1;}
+int p335(int a){return a+1;}
+int p336(int a){return a+1;}
+int p337(int a){return a+1;}
+int p338(int a){return a+1;}
+int p339(int a){return a+1;}
+int p340(int a){return a+1;}
+int p341(int a){return a+1;}
+int p342(int a){return a+1;}
+int p343(int a){return a+1;}
+int p344(int a){return a+1;}
+int p345(int a){return a+1;}
+int p346(int a){return a+1;}
+int p347(int a){return a+1;}
+int p348(int a){return a+1;}
+int p349(int a){return a+1;}
+int p350(int a){return a+1;}
+int p351(int a){return a+1;}
+int p352(int a){return a+1;}
+int p353(int a){return a+1;}
+int p354(int a){return a+1;}
+int p355(int a){return a+1;}
+int p356(int a){return a+1;}
+int p357(int a){return a+1;}
+int p358(int a){return a+1;}
+int p359(int a){return a+1;}
+int p360(int a){return a+1;}
+int p361(int a){return a+1;}
+int p362(int a){return a+1;}
+int p363(int a){return a+1;}
+int p364(int a){return a+1;}
+int p365(int a){return a+1;}
+int p366(int a){return a+1;}
+int p367(int a){return a+1;}
+int p368(int a){return a+1;}
+int p369(int a){return a+1;}
+int p370(int a){return a+1;}
+int p371(int a){return a+1;}
+int p372(int a){return a+1;}
+int p373(int a){return a+1;}
+int p374(int a){return a+1;}
+int p375(int a){return a+1;}
+int p376(int a){return a+1;}
+int p377(int a){return a+1;}
+int p378(int a){return a+1;}
+int p379(int a){return a+1;}
+int p380(int a){return a+1;}
+int p381(int a){return a+1;}
+int p382(int a){return a+1;}
+int p383(int a){return a+1;}
+int p384(int a){return a+1;}
+int p385(int a){return a+1;}
+int p386(int a){return a+1;}
+int p387(int a){return a+1;}
+int p388(int a){return a+1;}
+int p389(int a){return a+1;}
+int p390(int a){return a+1;}
+int p391(int a){return a+1;}
+int p392(int a){return a+1;}
+int p393(int a){return a+1;}
+int p394(int a){return a+1;}
+int p395(int a){return a+1;}
+int p396(int a){return a+1;}
+int p397(int a){return a+1;}
+int p398(int a){return a+1;}
+int p399(int a){return a+1;}
+int p400(int a){return a+1;}
+int p401(int a){return a+1;}
+int p402(int a){return a+1;}
+int p403(int a){return a+1;}
+int p404(int a){return a+1;}
+int p405(int a){return a+1;}
+int p406(int a){return a+1;}
+int p407(int a){return a+1;}
+int p408(int a){return a+1;}
+int p409(int a){return a+1;}
+int p410(int a){return a+1;}
+int p411(int a){return a+1;}
+int p412(int a){return a+1;}
+int p413(int a){return a+1;}
+int p414(int a){return a+1;}
+int p415(int a){return a+1;}
+int p416(int a){return a+1;}
+int p417(int a){return a+1;}
+int p418(int a){return a+1;}
+int p419(int a){return a+1;}
+int p420(int a){return a+1;}
+int p421(int a){return a+1;}
+int p422(int a){return a+1;}
+int p423(int a){return a+1;}
+int p424(int a){return a+1;}
+int p425(int a){return a+1;}
+int p426(int a){return a+1;}
+int p427(int a){return a+1;}
+int p428(int a){return a+1;}
+int p429(int a){return a+1;}
+int p430(int a){return a+1;}
+int p431(int a){return a+1;}
+int p432(int a){return a+1;}
+int p433(int a){return a+1;}
+int p434(int a){return a+1;}
+int p435(int a){return a+1;}
+int p436(int a){return a+1;}
+int p437(int a){return a+1;}
+int p438(int a){return a+1;}
+int p439(int a){return a+1;}
+int p440(int a){return a+1;}
+int p441(int a){return a+1;}
+int p442(int a){return a+1;}
+int p443(int a){return a+1;}
+int p444(int a){return a+1;}
+int p445(int a){return a+1;}
+int p446(int a){return a+1;}
+int p447(int a){return a+1;}
+int p448(int a){return a+1;}
+int p449(int a){return a+1;}
+int p450(int a){return a+1;}
+int p451(int a){return a+1;}
+int p452(int a){return a+1;}
+int p453(int a){return a+1;}
+int p454(int a){return a+1;}
+int p455(int a){return a+1;}
+int p456(int a){return a+1;}
+int p457(int a){return a+1;}
+int p458(int a){return a+1;}
+int p459(int a){return a+1;}
+int p460(int a){return a+1;}
+int p461(int a){return a+1;}
+int p462(int a){return a+1;}
+int p463(int a){return a+1;}
+int p464(int a){return a+1;}
+int p465(int a){return a+1;}
+int p466(int a){return a+1;}
+int p467(int a){return a+1;}
+int p468(int a){return a+1;}
+int p469(int a){return a+1;}
+int p470(int a){return a+1;}
+int p471(int a){return a+1;}
+int p472(int a){return a+1;}
+int p473(int a){return a+1;}
+int p474(int a){return a+1;}
+int p475(int a){return a+1;}
+int p476(int a){return a+1;}
+int p477(int a){return a+1;}
+int p478(int a){return a+1;}
+int p479(int a){return a+1;}
+int p480(int a){return a+1;}
+int p481(int a){return a+1;}
+int p482(int a){return a+1;}
+int p483(int a){return a+1;}
+int p484(int a){return a+1;}
+int p485(int a){return a+1;}
+int p486(int a){return a+1;}
+int p487(int a){return a+1;}
+int p488(int a){return a+1;}
+int p489(int a){return a+1;}
+int p490(int a){return a+1;}
+int p491(int a){return a+1;}
+int p492(int a){return a+1;}
+int p493(int a){return a+1;}
+int p494(int a){return a+1;}
+int p495(int a){return a+1;}
+int p496(int a){return a+1;}
+int p497(int a){return a+1;}
+int p498(int a){return a+1;}
+int p499(int a){return a+1;}
+int p500(int a){return a+1;}
+int p501(int a){return a+1;}
+int p502(int a){return a+1;}
+int p503(int a){return a+1;}
+int p504(int a){return a+1;}
+int p505(int a){return a+1;}
+int p506(int a){return a+1;}
+int p507(int a){return a+1;}
+int p508(int a){return a+1;}
+int p509(int a){return a+1;}
+int p510(int a){return a+1;}
+int p511(int a){return a+1;}
+int p512(int a){return a+1;}
+int p513(int a){return a+1;}
+int p514(int a){return a+1;}
+int p515(int a){return a+1;}
+int p516(int a){return a+1;}
+int p517(int a){return a+1;}
+int p518(int a){return a+1;}
+int p519(int a){return a+1;}
+int p520(int a){return a+1;}
+int p521(int a){return a+1;}
+int p522(int a){return a+1;}
+int p523(int a){return a+1;}
+int p524(int a){return a+1;}
+int p525(int a){return a+1;}
+int p526(int a){return a+1;}
+int p527(int a){return a+1;}
+int p528(int a){return a+1;}
+int p529(int a){return a+1;}
+int p530(int a){return a+1;}
+int p531(int a){return a+1;}
+int p532(int a){return a+1;}
+int p533(int a){return a+1;}
+int p534(int a){return a+1;}
+int p535(int a){return a+1;}
+int p536(int a){return a+1;}
+int p537(int a){return a+1;}
+int p538(int a){return a+1;}
+int p539(int a){return a+1;}
+int p540(int a){return a+1;}
+int p541(int a){return a+1;}
+int p542(int a){return a+1;}
+int p543(int a){return a+1;}
+int p544(int a){return a+1;}
+int p545(int a){return a+1;}
+int p546(int a){return a+1;}
+int p547(int a){return a+1;}
+int p548(int a){return a+1;}
+int p549(int a){return a+1;}
+int p550(int a){return a+1;}
+int p551(int a){return a+1;}
+int p552(int a){return a+1;}
+int p553(int a){return a+1;}
+int p554(int a){return a+1;}
+int p555(int a){return a+1;}
+int p556(int a){return a+1;}
+int p557(int a){return a+1;}
+int p558(int a){return a+1;}
+int p559(int a){return a+1;}
+int p560(int a){return a+1;}
+int p561(int a){return a+1;}
+int p562(int a){return a+1;}
+int p563(int a){return a+1;}
+int p564(int a){return a+1;}
+int p565(int a){return a+1;}
+int p566(int a){return a+1;}
+int p567(int a){return a+1;}
+int p568(int a){return a+1;}
+int p569(int a){return a+1;}
+int p570(int a){return a+1;}
+int p571(int a){return a+1;}
+int p572(int a){return a+1;}
+int p573(int a){return a+1;}
+int p574(int a){return a+1;}
+int p575(int a){return a+1;}
+int p576(int a){return a+1;}
+int p577(int a){return a+1;}
+int p578(int a){return a+1;}
+int p579(int a){return a+1;}
+int p580(int a){return a+1;}
+int p581(int a){return a+1;}
+int p582(int a){return a+1;}
+int p583(int a){return a+1;}
+int p584(int a){return a+1;}
+int p585(int a){return a+1;}
+int p586(int a){return a+1;}
+int p587(int a){return a+1;}
+int p588(int a){return a+1;}
+int p589(int a){return a+1;}
+int p590(int a){return a+1;}
+int p591(int a){return a+1;}
+int p592(int a){return a+1;}
+int p593(int a){return a+1;}
+int p594(int a){return a+1;}
+int p595(int a){return a+1;}
+int p596(int a){return a+1;}
+int p597(int a){return a+1;}
+int p598(int a){return a+1;}
+int p599(int a){return a+1;}
+int p600(int a){return a+1;}
+int p601(int a){return a+1;}
+int p602(int a){return a+1;}
+int p603(int a){return a+1;}
+int p604(int a){return a+1;}
+int p605(int a){return a+1;}
+int p606(int a){return a+1;}
+int p607(int a){return a+1;}
+int p608(int a){return a+1;}
+int p609(int a){return a+1;}
+int p610(int a){return a+1;}
+int p611(int a){return a+1;}
+int p612(int a){return a+1;}
+int p613(int a){return a+1;}
+int p614(int a){return a+1;}
+int p615(int a){return a+1;}
+int p616(int a){return a+1;}
+int p617(int a){return a+1;}
+int p618(int a){return a+1;}
+int p619(int a){return a+1;}
+int p620(int a){return a+1;}
+int p621(int a){return a+1;}
+int p622(int a){return a+1;}
+int p623(int a){return a+1;}
+int p624(int a){return a+1;}
+int p625(int a){return a+1;}
+int p626(int a){return a+1;}
+int p627(int a){return a+1;}
+int p628(int a){return a+1;}
+int p629(int a){return a+1;}
+int p630(int a){return a+1;}
+int p631(int a){return a+1;}
+int p632(int a){return a+1;}
+int p633(int a){return a+1;}
+int p634(int a){return a+1;}
+int p635(int a){return a+1;}
+int p636(int a){return a+1;}
+int p637(int a){return a+1;}
+int p638(int a){return a+1;}
+int p639(int a){return a+1;}
+int p640(int a){return a+1;}
+int p641(int a){return a+1;}
+int p642(int a){return a+1;}
+int p643(int a){return a+1;}
+int p644(int a){return a+1;}
+int p645(int a){return a+1;}
+int p646(int a){return a+1;}
+int p647(int a){return a+1;}
+int p648(int a){return a+1;}
+int p649(int a){return a+1;}
+int p650(int a){return a+1;}
+int p651(int a){return a+1;}
+int p652(int a){return a+1;}
+int p653(int a){return a+1;}
+int p654(int a){return a+1;}
+int p655(int a){return a+1;}
+int p656(int a){return a+1;}
+int p657(int a){return a+1;}
+int p658(int a){return a+1;}
+int p659(int a){return a+1;}
+int p660(int a){return a+1;}
+int p661(int a){return a+1;}
+int p662(int a){return a+1;}
+int p663(int a){return a+1;}
+int p664(int a){return a+1;}
+int p665(int a){return a+1;}
+int p666(int a){return a+1;}
+int p667(int a){return a+1;}
+int p668(int a){return a+1;}
+int p669(int a){return a+1;}
+int p670(int a){return a+1;}
+int p671(int a){return a+1;}
+int p672(int a){return a+1;}
+int p673(int a){return a+1;}
+int p674(int a){return a+1;}
+int p675(int a){return a+1;}
+int p676(int a){return a+1;}
+int p677(int a){return a+1;}
+int p678(int a){return a+1;}
+int p679(int a){return a+1;}
+int p680(int a){return a+1;}
+int p681(int a){return a+1;}
+int p682(int a){return a+1;}
+int p683(int a){return a+1;}
+int p684(int a){return a+1;}
+int p685(int a){return a+1;}
+int p686(int a){return a+1;}
+int p687(int a){return a+1;}
+int p688(int a){return a+1;}
+int p689(int a){return a+1;}
+int p690(int a){return a+1;}
+int p691(int a){return a+1;}
+int p692(int a){return a+1;}
+int p693(int a){return a+1;}
+int p694(int a){return a+1;}
+int p695(int a){return a+1;}
+int p696(int a){return a+1;}
+int p697(int a){return a+1;}
+int p698(int a){return a+1;}
+int p699(int a){return a+1;}
+int p700(int a){return a+1;}
+int p701(int a){return a+1;}
+int p702(int a){return a+1;}
+int p703(int a){return a+1;}
+int p704(int a){return a+1;}
+int p705(int a){return a+1;}
+int p706(int a){return a+1;}
+int p707(int a){return a+1;}
+int p708(int a){return a+1;}
+int p709(int a){return a+1;}
+int p710(int a){return a+1;}
+int p711(int a){return a+1;}
+int p712(int a){return a+1;}
+int p713(int a){return a+1;}
+int p714(int a){return a+1;}
+int p715(int a){return a+1;}
+int p716(int a){return a+1;}
+int p717(int a){return a+1;}
+int p718(int a){return a+1;}
+int p719(int a){return a+1;}
+int p720(int a){return a+1;}
+int p721(int a){return a+1;}
+int p722(int a){return a+1;}
+int p723(int a){return a+1;}
+int p724(int a){return a+1;}
+int p725(int a){return a+1;}
+int p726(int a){return a+1;}
+int p727(int a){return a+1;}
+int p728(int a){return a+1;}
+int p729(int a){return a+1;}
+int p730(int a){return a+1;}
+int p731(int a){return a+1;}
+int p732(int a){return a+1;}
+int p733(int a){return a+1;}
+int p734(int a){return a+1;}
+int p735(int a){return a+1;}
+int p736(int a){return a+1;}
+int p737(int a){return a+1;}
+int p738(int a){return a+1;}
+int p739(int a){return a+1;}
+int p740(int a){return a+1;}
+int p741(int a){return a+1;}
+int p742(int a){return a+1;}
+int p743(int a){return a+1;}
+int p744(int a){return a+1;}
+int p745(int a){return a+1;}
+int p746(int a){return a+1;}
+int p747(int a){return a+1;}
+int p748(int a){return a+1;}
+int p749(int a){return a+1;}
+int p750(int a){return a+1;}
+int p751(int a){return a+1;}
+int p752(int a){return a+1;}
+int p753(int a){return a+1;}
+int p754(int a){return a+1;}
+int p755(int a){return a+1;}
+int p756(int a){return a+1;}
+int p757(int a){return a+1;}
+int p758(int a){return a+1;}
+int p759(int a){return a+1;}
+int p760(int a){return a+1;}
+int p761(int a){return a+1;}
+int p762(int a){return a+1;}
+int p763(int a){return a+1;}
+int p764(int a){return a+1;}
+int p765(int a){return a+1;}
+int p766(int a){return a+1;}
+int p767(int a){return a+1;}
+int p768(int a){return a+1;}
+int p769(int a){return a+1;}
+int p770(int a){return a+1;}
+int p771(int a){return a+1;}
+int p772(int a){return a+1;}
+int p773(int a){return a+1;}
+int p774(int a){return a+1;}
+int p775(int a){return a+1;}
+int p776(int a){return a+1;}
+int p777(int a){return a+1;}
+int p778(int a){return a+1;}
+int p779(int a){return a+1;}
+int p780(int a){return a+1;}
+int p781(int a){return a+1;}
+int p782(int a){return a+1;}
+int p783(int a){return a+1;}
+int p784(int a){return a+1;}
+int p785(int a){return a+1;}
+int p786(int a){return a+1;}
+int p787(int a){return a+1;}
+int p788(int a){return a+1;}
+int p789(int a){return a+1;}
+int p790(int a){return a+1;}
+int p791(int a){return a+1;}
+int p792(int a){return a+1;}
+int p793(int a){return a+1;}
+int p794(int a){return a+1;}
+int p795(int a){return a+1;}
+int p796(int a){return a+1;}
+int p797(int a){return a+1;}
+int p798(int a){return a+1;}
+int p799(int a){return a+1;}
+int p800(int a){return a+1;}
+int p801(int a){return a+1;}
+int p802(int a){return a+1;}
+int p803(int a){return a+1;}
+int p804(int a){return a+1;}
+int p805(int a){return a+1;}
+int p806(int a){return a+1;}
+int p807(int a){return a+1;}
+int p808(int a){return a+1;}
+int p809(int a){return a+1;}
+int p810(int a){return a+1;}
+int p811(int a){return a+1;}
+int p812(int a){return a+1;}
+int p813(int a){return a+1;}
+int p814(int a){return a+1;}
+int p815(int a){return a+1;}
+int p816(int a){return a+1;}
+int p817(int a){return a+1;}
+int p818(int a){return a+1;}
+int p819(int a){return a+1;}
+int p820(int a){return a+1;}
+int p821(int a){return a+1;}
+int p822(int a){return a+1;}
+int p823(int a){return a+1;}
+int p824(int a){return a+1;}
+int p825(int a){return a+1;}
+int p826(int a){return a+1;}
+int p827(int a){return a+1;}
+int p828(int a){return a+1;}
+int p829(int a){return a+1;}
+int p830(int a){return a+1;}
+int p831(int a){return a+1;}
+int p832(int a){return a+1;}
+int p833(int a){return a+1;}
+int p834(int a){return a+1;}
+int p835(int a){return a+1;}
+int p836(int a){return a+1;}
+int p837(int a){return a+1;}
+int p838(int a){return a+1;}
+int p839(int a){return a+1;}
+int p840(int a){return a+1;}
+int p841(int a){return a+1;}
+int p842(int a){return a+1;}
+int p843(int a){return a+1;}
+int p844(int a){return a+1;}
+int p845(int a){return a+1;}
+int p846(int a){return a+1;}
+int p847(int a){return a+1;}
+int p848(int a){return a+1;}
+int p849(int a){return a+1;}
+int p850(int a){return a+1;}
+int p851(int a){return a+1;}
+int p852(int a){return a+1;}
+int p853(int a){return a+1;}
+int p854(int a){return a+1;}
+int p855(int a){return a+1;}
+int p856(int a){return a+1;}
+int p857(int a){return a+1;}
+int p858(int a){return a+1;}
+int p859(int a){return a+1;}
+int p860(int a){return a+1;}
+int p861(int a){return a+1;}
+int p862(int a){return a+1;}
+int p863(int a){return a+1;}
+int p864(int a){return a+1;}
+int p865(int a){return a+1;}
+int p866(int a){return a+1;}
+int p867(int a){return a+1;}
+int p868(int a){return a+1;}
+int p869(int a){return a+1;}
+int p870(int a){return a+1;}
+int p871(int a){return a+1;}
+int p872(int a){return a+1;}
+int p873(int a){return a+1;}
+int p874(int a){return a+1;}
+int p875(int a){return a+1;}
+int p876(int a){return a+1;}
+int p877(int a){return a+1;}
+int p878(int a){return a+1;}
+int p879(int a){return a+1;}
+int p880(int a){return a+1;}
+int p881(int a){return a+1;}
+int p882(int a){return a+1;}
+int p883(int a){return a+1;}
+int p884(int a){return a+1;}
+int p885(int a){return a+1;}
+int p886(int a){return a+1;}
+int p887(int a){return a+1;}
+int p888(int a){return a+1;}
+int p889(int a){return a+1;}
+int p890(int a){return a+1;}
+int p891(int a){return a+1;}
+int p892(int a){return a+1;}
+int p893(int a){return a+1;}
+int p894(int a){return a+1;}
+int p895(int a){return a+1;}
+int p896(int a){return a+1;}
+int p897(int a){return a+1;}
+int p898(int a){return a+1;}
+int p899(int a){return a+1;}
+int p900(int a){return a+1;}
+int p901(int a){return a+1;}
+int p902(int a){return a+1;}
+int p903(int a){return a+1;}
+int p904(int a){return a+1;}
+int p905(int a){return a+1;}
+int p906(int a){return a+1;}
+int p907(int a){return a+1;}
+int p908(int a){return a+1;}
+int p909(int a){return a+1;}
+int p910(int a){return a+1;}
+int p911(int a){return a+1;}
+int p912(int a){return a+1;}
+int p913(int a){return a+1;}
+int p914(int a){return a+1;}
+int p915(int a){return a+1;}
+int p916(int a){return a+1;}
+int p917(int a){return a+1;}
+int p918(int a){return a+1;}
+int p919(int a){return a+1;}
+int p920(int a){return a+1;}
+int p921(int a){return a+1;}
+int p922(int a){return a+1;}
+int p923(int a){return a+1;}
+int p924(int a){return a+1;}
+int p925(int a){return a+1;}
+int p926(int a){return a+1;}
+int p927(int a){return a+1;}
+int p928(int a){return a+1;}
+int p929(int a){return a+1;}
+int p930(int a){return a+1;}
+int p931(int a){return a+1;}
+int p932(int a){return a+1;}
+int p933(int a){return a+1;}
+int p934(int a){return a+1;}
+int p935(int a){return a+1;}
+int p936(int a){return a+1;}
+int p937(int a){return a+1;}
+int p938(int a){return a+1;}
+int p939(int a){return a+1;}
+int p940(int a){return a+1;}
+int p941(int a){return a+1;}
+int p942(int a){return a+1;}
+int p943(int a){return a+1;}
+int p944(int a){return a+1;}
+int p945(int a){return a+1;}
+int p946(int a){return a+1;}
+int p947(int a){return a+1;}
+int p948(int a){return a+1;}
+int p949(int a){return a+1;}
+int p950(int a){return a+1;}
+int p951(int a){return a+1;}
+int p952(int a){return a+1;}
+int p953(int a){return a+1;}
+int p954(int a){return a+1;}
+int p955(int a){return a+1;}
+int p956(int a){return a+1;}
+int p957(int a){return a+1;}
+int p958(int a){return a+1;}
+int p959(int a){return a+1;}
+int p960(int a){return a+1;}
+int p961(int a){return a+1;}
+int p962(int a){return a+1;}
+int p963(int a){return a+1;}
+int p964(int a){return a+1;}
+int p965(int a){return a+1;}
+int p966(int a){return a+1;}
+int p967(int a){return a+1;}
+int p968(int a){return a+1;}
+int p969(int a){return a+1;}
+int p970(int a){return a+1;}
+int p971(int a){return a+1;}
+int p972(int a){return a+1;}
+int p973(int a){return a+1;}
+int p974(int a){return a+1;}
+int p975(int a){return a+1;}
+int p976(int a){return a+1;}
+int p977(int a){return a+1;}
+int p978(int a){return a+1;}
+int p979(int a){return a+1;}
+int p980(int a){return a+1;}
+int p981(int a){return a+1;}
+int p982(int a){return a+1;}
+int p983(int a){return a+1;}
+int p984(int a){return a+1;}
+int p985(int a){return a+1;}
+int p986(int a){return a+1;}
+int p987(int a){return a+1;}
+int p988(int a){return a+1;}
+int p989(int a){return a+1;}
+int p990(int a){return a+1;}
+int p991(int a){return a+1;}
+int p992(int a){return a+1;}
+int p993(int a){return a+1;}
+int p994(int a){return a+1;}
+int p995(int a){return a+1;}
+int p996(int a){return a+1;}
+int p997(int a){return a+1;}
+int p998(int a){return a+1;}
+int p999(int a){return a+1;}
+int p1000(int a){return a+1;}
+int p1001(int a){return a+1;}
+int p1002(int a){return a+1;}
+int p1003(int a){return a+1;}
+int p1004(int a){return a+1;}
+int p1005(int a){return a+1;}
+int p1006(int a){return a+1;}
+int p1007(int a){return a+1;}
+int p1008(int a){return a+1;}
+int p1009(int a){return a+1;}
+int p1010(int a){return a+1;}
+int p1011(int a){return a+1;}
+int p1012(int a){return a+1;}
+int p1013(int a){return a+1;}
+int p1014(int a){return a+1;}
+int p1015(int a){return a+1;}
+int p1016(int a){return a+1;}
+int p1017(int a){return a+1;}
+int p1018(int a){return a+1;}
+int p1019(int a){return a+1;}
+int p1020(int a){return a+1;}
+int p1021(int a){return a+1;}
+int p1022(int a){return a+1;}
+int p1023(int a){return a+1;}
+int p1024(int a){return a+1;}
+int p1025(int a){return a+1;}
+int p1026(int a){return a+1;}
+int p1027(int a){return a+1;}
+int p1028(int a){return a+1;}
+int p1029(int a){return a+1;}
+int p1030(int a){return a+1;}
+int p1031(int a){return a+1;}
+int p1032(int a){return a+1;}
+int p1033(int a){return a+1;}
+int p1034(int a){return a+1;}
+int p1035(int a){return a+1;}
+int p1036(int a){return a+1;}
+int p1037(int a){return a+1;}
+int p1038(int a){return a+1;}
+int p1039(int a){return a+1;}
+int p1040(int a){return a+1;}
+int p1041(int a){return a+1;}
+int p1042(int a){return a+1;}
+int p1043(int a){return a+1;}
+int p1044(int a){return a+1;}
+int p1045(int a){return a+1;}
+int p1046(int a){return a+1;}
+int p1047(int a){return a+1;}
+int p1048(int a){return a+1;}
+int p1049(int a){return a+1;}
+int p1050(int a){return a+1;}
+int p1051(int a){return a+1;}
+int p1052(int a){return a+1;}
+int p1053(int a){return a+1;}
+int p1054(int a){return a+1;}
+int p1055(int a){return a+1;}
+int p1056(int a){return a+1;}
+int p1057(int a){return a+1;}
+int p1058(int a){return a+1;}
+int p1059(int a){return a+1;}
+int p1060(int a){return a+1;}
+int p1061(int a){return a+1;}
+int p1062(int a){return a+1;}
+int p1063(int a){return a+1;}
+int p1064(int a){return a+1;}
+int p1065(int a){return a+1;}
+int p1066(int a){return a+1;}
+int p1067(int a){return a+1;}
+int p1068(int a){return a+1;}
+int p1069(int a){return a+1;}
+int p1070(int a){return a+1;}
+int p1071(int a){return a+1;}
+int p1072(int a){return a+1;}
+int p1073(int a){return a+1;}
+int p1074(int a){return a+1;}
+int p1075(int a){return a+1;}
+int p1076(int a){return a+1;}
+int p1077(int a){return a+1;}
+int p1078(int a){return a+1;}
+int p1079(int a){return a+1;}
+int p1080(int a){return a+1;}
+int p1081(int a){return a+1;}
+int p1082(int a){return a+1;}
+int p1083(int a){return a+1;}
+int p1084(int a){return a+1;}
+int p1085(int a){return a+1;}
+int p1086(int a){return a+1;}
+int p1087(int a){return a+1;}
+int p1088(int a){return a+1;}
+int p1089(int a){return a+1;}
+int p1090(int a){return a+1;}
+int p1091(int a){return a+1;}
+int p1092(int a){return a+1;}
+int p1093(int a){return a+1;}
+int p1094(int a){return a+1;}
+int p1095(int a){return a+1;}
+int p1096(int a){return a+1;}
+int p1097(int a){return a+1;}
+int p1098(int a){return a+1;}
+int p1099(int a){return a+1;}
+int p1100(int a){return a+1;}
+int p1101(int a){return a+1;}
+int p1102(int a){return a+1;}
+int p1103(int a){return a+1;}
+int p1104(int a){return a+1;}
+int p1105(int a){return a+1;}
+int p1106(int a){return a+1;}
+int p1107(int a){return a+1;}
+int p1108(int a){return a+1;}
+int p1109(int a){return a+1;}
+int p1110(int a){return a+1;}
+int p1111(int a){return a+1;}
+int p1112(int a){return a+1;}
+int p1113(int a){return a+1;}
+int p1114(int a){return a+1;}
+int p1115(int a){return a+1;}
+int p1116(int a){return a+1;}
+int p1117(int a){return a+1;}
+int p1118(int a){return a+1;}
+int p1119(int a){return a+1;}
+int p1120(int a){return a+1;}
+int p1121(int a){return a+1;}
+int p1122(int a){return a+1;}
+int p1123(int a){return a+1;}
+int p1124(int a){return a+1;}
+int p1125(int a){return a+1;}
+int p1126(int a){return a+1;}
+int p1127(int a){return a+1;}
+int p1128(int a){return a+1;}
+int p1129(int a){return a+1;}
+int p1130(int a){return a+1;}
+int p1131(int a){return a+1;}
+int p1132(int a){return a+1;}
+int p1133(int a){return a+1;}
+int p1134(int a){return a+1;}
+int p1135(int a){return a+1;}
+int p1136(int a){return a+1;}
+int p1137(int a){return a+1;}
+int p1138(int a){return a+1;}
+int p1139(int a){return a+1;}
+int p1140(int a){return a+1;}
+int p1141(int a){return a+1;}
+int p1142(int a){return a+1;}
+int p1143(int a){return a+1;}
+int p1144(int a){return a+1;}
+int p1145(int a){return a+1;}
+int p1146(int a){return a+1;}
+int p1147(int a){return a+1;}
+int p1148(int a){return a+1;}
+int p1149(int a){return a+1;}
+int p1150(int a){return a+1;}
+int p1151(int a){return a+1;}
+int p1152(int a){return a+1;}
+int p1153(int a){return a+1;}
+int p1154(int a){return a+1;}
+int p1155(int a){return a+1;}
+int p1156(int a){return a+1;}
+int p1157(int a){return a+1;}
+int p1158(int a){return a+1;}
+int p1159(int a){return a+1;}
+int p1160(int a){return a+1;}
+int p1161(int a){return a+1;}
+int p1162(int a){return a+1;}
+int p1163(int a){return a+1;}
+int p1164(int a){return a+1;}
+int p1165(int a){return a+1;}
+int p1166(int a){return a+1;}
+int p1167(int a){return a+1;}
+int p1168(int a){return a+1;}
+int p1169(int a){return a+1;}
+int p1170(int a){return a+1;}
+int p1171(int a){return a+1;}
+int p1172(int a){return a+1;}
+int p1173(int a){return a+1;}
+int p1174(int a){return a+1;}
+int p1175(int a){return a+1;}
+int p1176(int a){return a+1;}
+int p1177(int a){return a+1;}
+int p1178(int a){return a+1;}
+int p1179(int a){return a+1;}
+int p1180(int a){return a+1;}
+int p1181(int a){return a+1;}
+int p1182(int a){return a+1;}
+int p1183(int a){return a+1;}
+int p1184(int a){return a+1;}
+int p1185(int a){return a+1;}
+int p1186(int a){return a+1;}
+int p1187(int a){return a+1;}
+int p1188(int a){return a+1;}
+int p1189(int a){return a+1;}
+int p1190(int a){return a+1;}
+int p1191(int a){return a+1;}
+int p1192(int a){return a+1;}
+int p1193(int a){return a+1;}
+int p1194(int a){return a+1;}
+int p1195(int a){return a+1;}
+int p1196(int a){return a+1;}
+int p1197(int a){return a+1;}
+int p1198(int a){return a+1;}
+int p1199(int a){return a+1;}
+int p1200(int a){return a+1;}
+int p1201(int a){return a+1;}
+int p1202(int a){return a+1;}
+int p1203(int a){return a+1;}
+int p1204(int a){return a+1;}
+int p1205(int a){return a+1;}
+int p1206(int a){return a+1;}
+int p1207(int a){return a+1;}
+int p1208(int a){return a+1;}
+int p1209(int a){return a+1;}
+int p1210(int a){return a+1;}
+int p1211(int a){return a+1;}
+int p1212(int a){return a+1;}
+int p1213(int a){return a+1;}
+int p1214(int a){return a+1;}
+int p1215(int a){return a+1;}
+int p1216(int a){return a+1;}
+int p1217(int a){return a+1;}
+int p1218(int a){return a+1;}
+int p1219(int a){return a+1;}
+int p1220(int a){return a+1;}
+int p1221(int a){return a+1;}
+int p1222(int a){return a+1;}
+int p1223(int a){return a+1;}
+int p1224(int a){return a+1;}
+int p1225(int a){return a+1;}
+int p1226(int a){return a+1;}
+int p1227(int a){return a+1;}
+int p1228(int a){return a+1;}
+int p1229(int a){return a+1;}
+int p1230(int a){return a+1;}
+int p1231(int a){return a+1;}
+int p1232(int a){return a+1;}
+int p1233(int a){return a+1;}
+int p1234(int a){return a+1;}
+int p1235(int a){return a+1;}
+int p1236(int a){return a+1;}
+int p1237(int a){return a+1;}
+int p1238(int a){return a+1;}
+int p1239(int a){return a+1;}
+int p1240(int a){return a+1;}
+int p1241(int a){return a+1;}
+int p1242(int a){return a+1;}
+int p1243(int a){return a+1;}
+int p1244(int a){return a+1;}
+int p1245(int a){return a+1;}
+int p1246(int a){return a+1;}
+int p1247(int a){return a+1;}
+int p1248(int a){return a+1;}
+int p1249(int a){return a+1;}
+int p1250(int a){return a+1;}
+int p1251(int a){return a+1;}
+int p1252(int a){return a+1;}
+int p1253(int a){return a+1;}
+int p1254(int a){return a+1;}
+int p1255(int a){return a+1;}
+int p1256(int a){return a+1;}
+int p1257(int a){return a+1;}
+int p1258(int a){return a+1;}
+int p1259(int a){return a+1;}
+int p1260(int a){return a+1;}
+int p1261(int a){return a+1;}
+int p1262(int a){return a+1;}
+int p1263(int a){return a+1;}
+int p1264(int a){return a+1;}
+int p1265(int a){return a+1;}
+int p1266(int a){return a+1;}
+int p1267(int a){return a+1;}
+int p1268(int a){return a+1;}
+int p1269(int a){return a+1;}
+int p1270(int a){return a+1;}
+int p1271(int a){return a+1;}
+int p1272(int a){return a+1;}
+int p1273(int a){return a+1;}
+int p1274(int a){return a+1;}
+int p1275(int a){return a+1;}
+int p1276(int a){return a+1;}
+int p1277(int a){return a+1;}
+int p1278(int a){return a+1;}
+int p1279(int a){return a+1;}
+int p1280(int a){return a+1;}
+int p1281(int a){return a+1;}
+int p1282(int a){return a+1;}
+int p1283(int a){return a+1;}
+int p1284(int a){return a+1;}
+int p1285(int a){return a+1;}
+int p1286(int a){return a+1;}
+int p1287(int a){return a+1;}
+int p1288(int a){return a+1;}
+int p1289(int a){return a+1;}
+int p1290(int a){return a+1;}
+int p1291(int a){return a+1;}
+int p1292(int a){return a+1;}
+int p1293(int a){return a+1;}
+int p1294(int a){return a+1;}
+int p1295(int a){return a+1;}
+int p1296(int a){return a+1;}
+int p1297(int a){return a+1;}
+int p1298(int a){return a+1;}
+int p1299(int a){return a+1;}
+int p1300(int a){return a+1;}
+int p1301(int a){return a+1;}
+int p1302(int a){return a+1;}
+int p1303(int a){return a+1;}
+int p1304(int a){return a+1;}
+int p1305(int a){return a+1;}
+int p1306(int a){return a+1;}
+int p1307(int a){return a+1;}
+int p1308(int a){return a+1;}
+int p1309(int a){return a+1;}
+int p1310(int a){return a+1;}
+int p1311(int a){return a+1;}
+int p1312(int a){return a+1;}
+int p1313(int a){return a+1;}
+int p1314(int a){return a+1;}
+int p1315(int a){return a+1;}
+int p1316(int a){return a+1;}
+int p1317(int a){return a+1;}
+int p1318(int a){return a+1;}
+int p1319(int a){return a+1;}
+int p1320(int a){return a+1;}
+int p1321(int a){return a+1;}
+int p1322(int a){return a+1;}
+int p1323(int a){return a+1;}
+int p1324(int a){return a+1;}
+int p1325(int a){return a+1;}
+int p1326(int a){return a+1;}
+int p1327(int a){return a+1;}
+int p1328(int a){return a+1;}
+int p1329(int a){return a+1;}
+int p1330(int a){return a+1;}
+int p1331(int a){return a+1;}
+int p1332(int a){return a+1;}
+int p1333(int a){return a+1;}
+int p1334(int a){return a+1;}
+int p1335(int a){return a+1;}
+int p1336(int a){return a+1;}
+int p1337(int a){return a+1;}
+int p1338(int a){return a+1;}
+int p1339(int a){return a+1;}
+int p1340(int a){return a+1;}
+int p1341(int a){return a+1;}
+int p1342(int a){return a+1;}
+int p1343(int a){return a+1;}
+int p1344(int a){return a+1;}
+int p1345(int a){return a+1;}
+int p1346(int a){return a+1;}
+int p1347(int a){return a+1;}
+int p1348(int a){return a+1;}
+int p1349(int a){return a+1;}
+int p1350(int a){return a+1;}
+int p1351(int a){return a+1;}
+int p1352(int a){return a+1;}
+int p1353(int a){return a+1;}
+int p1354(int a){return a+1;}
+int p1355(int a){return a+1;}
+int p1356(int a){return a+1;}
+int p1357(int a){return a+1;}
+int p1358(int a){return a+1;}
+int p1359(int a){return a+1;}
+int p1360(int a){return a+1;}
+int p1361(int a){return a+1;}
+int p1362(int a){return a+1;}
+int p1363(int a){return a+1;}
+int p1364(int a){return a+1;}
+int p1365(int a){return a+1;}
+int p1366(int a){return a+1;}
+int p1367(int a){return a+1;}
+int p1368(int a){return a+1;}
+int p1369(int a){return a+1;}
+int p1370(int a){return a+1;}
+int p1371(int a){return a+1;}
+int p1372(int a){return a+1;}
+int p1373(int a){return a+1;}
+int p1374(int a){return a+1;}
+int p1375(int a){return a+1;}
+int p1376(int a){return a+1;}
+int p1377(int a){return a+1;}
+int p1378(int a){return a+1;}
+int p1379(int a){return a+1;}
+int p1380(int a){return a+1;}
+int p1381(int a){return a+1;}
+int p1382(int a){return a+1;}
+int p1383(int a){return a+1;}
+int p1384(int a){return a+1;}
+int p1385(int a){return a+1;}
+int p1386(int a){return a+1;}
+int p1387(int a){return a+1;}
+int p1388(int a){return a+1;}
+int p1389(int a){return a+1;}
+int p1390(int a){return a+1;}
+int p1391(int a){return a+1;}
+int p1392(int a){return a+1;}
+int p1393(int a){return a+1;}
+int p1394(int a){return a+1;}
+int p1395(int a){return a+1;}
+int p1396(int a){return a+1;}
+int p1397(int a){return a+1;}
+int p1398(int a){return a+1;}
+int p1399(int a){return a+1;}
+int p1400(int a){return a+1;}
+int p1401(int a){return a+1;}
+int p1402(int a){return a+1;}
+int p1403(int a){return a+1;}
+int p1404(int a){return a+1;}
+int p1405(int a){return a+1;}
+int p1406(int a){return a+1;}
+int p1407(int a){return a+1;}
+int p1408(int a){return a+1;}
+int p1409(int a){return a+1;}
+int p1410(int a){return a+1;}
+int p1411(int a){return a+1;}
+int p1412(int a){return a+1;}
+int p1413(int a){return a+1;}
+int p1414(int a){return a+1;}
+int p1415(int a){return a+1;}
+int p1416(int a){return a+1;}
+int p1417(int a){return a+1;}
+int p1418(int a){return a+1;}
+int p1419(int a){return a+1;}
+int p1420(int a){return a+1;}
+int p1421(int a){return a+1;}
+int p1422(int a){return a+1;}
+int p1423(int a){return a+1;}
+int p1424(int a){return a+1;}
+int p1425(int a){return a+1;}
+int p1426(int a){return a+1;}
+int p1427(int a){return a+1;}
+int p1428(int a){return a+1;}
+int p1429(int a){return a+1;}
+int p1430(int a){return a+1;}
+int p1431(int a){return a+1;}
+int p1432(int a){return a+1;}
+int p1433(int a){return a+1;}
+int p1434(int a){return a+1;}
+int p1435(int a){return a+1;}
+int p1436(int a){return a+1;}
+int p1437(int a){return a+1;}
+int p1438(int a){return a+1;}
+int p1439(int a){return a+1;}
+int p1440(int a){return a+1;}
+int p1441(int a){return a+1;}
+int p1442(int a){return a+1;}
+int p1443(int a){return a+1;}
+int p1444(int a){return a+1;}
+int p1445(int a){return a+1;}
+int p1446(int a){return a+1;}
+int p1447(int a){return a+1;}
+int p1448(int a){return a+1;}
+int p1449(int a){return a+1;}
+int p1450(int a){return a+1;}
+int p1451(int a){return a+1;}
+int p1452(int a){return a+1;}
+int p1453(int a){return a+1;}
+int p1454(int a){return a+1;}
+int p1455(int a){return a+1;}
+int p1456(int a){return a+1;}
+int p1457(int a){return a+1;}
+int p1458(int a){return a+1;}
+int p1459(int a){return a+1;}
+int p1460(int a){return a+1;}
+int p1461(int a){return a+1;}
+int p1462(int a){return a+1;}
+int p1463(int a){return a+1;}
+int p1464(int a){return a+1;}
+int p1465(int a){return a+1;}
+int p1466(int a){return a+1;}
+int p1467(int a){return a+1;}
+int p1468(int a){return a+1;}
+int p1469(int a){return a+1;}
+int p1470(int a){return a+1;}
+int p1471(int a){return a+1;}
+int p1472(int a){return a+1;}
+int p1473(int a){return a+1;}
+int p1474(int a){return a+1;}
+int p1475(int a){return a+1;}
+int p1476(int a){return a+1;}
+int p1477(int a){return a+1;}
+int p1478(int a){return a+1;}
+int p1479(int a){return a+1;}
+int p1480(int a){return a+1;}
+int p1481(int a){return a+1;}
+int p1482(int a){return a+1;}
+int p1483(int a){return a+1;}
+int p1484(int a){return a+1;}
+int p1485(int a){return a+1;}
+int p1486(int a){return a+1;}
+int p1487(int a){return a+1;}
+int p1488(int a){return a+1;}
+int p1489(int a){return a+1;}
+int p1490(int a){return a+1;}
+int p1491(int a){return a+1;}
+int p1492(int a){return a+1;}
+int p1493(int a){return a+1;}
+int p1494(int a){return a+1;}
+int p1495(int a){return a+1;}
+int p1496(int a){return a+1;}
+int p1497(int a){return a+1;}
+int p1498(int a){return a+1;}
+int p1499(int a){return a+1;}
+int p1500(int a){return a+1;}
+int p1501(int a){return a+1;}
+int p1502(int a){return a+1;}
+int p1503(int a){return a+1;}
+int p1504(int a){return a+1;}
+int p1505(int a){return a+1;}
+int p1506(int a){return a+1;}
+int p1507(int a){return a+1;}
+int p1508(int a){return a+1;}
+int p1509(int a){return a+1;}
+int p1510(int a){return a+1;}
+int p1511(int a){return a+1;}
+int p1512(int a){return a+1;}
+int p1513(int a){return a+1;}
+int p1514(int a){return a+1;}
+int p1515(int a){return a+1;}
+int p1516(int a){return a+1;}
+int p1517(int a){return a+1;}
+int p1518(int a){return a+1;}
+int p1519(int a){return a+1;}
+int p1520(int a){return a+1;}
+int p1521(int a){return a+1;}
+int p1522(int a){return a+1;}
+int p1523(int a){return a+1;}
+int p1524(int a){return a+1;}
+int p1525(int a){return a+1;}
+int p1526(int a){return a+1;}
+int p1527(int a){return a+1;}
+int p1528(int a){return a+1;}
+int p1529(int a){return a+1;}
+int p1530(int a){return a+1;}
+int p1531(int a){return a+1;}
+int p1532(int a){return a+1;}
+int p1533(int a){return a+1;}
+int p1534(int a){return a+1;}
+int p1535(int a){return a+1;}
+int p1536(int a){return a+1;}
+int p1537(int a){return a+1;}
+int p1538(int a){return a+1;}
+int p1539(int a){return a+1;}
+int p1540(int a){return a+1;}
+int p1541(int a){return a+1;}
+int p1542(int a){return a+1;}
+int p1543(int a){return a+1;}
+int p1544(int a){return a+1;}
+int p1545(int a){return a+1;}
+int p1546(int a){return a+1;}
+int p1547(int a){return a+1;}
+int p1548(int a){return a+1;}
+int p1549(int a){return a+1;}
+int p1550(int a){return a+1;}
+int p1551(int a){return a+1;}
+int p1552(int a){return a+1;}
+int p1553(int a){return a+1;}
+int p1554(int a){return a+1;}
+int p1555(int a){return a+1;}
+int p1556(int a){return a+1;}
+int p1557(int a){return a+1;}
+int p1558(int a){return a+1;}
+int p1559(int a){return a+1;}
+int p1560(int a){return a+1;}
+int p1561(int a){return a+1;}
+int p1562(int a){return a+1;}
+int p1563(int a){return a+1;}
+int p1564(int a){return a+1;}
+int p1565(int a){return a+1;}
+int p1566(int a){return a+1;}
+int p1567(int a){return a+1;}
+int p1568(int a){return a+1;}
+int p1569(int a){return a+1;}
+int p1570(int a){return a+1;}
+int p1571(int a){return a+1;}
+int p1572(int a){return a+1;}
+int p1573(int a){return a+1;}
+int p1574(int a){return a+1;}
+int p1575(int a){return a+1;}
+int p1576(int a){return a+1;}
+int p1577(int a){return a+1;}
+int p1578(int a){return a+1;}
+int p1579(int a){return a+1;}
+int p1580(int a){return a+1;}
+int p1581(int a){return a+1;}
+int p1582(int a){return a+1;}
+int p1583(int a){return a+1;}
+int p1584(int a){return a+1;}
+int p1585(int a){return a+1;}
+int p1586(int a){return a+1;}
+int p1587(int a){return a+1;}
+int p1588(int a){return a+1;}
+int p1589(int a){return a+1;}
+int p1590(int a){return a+1;}
+int p1591(int a){return a+1;}
+int p1592(int a){return a+1;}
+int p1593(int a){return a+1;}
+int p1594(int a){return a+1;}
+int p1595(int a){return a+1;}
+int p1596(int a){return a+1;}
+int p1597(int a){return a+1;}
+int p1598(int a){return a+1;}
+int p1599(int a){return a+1;}
+int p1600(int a){return a+1;}
+int p1601(int a){return a+1;}
+int p1602(int a){return a+1;}
+int p1603(int a){return a+1;}
+int p1604(int a){return a+1;}
+int p1605(int a){return a+1;}
+int p1606(int a){return a+1;}
+int p1607(int a){return a+1;}
+int p1608(int a){return a+1;}
+int p1609(int a){return a+1;}
+int p1610(int a){return a+1;}
+int p1611(int a){return a+1;}
+int p1612(int a){return a+1;}
+int p1613(int a){return a+1;}
+int p1614(int a){return a+1;}
+int p1615(int a){return a+1;}
+int p1616(int a){return a+1;}
+int p1617(int a){return a+1;}
+int p1618(int a){return a+1;}
+int p1619(int a){return a+1;}
+int p1620(int a){return a+1;}
+int p1621(int a){return a+1;}
+int p1622(int a){return a+1;}
+int p1623(int a){return a+1;}
+int p1624(int a){return a+1;}
+int p1625(int a){return a+1;}
+int p1626(int a){return a+1;}
+int p1627(int a){return a+1;}
+int p1628(int a){return a+1;}
+int p1629(int a){return a+1;}
+int p1630(int a){return a+1;}
+int p1631(int a){return a+1;}
+int p1632(int a){return a+1;}
+int p1633(int a){return a+1;}
+int p1634(int a){return a+1;}
+int p1635(int a){return a+1;}
+int p1636(int a){return a+1;}
+int p1637(int a){return a+1;}
+int p1638(int a){return a+1;}
+int p1639(int a){return a+1;}
+int p1640(int a){return a+1;}
+int p1641(int a){return a+1;}
+int p1642(int a){return a+1;}
+int p1643(int a){return a+1;}
+int p1644(int a){return a+1;}
+int p1645(int a){return a+1;}
+int p1646(int a){return a+1;}
+int p1647(int a){return a+1;}
+int p1648(int a){return a+1;}
+int p1649(int a){return a+1;}
+int p1650(int a){return a+1;}
+int p1651(int a){return a+1;}
+int p1652(int a){return a+1;}
+int p1653(int a){return a+1;}
+int p1654(int a){return a+1;}
+int p1655(int a){return a+1;}
+int p1656(int a){return a+1;}
+int p1657(int a){return a+1;}
+int p1658(int a){return a+1;}
+int p1659(int a){return a+1;}
+int p1660(int a){return a+1;}
+int p1661(int a){return a+1;}
+int p1662(int a){return a+1;}
+int p1663(int a){return a+1;}
+int p1664(int a){return a+1;}
+int p1665(int a){return a+1;}
+int p1666(int a){return a+1;}
+int p1667(int a){return a+1;}
+int p1668(int a){return a+1;}
+int p1669(int a){return a+1;}
+int p1670(int a){return a+1;}
+int p1671(int a){return a+1;}
+int p1672(int a){return a+1;}
+int p1673(int a){return a+1;}
+int p1674(int a){return a+1;}
+int p1675(int a){return a+1;}
+int p1676(int a){return a+1;}
+int p1677(int a){return a+1;}
+int p1678(int a){return a+1;}
+int p1679(int a){return a+1;}
+int p1680(int a){return a+1;}
+int p1681(int a){return a+1;}
+int p1682(int a){return a+1;}
+int p1683(int a){return a+1;}
+int p1684(int a){return a+1;}
+int p1685(int a){return a+1;}
+int p1686(int a){return a+1;}
+int p1687(int a){return a+1;}
+int p1688(int a){return a+1;}
+int p1689(int a){return a+1;}
+int p1690(int a){return a+1;}
+int p1691(int a){return a+1;}
+int p1692(int a){return a+1;}
+int p1693(int a){return a+1;}
+int p1694(int a){return a+1;}
+int p1695(int a){return a+1;}
+int p1696(int a){return a+1;}
+int p1697(int a){return a+1;}
+int p1698(int a){return a+1;}
+int p1699(int a){return a+1;}
+int p1700(int a){return a+1;}
+int p1701(int a){return a+1;}
+int p1702(int a){return a+1;}
+int p1703(int a){return a+1;}
+int p1704(int a){return a+1;}
+int p1705(int a){return a+1;}
+int p1706(int a){return a+1;}
+int p1707(int a){return a+1;}
+int p1708(int a){return a+1;}
+int p1709(int a){return a+1;}
+int p1710(int a){return a+1;}
+int p1711(int a){return a+1;}
+int p1712(int a){return a+1;}
+int p1713(int a){return a+1;}
+int p1714(int a){return a+1;}
+int p1715(int a){return a+1;}
+int p1716(int a){return a+1;}
+int p1717(int a){return a+1;}
+int p1718(int a){return a+1;}
+int p1719(int a){return a+1;}
+int p1720(int a){return a+1;}
+int p1721(int a){return a+1;}
+int p1722(int a){return a+1;}
+int p1723(int a){return a+1;}
+int p1724(int a){return a+1;}
+int p1725(int a){return a+1;}
+int p1726(int a){return a+1;}
+int p1727(int a){return a+1;}
+int p1728(int a){return a+1;}
+int p1729(int a){return a+1;}
+int p1730(int a){return a+1;}
+int p1731(int a){return a+1;}
+int p1732(int a){return a+1;}
+int p1733(int a){return a+1;}
+int p1734(int a){return a+1;}
+int p1735(int a){return a+1;}
+int p1736(int a){return a+1;}
+int p1737(int a){return a+1;}
+int p1738(int a){return a+1;}
+int p1739(int a){return a+1;}
+int p1740(int a){return a+1;}
+int p1741(int a){return a+1;}
+int p1742(int a){return a+1;}
+int p1743(int a){return a+1;}
+int p1744(int a){return a+1;}
+int p1745(int a){return a+1;}
+int p1746(int a){return a+1;}
+int p1747(int a){return a+1;}
+int p1748(int a){return a+1;}
+int p1749(int a){return a+1;}
+int p1750(int a){return a+1;}
+int p1751(int a){return a+1;}
+int p1752(int a){return a+1;}
+int p1753(int a){return a+1;}
+int p1754(int a){return a+1;}
+int p1755(int a){return a+1;}
+int p1756(int a){return a+1;}
+int p1757(int a){return a+1;}
+int p1758(int a){return a+1;}
+int p1759(int a){return a+1;}
+int p1760(int a){return a+1;}
+int p1761(int a){return a+1;}
+int p1762(int a){return a+1;}
+int p1763(int a){return a+1;}
+int p1764(int a){return a+1;}
+int p1765(int a){return a+1;}
+int p1766(int a){return a+1;}
+int p1767(int a){return a+1;}
+int p1768(int a){return a+1;}
+int p1769(int a){return a+1;}
+int p1770(int a){return a+1;}
+int p1771(int a){return a+1;}
+int p1772(int a){return a+1;}
+int p1773(int a){return a+1;}
+int p1774(int a){return a+1;}
+int p1775(int a){return a+1;}
+int p1776(int a){return a+1;}
+int p1777(int a){return a+1;}
+int p1778(int a){return a+1;}
+int p1779(int a){return a+1;}
+int p1780(int a){return a+1;}
+int p1781(int a){return a+1;}
+int p1782(int a){return a+1;}
+int p1783(int a){return a+1;}
+int p1784(int a){return a+1;}
+int p1785(int a){return a+1;}
+int p1786(int a){return a+1;}
+int p1787(int a){return a+1;}
+int p1788(int a){return a+1;}
+int p1789(int a){return a+1;}
+int p1790(int a){return a+1;}
+int p1791(int a){return a+1;}
+int p1792(int a){return a+1;}
+int p1793(int a){return a+1;}
+int p1794(int a){return a+1;}
+int p1795(int a){return a+1;}
+int p1796(int a){return a+1;}
+int p1797(int a){return a+1;}
+int p1798(int a){return a+1;}
+int p1799(int a){return a+1;}
+int p1800(int a){return a+1;}
+int p1801(int a){return a+1;}
+int p1802(int a){return a+1;}
+int p1803(int a){return a+1;}
+int p1804(int a){return a+1;}
+int p1805(int a){return a+1;}
+int p1806(int a){return a+1;}
+int p1807(int a){return a+1;}
+int p1808(int a){return a+1;}
+int p1809(int a){return a+1;}
+int p1810(int a){return a+1;}
+int p1811(int a){return a+1;}
+int p1812(int a){return a+1;}
+int p1813(int a){return a+1;}
+int p1814(int a){return a+1;}
+int p1815(int a){return a+1;}
+int p1816(int a){return a+1;}
+int p1817(int a){return a+1;}
+int p1818(int a){return a+1;}
+int p1819(int a){return a+1;}
+int p1820(int a){return a+1;}
+int p1821(int a){return a+1;}
+int p1822(int a){return a+1;}
+int p1823(int a){return a+1;}
+int p1824(int a){return a+1;}
+int p1825(int a){return a+1;}
+int p1826(int a){return a+1;}
+int p1827(int a){return a+1;}
+int p1828(int a){return a+1;}
+int p1829(int a){return a+1;}
+int p1830(int a){return a+1;}
+int p1831(int a){return a+1;}
+int p1832(int a){return a+1;}
+int p1833(int a){return a+1;}
+int p1834(int a){return a+1;}
+int p1835(int a){return a+1;}
+int p1836(int a){return a+1;}
+int p1837(int a){return a+1;}
+int p1838(int a){return a+1;}
+int p1839(int a){return a+1;}
+int p1840(int a){return a+1;}
+int p1841(int a){return a+1;}
+int p1842(int a){return a+1;}
+int p1843(int a){return a+1;}
+int p1844(int a){return a+1;}
+int p1845(int a){return a+1;}
+int p1846(int a){return a+1;}
+int p1847(int a){return a+1;}
+int p1848(int a){return a+1;}
+int p1849(int a){return a+1;}
+int p1850(int a){return a+1;}
+int p1851(int a){return a+1;}
+int p1852(int a){return a+1;}
+int p1853(int a){return a+1;}
+int p1854(int a){return a+1;}
+int p1855(int a){return a+1;}
+int p1856(int a){return a+1;}
+int p1857(int a){return a+1;}
+int p1858(int a){return a+1;}
+int p1859(int a){return a+1;}
+int p1860(int a){return a+1;}
+int p1861(int a){return a+1;}
+int p1862(int a){return a+1;}
+int p1863(int a){return a+1;}
+int p1864(int a){return a+1;}
+int p1865(int a){return a+1;}
+int p1866(int a){return a+1;}
+int p1867(int a){return a+1;}
+int p1868(int a){return a+1;}
+int p1869(int a){return a+1;}
+int p1870(int a){return a+1;}
+int p1871(int a){return a+1;}
+int p1872(int a){return a+1;}
+int p1873(int a){return a+1;}
+int p1874(int a){return a+1;}
+int p1875(int a){return a+1;}
+int p1876(int a){return a+1;}
+int p1877(int a){return a+1;}
+int p1878(int a){return a+1;}
+int p1879(int a){return a+1;}
+int p1880(int a){return a+1;}
+int p1881(int a){return a+1;}
+int p1882(int a){return a+1;}
+int p1883(int a){return a+1;}
+int p1884(int a){return a+1;}
+int p1885(int a){return a+1;}
+int p1886(int a){return a+1;}
+int p1887(int a){return a+1;}
+int p1888(int a){return a+1;}
+int p1889(int a){return a+1;}
+int p1890(int a){return a+1;}
+int p1891(int a){return a+1;}
+int p1892(int a){return a+1;}
+int p1893(int a){return a+1;}
+int p1894(int a){return a+1;}
+int p1895(int a){return a+1;}
+int p1896(int a){return a+1;}
+int p1897(int a){return a+1;}
+int p1898(int a){return a+1;}
+int p1899(int a){return a+1;}
+int p1900(int a){return a+1;}
+int p1901(int a){return a+1;}
+int p1902(int a){return a+1;}
+int p1903(int a){return a+1;}
+int p1904(int a){return a+1;}
+int p1905(int a){return a+1;}
+int p1906(int a){return a+1;}
+int p1907(int a){return a+1;}
+int p1908(int a){return a+1;}
+int p1909(int a){return a+1;}
+int p1910(int a){return a+1;}
+int p1911(int a){return a+1;}
+int p1912(int a){return a+1;}
+int p1913(int a){return a+1;}
+int p1914(int a){return a+1;}
+int p1915(int a){return a+1;}
+int p1916(int a){return a+1;}
+int p1917(int a){return a+1;}
+int p1918(int a){return a+1;}
+int p1919(int a){return a+1;}
+int p1920(int a){return a+1;}
+int p1921(int a){return a+1;}
+int p1922(int a){return a+1;}
+int p1923(int a){return a+1;}
+int p1924(int a){return a+1;}
+int p1925(int a){return a+1;}
+int p1926(int a){return a+1;}
+int p1927(int a){return a+1;}
+int p1928(int a){return a+1;}
+int p1929(int a){return a+1;}
+int p1930(int a){return a+1;}
+int p1931(int a){return a+1;}
+int p1932(int a){return a+1;}
+int p1933(int a){return a+1;}
+int p1934(int a){return a+1;}
+int p1935(int a){return a+1;}
+int p1936(int a){return a+1;}
+int p1937(int a){return a+1;}
+int p1938(int a){return a+1;}
+int p1939(int a){return a+1;}
+int p1940(int a){return a+1;}
+int p1941(int a){return a+1;}
+int p1942(int a){return a+1;}
+int p1943(int a){return a+1;}
+int p1944(int a){return a+1;}
+int p1945(int a){return a+1;}
+int p1946(int a){return a+1;}
+int p1947(int a){return a+1;}
+int p1948(int a){return a+1;}
+int p1949(int a){return a+1;}
+int p1950(int a){return a+1;}
+int p1951(int a){return a+1;}
+int p1952(int a){return a+1;}
+int p1953(int a){return a+1;}
+int p1954(int a){return a+1;}
+int p1955(int a){return a+1;}
+int p1956(int a){return a+1;}
+int p1957(int a){return a+1;}
+int p1958(int a){return a+1;}
+int p1959(int a){return a+1;}
+int p1960(int a){return a+1;}
+int p1961(int a){return a+1;}
+int p1962(int a){return a+1;}
+int p1963(int a){return a+1;}
+int p1964(int a){return a+1;}
+int p1965(int a){return a+1;}
+int p1966(int a){return a+1;}
+int p1967(int a){return a+1;}
+int p1968(int a){return a+1;}
+int p1969(int a){return a+1;}
+int p1970(int a){return a+1;}
+int p1971(int a){return a+1;}
+int p1972(int a){return a+1;}
+int p1973(int a){return a+1;}
+int p1974(int a){return a+1;}
+int p1975(int a){return a+1;}
+int p1976(int a){return a+1;}
+int p1977(int a){return a+1;}
+int p1978(int a){return a+1;}
+int p1979(int a){return a+1;}
+int p1980(int a){return a+1;}
+int p1981(int a){return a+1;}
+int p1982(int a){return a+1;}
+int p1983(int a){return a+1;}
+int p1984(int a){return a+1;}
+int p1985(int a){return a+1;}
+int p1986(int a){return a+1;}
+int p1987(int a){return a+1;}
+int p1988(int a){return a+1;}
+int p1989(int a){return a+1;}
+int p1990(int a){return a+1;}
+int p1991(int a){return a+1;}
+int p1992(int a){return a+1;}
+int p1993(int a){return a+1;}
+int p1994(int a){return a+1;}
+int p1995(int a){return a+1;}
+int p1996(int a){return a+1;}
+int p1997(int a){return a+1;}
+int p1998(int a){return a+1;}
+int p1999(int a){return a+1;}
+void main(){int x;
+x=p0(0);
+x=p1(1);
+x=p2(2);
+x=p3(3);
+x=p4(4);
+x=p5(5);
+x=p6(6);
+x=p7(0);
+x=p8(1);
+x=p9(2);
+x=p10(3);
+x=p11(4);
+x=p12(5);
+x=p13(6);
+x=p14(0);
+x=p15(1);
+x=p16(2);
+x=p17(3);
+x=p18(4);
+x=p19(5);
+x=p20(6);
+x=p21(0);
+x=p22(1);
+x=p23(2);
+x=p24(3);
+x=p25(4);
+x=p26(5);
+x=p27(6);
+x=p28(0);
+x=p29(1);
+x=p30(2);
+x=p31(3);
+x=p32(4);
+x=p33(5);
+x=p34(6);
+x=p35(0);
+x=p36(1);
+x=p37(2);
+x=p38(3);
+x=p39(4);
+x=p40(5);
+x=p41(6);
+x=p42(0);
+x=p43(1);
+x=p44(2);
+x=p45(3);
+x=p46(4);
+x=p47(5);
+x=p48(6);
+x=p49(0);
+x=p50(1);
+x=p51(2);
+x=p52(3);
+x=p53(4);
+x=p54(5);
+x=p55(6);
+x=p56(0);
+x=p57(1);
+x=p58(2);
+x=p59(3);
+x=p60(4);
+x=p61(5);
+x=p62(6);
+x=p63(0);
+x=p64(1);
+x=p65(2);
+x=p66(3);
+x=p67(4);
+x=p68(5);
+x=p69(6);
+x=p70(0);
+x=p71(1);
+x=p72(2);
+x=p73(3);
+x=p74(4);
+x=p75(5);
+x=p76(6);
+x=p77(0);
+x=p78(1);
+x=p79(2);
+x=p80(3);
+x=p81(4);
+x=p82(5);
+x=p83(6);
+x=p84(0);
+x=p85(1);
+x=p86(2);
+x=p87(3);
+x=p88(4);
+x=p89(5);
+x=p90(6);
+x=p91(0);
+x=p92(1);
+x=p93(2);
+x=p94(3);
+x=p95(4);
+x=p96(5);
+x=p97(6);
+x=p98(0);
+x=p99(1);
+x=p100(2);
+x=p101(3);
+x=p102(4);
+x=p103(5);
+x=p104(6);
+x=p105(0);
+x=p106(1);
+x=p107(2);
+x=p108(3);
+x=p109(4);
+x=p110(5);
+x=p111(6);
+x=p112(0);
+x=p113(1);
+x=p114(2);
+x=p115(3);
+x=p116(4);
+x=p117(5);
+x=p118(6);
+x=p119(0);
+x=p120(1);
+x=p121(2);
+x=p122(3);
+x=p123(4);
+x=p124(5);
+x=p125(6);
+x=p126(0);
+x=p127(1);
+x=p128(2);
+x=p129(3);
+x=p130(4);
+x=p131(5);
+x=p132(6);
+x=p133(0);
+x=p134(1);
+x=p135(2);
+x=p136(3);
+x=p137(4);
+x=p138(5);
+x=p139(6);
+x=p140(0);
+x=p141(1);
+x=p142(2);
+x=p143(3);
+x=p144(4);
+x=p145(5);
+x=p146(6);
+x=p147(0);
+x=p148(1);
+x=p149(2);
+x=p150(3);
+x=p151(4);
+x=p152(5);
+x=p153(6);
+x=p154(0);
+x=p155(1);
+x=p156(2);
+x=p157(3);
+x=p158(4);
+x=p159(5);
+x=p160(6);
+x=p161(0);
+x=p162(1);
+x=p163(2);
+x=p164(3);
+x=p165(4);
+x=p166(5);
+x=p167(6);
+x=p168(0);
+x=p169(1);
+x=p170(2);
+x=p171(3);
+x=p172(4);
+x=p173(5);
+x=p174(6);
+x=p175(0);
+x=p176(1);
+x=p177(2);
+x=p178(3);
+x=p179(4);
+x=p180(5);
+x=p181(6);
+x=p182(0);
+x=p183(1);
+x=p184(2);
+x=p185(3);
+x=p186(4);
+x=p187(5);
+x=p188(6);
+x=p189(0);
+x=p190(1);
+x=p191(2);
+x=p192(3);
+x=p193(4);
+x=p194(5);
+x=p195(6);
+x=p196(0);
+x=p197(1);
+x=p198(2);
+x=p199(3);
+x=p200(4);
+x=p201(5);
+x=p202(6);
+x=p203(0);
+x=p204(1);
+x=p205(2);
+x=p206(3);
+x=p207(4);
+x=p208(5);
+x=p209(6);
+x=p210(0);
+x=p211(1);
+x=p212(2);
+x=p213(3);
+x=p214(4);
+x=p215(5);
+x=p216(6);
+x=p217(0);
+x=p218(1);
+x=p219(2);
+x=p220(3);
+x=p221(4);
+x=p222(5);
+x=p223(6);
+x=p224(0);
+x=p225(1);
+x=p226(2);
+x=p227(3);
+x=p228(4);
+x=p229(5);
+x=p230(6);
+x=p231(0);
+x=p232(1);
+x=p233(2);
+x=p234(3);
+x=p235(4);
+x=p236(5);
+x=p237(6);
+x=p238(0);
+x=p239(1);
+x=p240(2);
+x=p241(3);
+x=p242(4);
+x=p243(5);
+x=p244(6);
+x=p245(0);
+x=p246(1);
+x=p247(2);
+x=p248(3);
+x=p249(4);
+x=p250(5);
+x=p251(6);
+x=p252(0);
+x=p253(1);
+x=p254(2);
+x=p255(3);
+x=p256(4);
+x=p257(5);
+x=p258(6);
+x=p259(0);
+x=p260(1);
+x=p261(2);
+x=p262(3);
+x=p263(4);
+x=p264(5);
+x=p265(6);
+x=p266(0);
+x=p267(1);
+x=p268(2);
+x=p269(3);
+x=p270(4);
+x=p271(5);
+x=p272(6);
+x=p273(0);
+x=p274(1);
+x=p275(2);
+x=p276(3);
+x=p277(4);
+x=p278(5);
+x=p279(6);
+x=p280(0);
+x=p281(1);
+x=p282(2);
+x=p283(3);
+x=p284(4);
+x=p285(5);
+x=p286(6);
+x=p287(0);
+x=p288(1);
+x=p289(2);
+x=p290(3);
+x=p291(4);
+x=p292(5);
+x=p293(6);
+x=p294(0);
+x=p295(1);
+x=p296(2);
+x=p297(3);
+x=p298(4);
+x=p299(5);
+x=p300(6);
+x=p301(0);
+x=p302(1);
+x=p303(2);
+x=p304(3);
+x=p305(4);
+x=p306(5);
+x=p307(6);
+x=p308(0);
+x=p309(1);
+x=p310(2);
+x=p311(3);
+x=p312(4);
+x=p313(5);
+x=p314(6);
+x=p315(0);
+x=p316(1);
+x=p317(2);
+x=p318(3);
+x=p319(4);
+x=p320(5);
+x=p321(6);
+x=p322(0);
+x=p323(1);
+x=p324(2);
+x=p325(3);
+x=p326(4);
+x=p327(5);
+x=p328(6);
+x=p329(0);
+x=p330(1);
+x=p331(2);
+x=p332(3);
+x=p333(4);
+x=p334(5);
+x=p335(6);
+x=p336(0);
+x=p337(1);
+x=p338(2);
+x=p339(3);
+x=p340(4);
+x=p341(5);
+x=p342(6);
+x=p343(0);
+x=p344(1);
+x=p345(2);
+x=p346(3);
+x=p347(4);
+x=p348(5);
+x=p349(6);
+x=p350(0);
+x=p351(1);
+x=p352(2);
+x=p353(3);
+x=p354(4);
+x=p355(5);
+x=p356(6);
+x=p357(0);
+x=p358(1);
+x=p359(2);
+x=p360(3);
+x=p361(4);
+x=p362(5);
+x=p363(6);
+x=p364(0);
+x=p365(1);
+x=p366(2);
+x=p367(3);
+x=p368(4);
+x=p369(5);
+x=p370(6);
+x=p371(0);
+x=p372(1);
+x=p373(2);
+x=p374(3);
+x=p375(4);
+x=p376(5);
+x=p377(6);
+x=p378(0);
+x=p379(1);
+x=p380(2);
+x=p381(3);
+x=p382(4);
+x=p383(5);
+x=p384(6);
+x=p385(0);
+x=p386(1);
+x=p387(2);
+x=p388(3);
+x=p389(4);
+x=p390(5);
+x=p391(6);
+x=p392(0);
+x=p393(1);
+x=p394(2);
+x=p395(3);
+x=p396(4);
+x=p397(5);
+x=p398(6);
+x=p399(0);
+x=p400(1);
+x=p401(2);
+x=p402(3);
+x=p403(4);
+x=p404(5);
+x=p405(6);
+x=p406(0);
+x=p407(1);
+x=p408(2);
+x=p409(3);
+x=p410(4);
+x=p411(5);
+x=p412(6);
+x=p413(0);
+x=p414(1);
+x=p415(2);
+x=p416(3);
+x=p417(4);
+x=p418(5);
+x=p419(6);
+x=p420(0);
+x=p421(1);
+x=p422(2);
+x=p423(3);
+x=p424(4);
+x=p425(5);
+x=p426(6);
+x=p427(0);
+x=p428(1);
+x=p429(2);
+x=p430(3);
+x=p431(4);
+x=p432(5);
+x=p433(6);
+x=p434(0);
+x=p435(1);
+x=p436(2);
+x=p437(3);
+x=p438(4);
+x=p439(5);
+x=p440(6);
+x=p441(0);
+x=p442(1);
+x=p443(2);
+x=p444(3);
+x=p445(4);
+x=p446(5);
+x=p447(6);
+x=p448(0);
+x=p449(1);
+x=p450(2);
+x=p451(3);
+x=p452(4);
+x=p453(5);
+x=p454(6);
+x=p455(0);
+x=p456(1);
+x=p457(2);
+x=p458(3);
+x=p459(4);
+x=p460(5);
+x=p461(6);
+x=p462(0);
+x=p463(1);
+x=p464(2);
+x=p465(3);
+x=p466(4);
+x=p467(5);
+x=p468(6);
+x=p469(0);
+x=p470(1);
+x=p471(2);
+x=p472(3);
+x=p473(4);
+x=p474(5);
+x=p475(6);
+x=p476(0);
+x=p477(1);
+x=p478(2);
+x=p479(3);
+x=p480(4);
+x=p481(5);
+x=p482(6);
+x=p483(0);
+x=p484(1);
+x=p485(2);
+x=p486(3);
+x=p487(4);
+x=p488(5);
+x=p489(6);
+x=p490(0);
+x=p491(1);
+x=p492(2);
+x=p493(3);
+x=p494(4);
+x=p495(5);
+x=p496(6);
+x=p497(0);
+x=p498(1);
+x=p499(2);
+x=p500(3);
+x=p501(4);
+x=p502(5);
+x=p503(6);
+x=p504(0);
+x=p505(1);
+x=p506(2);
+x=p507(3);
+x=p508(4);
+x=p509(5);
+x=p510(6);
+x=p511(0);
+x=p512(1);
+x=p513(2);
+x=p514(3);
+x=p515(4);
+x=p516(5);
+x=p517(6);
+x=p518(0);
+x=p519(1);
+x=p520(2);
+x=p521(3);
+x=p522(4);
+x=p523(5);
+x=p524(6);
+x=p525(0);
+x=p526(1);
+x=p527(2);
+x=p528(3);
+x=p529(4);
+x=p530(5);
+x=p531(6);
+x=p532(0);
+x=p533(1);
+x=p534(2);
+x=p535(3);
+x=p536(4);
+x=p537(5);
+x=p538(6);
+x=p539(0);
+x=p540(1);
+x=p541(2);
+x=p542(3);
+x=p543(4);
+x=p544(5);
+x=p545(6);
+x=p546(0);
+x=p547(1);
+x=p548(2);
+x=p549(3);
+x=p550(4);
+x=p551(5);
+x=p552(6);
+x=p553(0);
+x=p554(1);
+x=p555(2);
+x=p556(3);
+x=p557(4);
+x=p558(5);
+x=p559(6);
+x=p560(0);
+x=p561(1);
+x=p562(2);
+x=p563(3);
+x=p564(4);
+x=p565(5);
+x=p566(6);
+x=p567(0);
+x=p568(1);
+x=p569(2);
+x=p570(3);
+x=p571(4);
+x=p572(5);
+x=p573(6);
+x=p574(0);
+x=p575(1);
+x=p576(2);
+x=p577(3);
+x=p578(4);
+x=p579(5);
+x=p580(6);
+x=p581(0);
+x=p582(1);
+x=p583(2);
+x=p584(3);
+x=p585(4);
+x=p586(5);
+x=p587(6);
+x=p588(0);
+x=p589(1);
+x=p590(2);
+x=p591(3);
+x=p592(4);
+x=p593(5);
+x=p594(6);
+x=p595(0);
+x=p596(1);
+x=p597(2);
+x=p598(3);
+x=p599(4);
+x=p600(5);
+x=p601(6);
+x=p602(0);
+x=p603(1);
+x=p604(2);
+x=p605(3);
+x=p606(4);
+x=p607(5);
+x=p608(6);
+x=p609(0);
+x=p610(1);
+x=p611(2);
+x=p612(3);
+x=p613(4);
+x=p614(5);
+x=p615(6);
+x=p616(0);
+x=p617(1);
+x=p618(2);
+x=p619(3);
+x=p620(4);
+x=p621(5);
+x=p622(6);
+x=p623(0);
+x=p624(1);
+x=p625(2);
+x=p626(3);
+x=p627(4);
+x=p628(5);
+x=p629(6);
+x=p630(0);
+x=p631(1);
+x=p632(2);
+x=p633(3);
+x=p634(4);
+x=p635(5);
+x=p636(6);
+x=p637(0);
+x=p638(1);
+x=p639(2);
+x=p640(3);
+x=p641(4);
+x=p642(5);
+x=p643(6);
+x=p644(0);
+x=p645(1);
+x=p646(2);
+x=p647(3);
+x=p648(4);
+x=p649(5);
+x=p650(6);
+x=p651(0);
+x=p652(1);
+x=p653(2);
+x=p654(3);
+x=p655(4);
+x=p656(5);
+x=p657(6);
+x=p658(0);
+x=p659(1);
+x=p660(2);
+x=p661(3);
+x=p662(4);
+x=p663(5);
+x=p664(6);
+x=p665(0);
+x=p666(1);
+x=p667(2);
+x=p668(3);
+x=p669(4);
+x=p670(5);
+x=p671(6);
+x=p672(0);
+x=p673(1);
+x=p674(2);
+x=p675(3);
+x=p676(4);
+x=p677(5);
+x=p678(6);
+x=p679(0);
+x=p680(1);
+x=p681(2);
+x=p682(3);
+x=p683(4);
+x=p684(5);
+x=p685(6);
+x=p686(0);
+x=p687(1);
+x=p688(2);
+x=p689(3);
+x=p690(4);
+x=p691(5);
+x=p692(6);
+x=p693(0);
+x=p694(1);
+x=p695(2);
+x=p696(3);
+x=p697(4);
+x=p698(5);
+x=p699(6);
+x=p700(0);
+x=p701(1);
+x=p702(2);
+x=p703(3);
+x=p704(4);
+x=p705(5);
+x=p706(6);
+x=p707(0);
+x=p708(1);
+x=p709(2);
+x=p710(3);
+x=p711(4);
+x=p712(5);
+x=p713(6);
+x=p714(0);
+x=p715(1);
+x=p716(2);
+x=p717(3);
+x=p718(4);
+x=p719(5);
+x=p720(6);
+x=p721(0);
+x=p722(1);
+x=p723(2);
+x=p724(3);
+x=p725(4);
+x=p726(5);
+x=p727(6);
+x=p728(0);
+x=p729(1);
+x=p730(2);
+x=p731(3);
+x=p732(4);
+x=p733(5);
+x=p734(6);
+x=p735(0);
+x=p736(1);
+x=p737(2);
+x=p738(3);
+x=p739(4);
+x=p740(5);
+x=p741(6);
+x=p742(0);
+x=p743(1);
+x=p744(2);
+x=p745(3);
+x=p746(4);
+x=p747(5);
+x=p748(6);
+x=p749(0);
+x=p750(1);
+x=p751(2);
+x=p752(3);
+x=p753(4);
+x=p754(5);
+x=p755(6);
+x=p756(0);
+x=p757(1);
+x=p758(2);
+x=p759(3);
+x=p760(4);
+x=p761(5);
+x=p762(6);
+x=p763(0);
+x=p764(1);
+x=p765(2);
+x=p766(3);
+x=p767(4);
+x=p768(5);
+x=p769(6);
+x=p770(0);
+x=p771(1);
+x=p772(2);
+x=p773(3);
+x=p774(4);
+x=p775(5);
+x=p776(6);
+x=p777(0);
+x=p778(1);
+x=p779(2);
+x=p780(3);
+x=p781(4);
+x=p782(5);
+x=p783(6);
+x=p784(0);
+x=p785(1);
+x=p786(2);
+x=p787(3);
+x=p788(4);
+x=p789(5);
+x=p790(6);
+x=p791(0);
+x=p792(1);
+x=p793(2);
+x=p794(3);
+x=p795(4);
+x=p796(5);
+x=p797(6);
+x=p798(0);
+x=p799(1);
+x=p800(2);
+x=p801(3);
+x=p802(4);
+x=p803(5);
+x=p804(6);
+x=p805(0);
+x=p806(1);
+x=p807(2);
+x=p808(3);
+x=p809(4);
+x=p810(5);
+x=p811(6);
+x=p812(0);
+x=p813(1);
+x=p814(2);
+x=p815(3);
+x=p816(4);
+x=p817(5);
+x=p818(6);
+x=p819(0);
+x=p820(1);
+x=p821(2);
+x=p822(3);
+x=p823(4);
+x=p824(5);
+x=p825(6);
+x=p826(0);
+x=p827(1);
+x=p828(2);
+x=p829(3);
+x=p830(4);
+x=p831(5);
+x=p832(6);
+x=p833(0);
+x=p834(1);
+x=p835(2);
+x=p836(3);
+x=p837(4);
+x=p838(5);
+x=p839(6);
+x=p840(0);
+x=p841(1);
+x=p842(2);
+x=p843(3);
+x=p844(4);
+x=p845(5);
+x=p846(6);
+x=p847(0);
+x=p848(1);
+x=p849(2);
+x=p850(3);
+x=p851(4);
+x=p852(5);
+x=p853(6);
+x=p854(0);
+x=p855(1);
+x=p856(2);
+x=p857(3);
+x=p858(4);
+x=p859(5);
+x=p860(6);
+x=p861(0);
+x=p862(1);
+x=p863(2);
+x=p864(3);
+x=p865(4);
+x=p866(5);
+x=p867(6);
+x=p868(0);
+x=p869(1);
+x=p870(2);
+x=p871(3);
+x=p872(4);
+x=p873(5);
+x=p874(6);
+x=p875(0);
+x=p876(1);
+x=p877(2);
+x=p878(3);
+x=p879(4);
+x=p880(5);
+x=p881(6);
+x=p882(0);
+x=p883(1);
+x=p884(2);
+x=p885(3);
+x=p886(4);
+x=p887(5);
+x=p888(6);
+x=p889(0);
+x=p890(1);
+x=p891(2);
+x=p892(3);
+x=p893(4);
+x=p894(5);
+x=p895(6);
+x=p896(0);
+x=p897(1);
+x=p898(2);
+x=p899(3);
+x=p900(4);
+x=p901(5);
+x=p902(6);
+x=p903(0);
+x=p904(1);
+x=p905(2);
+x=p906(3);
+x=p907(4);
+x=p908(5);
+x=p909(6);
+x=p910(0);
+x=p911(1);
+x=p912(2);
+x=p913(3);
+x=p914(4);
+x=p915(5);
+x=p916(6);
+x=p917(0);
+x=p918(1);
+x=p919(2);
+x=p920(3);
+x=p921(4);
+x=p922(5);
+x=p923(6);
+x=p924(0);
+x=p925(1);
+x=p926(2);
+x=p927(3);
+x=p928(4);
+x=p929(5);
+x=p930(6);
+x=p931(0);
+x=p932(1);
+x=p933(2);
+x=p934(3);
+x=p935(4);
+x=p936(5);
+x=p937(6);
+x=p938(0);
+x=p939(1);
+x=p940(2);
+x=p941(3);
+x=p942(4);
+x=p943(5);
+x=p944(6);
+x=p945(0);
+x=p946(1);
+x=p947(2);
+x=p948(3);
+x=p949(4);
+x=p950(5);
+x=p951(6);
+x=p952(0);
+x=p953(1);
+x=p954(2);
+x=p955(3);
+x=p956(4);
+x=p957(5);
+x=p958(6);
+x=p959(0);
+x=p960(1);
+x=p961(2);
+x=p962(3);
+x=p963(4);
+x=p964(5);
+x=p965(6);
+x=p966(0);
+x=p967(1);
+x=p968(2);
+x=p969(3);
+x=p970(4);
+x=p971(5);
+x=p972(6);
+x=p973(0);
+x=p974(1);
+x=p975(2);
+x=p976(3);
+x=p977(4);
+x=p978(5);
+x=p979(6);
+x=p980(0);
+x=p981(1);
+x=p982(2);
+x=p983(3);
+x=p984(4);
+x=p985(5);
+x=p986(6);
+x=p987(0);
+x=p988(1);
+x=p989(2);
+x=p990(3);
+x=p991(4);
+x=p992(5);
+x=p993(6);
+x=p994(0);
+x=p995(1);
+x=p996(2);
+x=p997(3);
+x=p998(4);
+x=p999(5);
+x=p1000(6);
+x=p1001(0);
+x=p1002(1);
+x=p1003(2);
+x=p1004(3);
+x=p1005(4);
+x=p1006(5);
+x=p1007(6);
+x=p1008(0);
+x=p1009(1);
+x=p1010(2);
+x=p1011(3);
+x=p1012(4);
+x=p1013(5);
+x=p1014(6);
+x=p1015(0);
+x=p1016(1);
+x=p1017(2);
+x=p1018(3);
+x=p1019(4);
+x=p1020(5);
+x=p1021(6);
+x=p1022(0);
+x=p1023(1);
+x=p1024(2);
+x=p1025(3);
+x=p1026(4);
+x=p1027(5);
+x=p1028(6);
+x=p1029(0);
+x=p1030(1);
+x=p1031(2);
+x=p1032(3);
+x=p1033(4);
+x=p1034(5);
+x=p1035(6);
+x=p1036(0);
+x=p1037(1);
+x=p1038(2);
+x=p1039(3);
+x=p1040(4);
+x=p1041(5);
+x=p1042(6);
+x=p1043(0);
+x=p1044(1);
+x=p1045(2);
+x=p1046(3);
+x=p1047(4);
+x=p1048(5);
+x=p1049(6);
+x=p1050(0);
+x=p1051(1);
+x=p1052(2);
+x=p1053(3);
+x=p1054(4);
+x=p1055(5);
+x=p1056(6);
+x=p1057(0);
+x=p1058(1);
+x=p1059(2);
+x=p1060(3);
+x=p1061(4);
+x=p1062(5);
+x=p1063(6);
+x=p1064(0);
+x=p1065(1);
+x=p1066(2);
+x=p1067(3);
+x=p1068(4);
+x=p1069(5);
+x=p1070(6);
+x=p1071(0);
+x=p1072(1);
+x=p1073(2);
+x=p1074(3);
+x=p1075(4);
+x=p1076(5);
+x=p1077(6);
+x=p1078(0);
+x=p1079(1);
+x=p1080(2);
+x=p1081(3);
+x=p1082(4);
+x=p1083(5);
+x=p1084(6);
+x=p1085(0);
+x=p1086(1);
+x=p1087(2);
+x=p1088(3);
+x=p1089(4);
+x=p1090(5);
+x=p1091(6);
+x=p1092(0);
+x=p1093(1);
+x=p1094(2);
+x=p1095(3);
+x=p1096(4);
+x=p1097(5);
+x=p1098(6);
+x=p1099(0);
+x=p1100(1);
+x=p1101(2);
+x=p1102(3);
+x=p1103(4);
+x=p1104(5);
+x=p1105(6);
+x=p1106(0);
+x=p1107(1);
+x=p1108(2);
+x=p1109(3);
+x=p1110(4);
+x=p1111(5);
+x=p1112(6);
+x=p1113(0);
+x=p1114(1);
+x=p1115(2);
+x=p1116(3);
+x=p1117(4);
+x=p1118(5);
+x=p1119(6);
+x=p1120(0);
+x=p1121(1);
+x=p1122(2);
+x=p1123(3);
+x=p1124(4);
+x=p1125(5);
+x=p1126(6);
+x=p1127(0);
+x=p1128(1);
+x=p1129(2);
+x=p1130(3);
+x=p1131(4);
+x=p1132(5);
+x=p1133(6);
+x=p1134(0);
+x=p1135(1);
+x=p1136(2);
+x=p1137(3);
+x=p1138(4);
+x=p1139(5);
+x=p1140(6);
+x=p1141(0);
+x=p1142(1);
+x=p1143(2);
+x=p1144(3);
+x=p1145(4);
+x=p1146(5);
+x=p1147(6);
+x=p1148(0);
+x=p1149(1);
+x=p1150(2);
+x=p1151(3);
+x=p1152(4);
+x=p1153(5);
+x=p1154(6);
+x=p1155(0);
+x=p1156(1);
+x=p1157(2);
+x=p1158(3);
+x=p1159(4);
+x=p1160(5);
+x=p1161(6);
+x=p1162(0);
+x=p1163(1);
+x=p1164(2);
+x=p1165(3);
+x=p1166(4);
+x=p1167(5);
+x=p1168(6);
+x=p1169(0);
+x=p1170(1);
+x=p1171(2);
+x=p1172(3);
+x=p1173(4);
+x=p1174(5);
+x=p1175(6);
+x=p1176(0);
+x=p1177(1);
+x=p1178(2);
+x=p1179(3);
+x=p1180(4);
+x=p1181(5);
+x=p1182(6);
+x=p1183(0);
+x=p1184(1);
+x=p1185(2);
+x=p1186(3);
+x=p1187(4);
+x=p1188(5);
+x=p1189(6);
+x=p1190(0);
+x=p1191(1);
+x=p1192(2);
+x=p1193(3);
+x=p1194(4);
+x=p1195(5);
+x=p1196(6);
+x=p1197(0);
+x=p1198(1);
+x=p1199(2);
+x=p1200(3);
+x=p1201(4);
+x=p1202(5);
+x=p1203(6);
+x=p1204(0);
+x=p1205(1);
+x=p1206(2);
+x=p1207(3);
+x=p1208(4);
+x=p1209(5);
+x=p1210(6);
+x=p1211(0);
+x=p1212(1);
+x=p1213(2);
+x=p1214(3);
+x=p1215(4);
+x=p1216(5);
+x=p1217(6);
+x=p1218(0);
+x=p1219(1);
+x=p1220(2);
+x=p1221(3);
+x=p1222(4);
+x=p1223(5);
+x=p1224(6);
+x=p1225(0);
+x=p1226(1);
+x=p1227(2);
+x=p1228(3);
+x=p1229(4);
+x=p1230(5);
+x=p1231(6);
+x=p1232(0);
+x=p1233(1);
+x=p1234(2);
+x=p1235(3);
+x=p1236(4);
+x=p1237(5);
+x=p1238(6);
+x=p1239(0);
+x=p1240(1);
+x=p1241(2);
+x=p1242(3);
+x=p1243(4);
+x=p1244(5);
+x=p1245(6);
+x=p1246(0);
+x=p1247(1);
+x=p1248(2);
+x=p1249(3);
+x=p1250(4);
+x=p1251(5);
+x=p1252(6);
+x=p1253(0);
+x=p1254(1);
+x=p1255(2);
+x=p1256(3);
+x=p1257(4);
+x=p1258(5);
+x=p1259(6);
+x=p1260(0);
+x=p1261(1);
+x=p1262(2);
+x=p1263(3);
+x=p1264(4);
+x=p1265(5);
+x=p1266(6);
+x=p1267(0);
+x=p1268(1);
+x=p1269(2);
+x=p1270(3);
+x=p1271(4);
+x=p1272(5);
+x=p1273(6);
+x=p1274(0);
+x=p1275(1);
+x=p1276(2);
+x=p1277(3);
+x=p1278(4);
+x=p1279(5);
+x=p1280(6);
+x=p1281(0);
+x=p1282(1);
+x=p1283(2);
+x=p1284(3);
+x=p1285(4);
+x=p1286(5);
+x=p1287(6);
+x=p1288(0);
+x=p1289(1);
+x=p1290(2);
+x=p1291(3);
+x=p1292(4);
+x=p1293(5);
+x=p1294(6);
+x=p1295(0);
+x=p1296(1);
+x=p1297(2);
+x=p1298(3);
+x=p1299(4);
+x=p1300(5);
+x=p1301(6);
+x=p1302(0);
+x=p1303(1);
+x=p1304(2);
+x=p1305(3);
+x=p1306(4);
+x=p1307(5);
+x=p1308(6);
+x=p1309(0);
+x=p1310(1);
+x=p1311(2);
+x=p1312(3);
+x=p1313(4);
+x=p1314(5);
+x=p1315(6);
+x=p1316(0);
+x=p1317(1);
+x=p1318(2);
+x=p1319(3);
+x=p1320(4);
+x=p1321(5);
+x=p1322(6);
+x=p1323(0);
+x=p1324(1);
+x=p1325(2);
+x=p1326(3);
+x=p1327(4);
+x=p1328(5);
+x=p1329(6);
+x=p1330(0);
+x=p1331(1);
+x=p1332(2);
+x=p1333(3);
+x=p1334(4);
+x=p1335(5);
+x=p1336(6);
+x=p1337(0);
+x=p1338(1);
+x=p1339(2);
+x=p1340(3);
+x=p1341(4);
+x=p1342(5);
+x=p1343(6);
+x=p1344(0);
+x=p1345(1);
+x=p1346(2);
+x=p1347(3);
+x=p1348(4);
+x=p1349(5);
+x=p1350(6);
+x=p1351(0);
+x=p1352(1);
+x=p1353(2);
+x=p1354(3);
+x=p1355(4);
+x=p1356(5);
+x=p1357(6);
+x=p1358(0);
+x=p1359(1);
+x=p1360(2);
+x=p1361(3);
+x=p1362(4);
+x=p1363(5);
+x=p1364(6);
+x=p1365(0);
+x=p1366(1);
+x=p1367(2);
+x=p1368(3);
+x=p1369(4);
+x=p1370(5);
+x=p1371(6);
+x=p1372(0);
+x=p1373(1);
+x=p1374(2);
+x=p1375(3);
+x=p1376(4);
+x=p1377(5);
+x=p1378(6);
+x=p1379(0);
+x=p1380(1);
+x=p1381(2);
+x=p1382(3);
+x=p1383(4);
+x=p1384(5);
+x=p1385(6);
+x=p1386(0);
+x=p1387(1);
+x=p1388(2);
+x=p1389(3);
+x=p1390(4);
+x=p1391(5);
+x=p1392(6);
+x=p1393(0);
+x=p1394(1);
+x=p1395(2);
+x=p1396(3);
+x=p1397(4);
+x=p1398(5);
+x=p1399(6);
+x=p1400(0);
+x=p1401(1);
+x=p1402(2);
+x=p1403(3);
+x=p1404(4);
+x=p1405(5);
+x=p1406(6);
+x=p1407(0);
+x=p1408(1);
+x=p1409(2);
+x=p1410(3);
+x=p1411(4);
+x=p1412(5);
+x=p1413(6);
+x=p1414(0);
+x=p1415(1);
+x=p1416(2);
+x=p1417(3);
+x=p1418(4);
+x=p1419(5);
+x=p1420(6);
+x=p1421(0);
+x=p1422(1);
+x=p1423(2);
+x=p1424(3);
+x=p1425(4);
+x=p1426(5);
+x=p1427(6);
+x=p1428(0);
+x=p1429(1);
+x=p1430(2);
+x=p1431(3);
+x=p1432(4);
+x=p1433(5);
+x=p1434(6);
+x=p1435(0);
+x=p1436(1);
+x=p1437(2);
+x=p1438(3);
+x=p1439(4);
+x=p1440(5);
+x=p1441(6);
+x=p1442(0);
+x=p1443(1);
+x=p1444(2);
+x=p1445(3);
+x=p1446(4);
+x=p1447(5);
+x=p1448(6);
+x=p1449(0);
+x=p1450(1);
+x=p1451(2);
+x=p1452(3);
+x=p1453(4);
+x=p1454(5);
+x=p1455(6);
+x=p1456(0);
+x=p1457(1);
+x=p1458(2);
+x=p1459(3);
+x=p1460(4);
+x=p1461(5);
+x=p1462(6);
+x=p1463(0);
+x=p1464(1);
+x=p1465(2);
+x=p1466(3);
+x=p1467(4);
+x=p1468(5);
+x=p1469(6);
+x=p1470(0);
+x=p1471(1);
+x=p1472(2);
+x=p1473(3);
+x=p1474(4);
+x=p1475(5);
+x=p1476(6);
+x=p1477(0);
+x=p1478(1);
+x=p1479(2);
+x=p1480(3);
+x=p1481(4);
+x=p1482(5);
+x=p1483(6);
+x=p1484(0);
+x=p1485(1);
+x=p1486(2);
+x=p1487(3);
+x=p1488(4);
+x=p1489(5);
+x=p1490(6);
+x=p1491(0);
+x=p1492(1);
+x=p1493(2);
+x=p1494(3);
+x=p1495(4);
+x=p1496(5);
+x=p1497(6);
+x=p1498(0);
+x=p1499(1);
+x=p1500(2);
+x=p1501(3);
+x=p1502(4);
+x=p1503(5);
+x=p1504(6);
+x=p1505(0);
+x=p1506(1);
+x=p1507(2);
+x=p1508(3);
+x=p1509(4);
+x=p1510(5);
+x=p1511(6);
+x=p1512(0);
+x=p1513(1);
+x=p1514(2);
+x=p1515(3);
+x=p1516(4);
+x=p1517(5);
+x=p1518(6);
+x=p1519(0);
+x=p1520(1);
+x=p1521(2);
+x=p1522(3);
+x=p1523(4);
+x=p1524(5);
+x=p1525(6);
+x=p1526(0);
+x=p1527(1);
+x=p1528(2);
+x=p1529(3);
+x=p1530(4);
+x=p1531(5);
+x=p1532(6);
+x=p1533(0);
+x=p1534(1);
+x=p1535(2);
+x=p1536(3);
+x=p1537(4);
+x=p1538(5);
+x=p1539(6);
+x=p1540(0);
+x=p1541(1);
+x=p1542(2);
+x=p1543(3);
+x=p1544(4);
+x=p1545(5);
+x=p1546(6);
+x=p1547(0);
+x=p1548(1);
+x=p1549(2);
+x=p1550(3);
+x=p1551(4);
+x=p1552(5);
+x=p1553(6);
+x=p1554(0);
+x=p1555(1);
+x=p1556(2);
+x=p1557(3);
+x=p1558(4);
+x=p1559(5);
+x=p1560(6);
+x=p1561(0);
+x=p1562(1);
+x=p1563(2);
+x=p1564(3);
+x=p1565(4);
+x=p1566(5);
+x=p1567(6);
+x=p1568(0);
+x=p1569(1);
+x=p1570(2);
+x=p1571(3);
+x=p1572(4);
+x=p1573(5);
+x=p1574(6);
+x=p1575(0);
+x=p1576(1);
+x=p1577(2);
+x=p1578(3);
+x=p1579(4);
+x=p1580(5);
+x=p1581(6);
+x=p1582(0);
+x=p1583(1);
+x=p1584(2);
+x=p1585(3);
+x=p1586(4);
+x=p1587(5);
+x=p1588(6);
+x=p1589(0);
+x=p1590(1);
+x=p1591(2);
+x=p1592(3);
+x=p1593(4);
+x=p1594(5);
+x=p1595(6);
+x=p1596(0);
+x=p1597(1);
+x=p1598(2);
+x=p1599(3);
+x=p1600(4);
+x=p1601(5);
+x=p1602(6);
+x=p1603(0);
+x=p1604(1);
+x=p1605(2);
+x=p1606(3);
+x=p1607(4);
+x=p1608(5);
+x=p1609(6);
+x=p1610(0);
+x=p1611(1);
+x=p1612(2);
+x=p1613(3);
+x=p1614(4);
+x=p1615(5);
+x=p1616(6);
+x=p1617(0);
+x=p1618(1);
+x=p1619(2);
+x=p1620(3);
+x=p1621(4);
+x=p1622(5);
+x=p1623(6);
+x=p1624(0);
+x=p1625(1);
+x=p1626(2);
+x=p1627(3);
+x=p1628(4);
+x=p1629(5);
+x=p1630(6);
+x=p1631(0);
+x=p1632(1);
+x=p1633(2);
+x=p1634(3);
+x=p1635(4);
+x=p1636(5);
+x=p1637(6);
+x=p1638(0);
+x=p1639(1);
+x=p1640(2);
+x=p1641(3);
+x=p1642(4);
+x=p1643(5);
+x=p1644(6);
+x=p1645(0);
+x=p1646(1);
+x=p1647(2);
+x=p1648(3);
+x=p1649(4);
+x=p1650(5);
+x=p1651(6);
+x=p1652(0);
+x=p1653(1);
+x=p1654(2);
+x=p1655(3);
+x=p1656(4);
+x=p1657(5);
+x=p1658(6);
+x=p1659(0);
+x=p1660(1);
+x=p1661(2);
+x=p1662(3);
+x=p1663(4);
+x=p1664(5);
+x=p1665(6);
+x=p1666(0);
+x=p1667(1);
+x=p1668(2);
+x=p1669(3);
+x=p1670(4);
+x=p1671(5);
+x=p1672(6);
+x=p1673(0);
+x=p1674(1);
+x=p1675(2);
+x=p1676(3);
+x=p1677(4);
+x=p1678(5);
+x=p1679(6);
+x=p1680(0);
+x=p1681(1);
+x=p1682(2);
+x=p1683(3);
+x=p1684(4);
+x=p1685(5);
+x=p1686(6);
+x=p1687(0);
+x=p1688(1);
+x=p1689(2);
+x=p1690(3);
+x=p1691(4);
+x=p1692(5);
+x=p1693(6);
+x=p1694(0);
+x=p1695(1);
+x=p1696(2);
+x=p1697(3);
+x=p1698(4);
+x=p1699(5);
+x=p1700(6);
+x=p1701(0);
+x=p1702(1);
+x=p1703(2);
+x=p1704(3);
+x=p1705(4);
+x=p1706(5);
+x=p1707(6);
+x=p1708(0);
+x=p1709(1);
+x=p1710(2);
+x=p1711(3);
+x=p1712(4);
+x=p1713(5);
+x=p1714(6);
+x=p1715(0);
+x=p1716(1);
+x=p1717(2);
+x=p1718(3);
+x=p1719(4);
+x=p1720(5);
+x=p1721(6);
+x=p1722(0);
+x=p1723(1);
+x=p1724(2);
+x=p1725(3);
+x=p1726(4);
+x=p1727(5);
+x=p1728(6);
+x=p1729(0);
+x=p1730(1);
+x=p1731(2);
+x=p1732(3);
+x=p1733(4);
+x=p1734(5);
+x=p1735(6);
+x=p1736(0);
+x=p1737(1);
+x=p1738(2);
+x=p1739(3);
+x=p1740(4);
+x=p1741(5);
+x=p1742(6);
+x=p1743(0);
+x=p1744(1);
+x=p1745(2);
+x=p1746(3);
+x=p1747(4);
+x=p1748(5);
+x=p1749(6);
+x=p1750(0);
+x=p1751(1);
+x=p1752(2);
+x=p1753(3);
+x=p1754(4);
+x=p1755(5);
+x=p1756(6);
+x=p1757(0);
+x=p1758(1);
+x=p1759(2);
+x=p1760(3);
+x=p1761(4);
+x=p1762(5);
+x=p1763(6);
+x=p1764(0);
+x=p1765(1);
+x=p1766(2);
+x=p1767(3);
+x=p1768(4);
+x=p1769(5);
+x=p1770(6);
+x=p1771(0);
+x=p1772(1);
+x=p1773(2);
+x=p1774(3);
+x=p1775(4);
+x=p1776(5);
+x=p1777(6);
+x=p1778(0);
+x=p1779(1);
+x=p1780(2);
+x=p1781(3);
+x=p1782(4);
+x=p1783(5);
+x=p1784(6);
+x=p1785(0);
+x=p1786(1);
+x=p1787(2);
+x=p1788(3);
+x=p1789(4);
+x=p1790(5);
+x=p1791(6);
+x=p1792(0);
+x=p1793(1);
+x=p1794(2);
+x=p1795(3);
+x=p1796(4);
+x=p1797(5);
+x=p1798(6);
+x=p1799(0);
+x=p1800(1);
+x=p1801(2);
+x=p1802(3);
+x=p1803(4);
+x=p1804(5);
+x=p1805(6);
+x=p1806(0);
+x=p1807(1);
+x=p1808(2);
+x=p1809(3);
+x=p1810(4);
+x=p1811(5);
+x=p1812(6);
+x=p1813(0);
+x=p1814(1);
+x=p1815(2);
+x=p1816(3);
+x=p1817(4);
+x=p1818(5);
+x=p1819(6);
+x=p1820(0);
+x=p1821(1);
+x=p1822(2);
+x=p1823(3);
+x=p1824(4);
+x=p1825(5);
+x=p1826(6);
+x=p1827(0);
+x=p1828(1);
+x=p1829(2);
+x=p1830(3);
+x=p1831(4);
+x=p1832(5);
+x=p1833(6);
+x=p1834(0);
+x=p1835(1);
+x=p1836(2);
+x=p1837(3);
+x=p1838(4);
+x=p1839(5);
+x=p1840(6);
+x=p1841(0);
+x=p1842(1);
+x=p1843(2);
+x=p1844(3);
+x=p1845(4);
+x=p1846(5);
+x=p1847(6);
+x=p1848(0);
+x=p1849(1);
+x=p1850(2);
+x=p1851(3);
+x=p1852(4);
+x=p1853(5);
+x=p1854(6);
+x=p1855(0);
+x=p1856(1);
+x=p1857(2);
+x=p1858(3);
+x=p1859(4);
+x=p1860(5);
+x=p1861(6);
+x=p1862(0);
+x=p1863(1);
+x=p1864(2);
+x=p1865(3);
+x=p1866(4);
+x=p1867(5);
+x=p1868(6);
+x=p1869(0);
+x=p1870(1);
+x=p1871(2);
+x=p1872(3);
+x=p1873(4);
+x=p1874(5);
+x=p1875(6);
+x=p1876(0);
+x=p1877(1);
+x=p1878(2);
+x=p1879(3);
+x=p1880(4);
+x=p1881(5);
+x=p1882(6);
+x=p1883(0);
+x=p1884(1);
+x=p1885(2);
+x=p1886(3);
+x=p1887(4);
+x=p1888(5);
+x=p1889(6);
+x=p1890(0);
+x=p1891(1);
+x=p1892(2);
+x=p1893(3);
+x=p1894(4);
+x=p1895(5);
+x=p1896(6);
+x=p1897(0);
+x=p1898(1);
+x=p1899(2);
+x=p1900(3);
+x=p1901(4);
+x=p1902(5);
+x=p1903(6);
+x=p1904(0);
+x=p1905(1);
+x=p1906(2);
+x=p1907(3);
+x=p1908(4);
+x=p1909(5);
+x=p1910(6);
+x=p1911(0);
+x=p1912(1);
+x=p1913(2);
+x=p1914(3);
+x=p1915(4);
+x=p1916(5);
+x=p1917(6);
+x=p1918(0);
+x=p1919(1);
+x=p1920(2);
+x=p1921(3);
+x=p1922(4);
+x=p1923(5);
+x=p1924(6);
+x=p1925(0);
+x=p1926(1);
+x=p1927(2);
+x=p1928(3);
+x=p1929(4);
+x=p1930(5);
+x=p1931(6);
+x=p1932(0);
+x=p1933(1);
+x=p1934(2);
+x=p1935(3);
+x=p1936(4);
+x=p1937(5);
+x=p1938(6);
+x=p1939(0);
+x=p1940(1);
+x=p1941(2);
+x=p1942(3);
+x=p1943(4);
+x=p1944(5);
+x=p1945(6);
+x=p1946(0);
+x=p1947(1);
+x=p1948(2);
+x=p1949(3);
+x=p1950(4);
+x=p1951(5);
+x=p1952(6);
+x=p1953(0);
+x=p1954(1);
+x=p1955(2);
+x=p1956(3);
+x=p1957(4);
+x=p1958(5);
+x=p1959(6);
+x=p1960(0);
+x=p1961(1);
+x=p1962(2);
+x=p1963(3);
+x=p1964(4);
+x=p1965(5);
+x=p1966(6);
+x=p1967(0);
+x=p1968(1);
+x=p1969(2);
+x=p1970(3);
+x=p1971(4);
+x=p1972(5);
+x=p1973(6);
+x=p1974(0);
+x=p1975(1);
+x=p1976(2);
+x=p1977(3);
+x=p1978(4);
+x=p1979(5);
+x=p1980(6);
+x=p1981(0);
+x=p1982(1);
+x=p1983(2);
+x=p1984(3);
+x=p1985(4);
+x=p1986(5);
+x=p1987(6);
+x=p1988(0);
+x=p1989(1);
+x=p1990(2);
+x=p1991(3);
+x=p1992(4);
+x=p1993(5);
+x=p1994(6);
+x=p1995(0);
+x=p1996(1);
+x=p1997(2);
+x=p1998(3);
+x=p1999(4);
+}
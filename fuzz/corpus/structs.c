@@ -0,0 +1,802 @@
+struct S{int x;};
+struct S a0[4];
+struct S a1[4];
+struct S a2[4];
+struct S a3[4];
+struct S a4[4];
+struct S a5[4];
+struct S a6[4];
+struct S a7[4];
+struct S a8[4];
+struct S a9[4];
+struct S a10[4];
+struct S a11[4];
+struct S a12[4];
+struct S a13[4];
+struct S a14[4];
+struct S a15[4];
+struct S a16[4];
+struct S a17[4];
+struct S a18[4];
+struct S a19[4];
+struct S a20[4];
+struct S a21[4];
+struct S a22[4];
+struct S a23[4];
+struct S a24[4];
+struct S a25[4];
+struct S a26[4];
+struct S a27[4];
+struct S a28[4];
+struct S a29[4];
+struct S a30[4];
+struct S a31[4];
+struct S a32[4];
+struct S a33[4];
+struct S a34[4];
+struct S a35[4];
+struct S a36[4];
+struct S a37[4];
+struct S a38[4];
+struct S a39[4];
+struct S a40[4];
+struct S a41[4];
+struct S a42[4];
+struct S a43[4];
+struct S a44[4];
+struct S a45[4];
+struct S a46[4];
+struct S a47[4];
+struct S a48[4];
+struct S a49[4];
+struct S a50[4];
+struct S a51[4];
+struct S a52[4];
+struct S a53[4];
+struct S a54[4];
+struct S a55[4];
+struct S a56[4];
+struct S a57[4];
+struct S a58[4];
+struct S a59[4];
+struct S a60[4];
+struct S a61[4];
+struct S a62[4];
+struct S a63[4];
+struct S a64[4];
+struct S a65[4];
+struct S a66[4];
+struct S a67[4];
+struct S a68[4];
+struct S a69[4];
+struct S a70[4];
+struct S a71[4];
+struct S a72[4];
+struct S a73[4];
+struct S a74[4];
+struct S a75[4];
+struct S a76[4];
+struct S a77[4];
+struct S a78[4];
+struct S a79[4];
+struct S a80[4];
+struct S a81[4];
+struct S a82[4];
+struct S a83[4];
+struct S a84[4];
+struct S a85[4];
+struct S a86[4];
+struct S a87[4];
+struct S a88[4];
+struct S a89[4];
+struct S a90[4];
+struct S a91[4];
+struct S a92[4];
+struct S a93[4];
+struct S a94[4];
+struct S a95[4];
+struct S a96[4];
+struct S a97[4];
+struct S a98[4];
+struct S a99[4];
+struct S a100[4];
+struct S a101[4];
+struct S a102[4];
+struct S a103[4];
+struct S a104[4];
+struct S a105[4];
+struct S a106[4];
+struct S a107[4];
+struct S a108[4];
+struct S a109[4];
+struct S a110[4];
+struct S a111[4];
+struct S a112[4];
+struct S a113[4];
+struct S a114[4];
+struct S a115[4];
+struct S a116[4];
+struct S a117[4];
+struct S a118[4];
+struct S a119[4];
+struct S a120[4];
+struct S a121[4];
+struct S a122[4];
+struct S a123[4];
+struct S a124[4];
+struct S a125[4];
+struct S a126[4];
+struct S a127[4];
+struct S a128[4];
+struct S a129[4];
+struct S a130[4];
+struct S a131[4];
+struct S a132[4];
+struct S a133[4];
+struct S a134[4];
+struct S a135[4];
+struct S a136[4];
+struct S a137[4];
+struct S a138[4];
+struct S a139[4];
+struct S a140[4];
+struct S a141[4];
+struct S a142[4];
+struct S a143[4];
+struct S a144[4];
+struct S a145[4];
+struct S a146[4];
+struct S a147[4];
+struct S a148[4];
+struct S a149[4];
+struct S a150[4];
+struct S a151[4];
+struct S a152[4];
+struct S a153[4];
+struct S a154[4];
+struct S a155[4];
+struct S a156[4];
+struct S a157[4];
+struct S a158[4];
+struct S a159[4];
+struct S a160[4];
+struct S a161[4];
+struct S a162[4];
+struct S a163[4];
+struct S a164[4];
+struct S a165[4];
+struct S a166[4];
+struct S a167[4];
+struct S a168[4];
+struct S a169[4];
+struct S a170[4];
+struct S a171[4];
+struct S a172[4];
+struct S a173[4];
+struct S a174[4];
+struct S a175[4];
+struct S a176[4];
+struct S a177[4];
+struct S a178[4];
+struct S a179[4];
+struct S a180[4];
+struct S a181[4];
+struct S a182[4];
+struct S a183[4];
+struct S a184[4];
+struct S a185[4];
+struct S a186[4];
+struct S a187[4];
+struct S a188[4];
+struct S a189[4];
+struct S a190[4];
+struct S a191[4];
+struct S a192[4];
+struct S a193[4];
+struct S a194[4];
+struct S a195[4];
+struct S a196[4];
+struct S a197[4];
+struct S a198[4];
+struct S a199[4];
+struct S a200[4];
+struct S a201[4];
+struct S a202[4];
+struct S a203[4];
+struct S a204[4];
+struct S a205[4];
+struct S a206[4];
+struct S a207[4];
+struct S a208[4];
+struct S a209[4];
+struct S a210[4];
+struct S a211[4];
+struct S a212[4];
+struct S a213[4];
+struct S a214[4];
+struct S a215[4];
+struct S a216[4];
+struct S a217[4];
+struct S a218[4];
+struct S a219[4];
+struct S a220[4];
+struct S a221[4];
+struct S a222[4];
+struct S a223[4];
+struct S a224[4];
+struct S a225[4];
+struct S a226[4];
+struct S a227[4];
+struct S a228[4];
+struct S a229[4];
+struct S a230[4];
+struct S a231[4];
+struct S a232[4];
+struct S a233[4];
+struct S a234[4];
+struct S a235[4];
+struct S a236[4];
+struct S a237[4];
+struct S a238[4];
+struct S a239[4];
+struct S a240[4];
+struct S a241[4];
+struct S a242[4];
+struct S a243[4];
+struct S a244[4];
+struct S a245[4];
+struct S a246[4];
+struct S a247[4];
+struct S a248[4];
+struct S a249[4];
+struct S a250[4];
+struct S a251[4];
+struct S a252[4];
+struct S a253[4];
+struct S a254[4];
+struct S a255[4];
+struct S a256[4];
+struct S a257[4];
+struct S a258[4];
+struct S a259[4];
+struct S a260[4];
+struct S a261[4];
+struct S a262[4];
+struct S a263[4];
+struct S a264[4];
+struct S a265[4];
+struct S a266[4];
+struct S a267[4];
+struct S a268[4];
+struct S a269[4];
+struct S a270[4];
+struct S a271[4];
+struct S a272[4];
+struct S a273[4];
+struct S a274[4];
+struct S a275[4];
+struct S a276[4];
+struct S a277[4];
+struct S a278[4];
+struct S a279[4];
+struct S a280[4];
+struct S a281[4];
+struct S a282[4];
+struct S a283[4];
+struct S a284[4];
+struct S a285[4];
+struct S a286[4];
+struct S a287[4];
+struct S a288[4];
+struct S a289[4];
+struct S a290[4];
+struct S a291[4];
+struct S a292[4];
+struct S a293[4];
+struct S a294[4];
+struct S a295[4];
+struct S a296[4];
+struct S a297[4];
+struct S a298[4];
+struct S a299[4];
+struct S a300[4];
+struct S a301[4];
+struct S a302[4];
+struct S a303[4];
+struct S a304[4];
+struct S a305[4];
+struct S a306[4];
+struct S a307[4];
+struct S a308[4];
+struct S a309[4];
+struct S a310[4];
+struct S a311[4];
+struct S a312[4];
+struct S a313[4];
+struct S a314[4];
+struct S a315[4];
+struct S a316[4];
+struct S a317[4];
+struct S a318[4];
+struct S a319[4];
+struct S a320[4];
+struct S a321[4];
+struct S a322[4];
+struct S a323[4];
+struct S a324[4];
+struct S a325[4];
+struct S a326[4];
+struct S a327[4];
+struct S a328[4];
+struct S a329[4];
+struct S a330[4];
+struct S a331[4];
+struct S a332[4];
+struct S a333[4];
+struct S a334[4];
+struct S a335[4];
+struct S a336[4];
+struct S a337[4];
+struct S a338[4];
+struct S a339[4];
+struct S a340[4];
+struct S a341[4];
+struct S a342[4];
+struct S a343[4];
+struct S a344[4];
+struct S a345[4];
+struct S a346[4];
+struct S a347[4];
+struct S a348[4];
+struct S a349[4];
+struct S a350[4];
+struct S a351[4];
+struct S a352[4];
+struct S a353[4];
+struct S a354[4];
+struct S a355[4];
+struct S a356[4];
+struct S a357[4];
+struct S a358[4];
+struct S a359[4];
+struct S a360[4];
+struct S a361[4];
+struct S a362[4];
+struct S a363[4];
+struct S a364[4];
+struct S a365[4];
+struct S a366[4];
+struct S a367[4];
+struct S a368[4];
+struct S a369[4];
+struct S a370[4];
+struct S a371[4];
+struct S a372[4];
+struct S a373[4];
+struct S a374[4];
+struct S a375[4];
+struct S a376[4];
+struct S a377[4];
+struct S a378[4];
+struct S a379[4];
+struct S a380[4];
+struct S a381[4];
+struct S a382[4];
+struct S a383[4];
+struct S a384[4];
+struct S a385[4];
+struct S a386[4];
+struct S a387[4];
+struct S a388[4];
+struct S a389[4];
+struct S a390[4];
+struct S a391[4];
+struct S a392[4];
+struct S a393[4];
+struct S a394[4];
+struct S a395[4];
+struct S a396[4];
+struct S a397[4];
+struct S a398[4];
+struct S a399[4];
+struct S a400[4];
+struct S a401[4];
+struct S a402[4];
+struct S a403[4];
+struct S a404[4];
+struct S a405[4];
+struct S a406[4];
+struct S a407[4];
+struct S a408[4];
+struct S a409[4];
+struct S a410[4];
+struct S a411[4];
+struct S a412[4];
+struct S a413[4];
+struct S a414[4];
+struct S a415[4];
+struct S a416[4];
+struct S a417[4];
+struct S a418[4];
+struct S a419[4];
+struct S a420[4];
+struct S a421[4];
+struct S a422[4];
+struct S a423[4];
+struct S a424[4];
+struct S a425[4];
+struct S a426[4];
+struct S a427[4];
+struct S a428[4];
+struct S a429[4];
+struct S a430[4];
+struct S a431[4];
+struct S a432[4];
+struct S a433[4];
+struct S a434[4];
+struct S a435[4];
+struct S a436[4];
+struct S a437[4];
+struct S a438[4];
+struct S a439[4];
+struct S a440[4];
+struct S a441[4];
+struct S a442[4];
+struct S a443[4];
+struct S a444[4];
+struct S a445[4];
+struct S a446[4];
+struct S a447[4];
+struct S a448[4];
+struct S a449[4];
+struct S a450[4];
+struct S a451[4];
+struct S a452[4];
+struct S a453[4];
+struct S a454[4];
+struct S a455[4];
+struct S a456[4];
+struct S a457[4];
+struct S a458[4];
+struct S a459[4];
+struct S a460[4];
+struct S a461[4];
+struct S a462[4];
+struct S a463[4];
+struct S a464[4];
+struct S a465[4];
+struct S a466[4];
+struct S a467[4];
+struct S a468[4];
+struct S a469[4];
+struct S a470[4];
+struct S a471[4];
+struct S a472[4];
+struct S a473[4];
+struct S a474[4];
+struct S a475[4];
+struct S a476[4];
+struct S a477[4];
+struct S a478[4];
+struct S a479[4];
+struct S a480[4];
+struct S a481[4];
+struct S a482[4];
+struct S a483[4];
+struct S a484[4];
+struct S a485[4];
+struct S a486[4];
+struct S a487[4];
+struct S a488[4];
+struct S a489[4];
+struct S a490[4];
+struct S a491[4];
+struct S a492[4];
+struct S a493[4];
+struct S a494[4];
+struct S a495[4];
+struct S a496[4];
+struct S a497[4];
+struct S a498[4];
+struct S a499[4];
+struct S a500[4];
+struct S a501[4];
+struct S a502[4];
+struct S a503[4];
+struct S a504[4];
+struct S a505[4];
+struct S a506[4];
+struct S a507[4];
+struct S a508[4];
+struct S a509[4];
+struct S a510[4];
+struct S a511[4];
+struct S a512[4];
+struct S a513[4];
+struct S a514[4];
+struct S a515[4];
+struct S a516[4];
+struct S a517[4];
+struct S a518[4];
+struct S a519[4];
+struct S a520[4];
+struct S a521[4];
+struct S a522[4];
+struct S a523[4];
+struct S a524[4];
+struct S a525[4];
+struct S a526[4];
+struct S a527[4];
+struct S a528[4];
+struct S a529[4];
+struct S a530[4];
+struct S a531[4];
+struct S a532[4];
+struct S a533[4];
+struct S a534[4];
+struct S a535[4];
+struct S a536[4];
+struct S a537[4];
+struct S a538[4];
+struct S a539[4];
+struct S a540[4];
+struct S a541[4];
+struct S a542[4];
+struct S a543[4];
+struct S a544[4];
+struct S a545[4];
+struct S a546[4];
+struct S a547[4];
+struct S a548[4];
+struct S a549[4];
+struct S a550[4];
+struct S a551[4];
+struct S a552[4];
+struct S a553[4];
+struct S a554[4];
+struct S a555[4];
+struct S a556[4];
+struct S a557[4];
+struct S a558[4];
+struct S a559[4];
+struct S a560[4];
+struct S a561[4];
+struct S a562[4];
+struct S a563[4];
+struct S a564[4];
+struct S a565[4];
+struct S a566[4];
+struct S a567[4];
+struct S a568[4];
+struct S a569[4];
+struct S a570[4];
+struct S a571[4];
+struct S a572[4];
+struct S a573[4];
+struct S a574[4];
+struct S a575[4];
+struct S a576[4];
+struct S a577[4];
+struct S a578[4];
+struct S a579[4];
+struct S a580[4];
+struct S a581[4];
+struct S a582[4];
+struct S a583[4];
+struct S a584[4];
+struct S a585[4];
+struct S a586[4];
+struct S a587[4];
+struct S a588[4];
+struct S a589[4];
+struct S a590[4];
+struct S a591[4];
+struct S a592[4];
+struct S a593[4];
+struct S a594[4];
+struct S a595[4];
+struct S a596[4];
+struct S a597[4];
+struct S a598[4];
+struct S a599[4];
+struct S a600[4];
+struct S a601[4];
+struct S a602[4];
+struct S a603[4];
+struct S a604[4];
+struct S a605[4];
+struct S a606[4];
+struct S a607[4];
+struct S a608[4];
+struct S a609[4];
+struct S a610[4];
+struct S a611[4];
+struct S a612[4];
+struct S a613[4];
+struct S a614[4];
+struct S a615[4];
+struct S a616[4];
+struct S a617[4];
+struct S a618[4];
+struct S a619[4];
+struct S a620[4];
+struct S a621[4];
+struct S a622[4];
+struct S a623[4];
+struct S a624[4];
+struct S a625[4];
+struct S a626[4];
+struct S a627[4];
+struct S a628[4];
+struct S a629[4];
+struct S a630[4];
+struct S a631[4];
+struct S a632[4];
+struct S a633[4];
+struct S a634[4];
+struct S a635[4];
+struct S a636[4];
+struct S a637[4];
+struct S a638[4];
+struct S a639[4];
+struct S a640[4];
+struct S a641[4];
+struct S a642[4];
+struct S a643[4];
+struct S a644[4];
+struct S a645[4];
+struct S a646[4];
+struct S a647[4];
+struct S a648[4];
+struct S a649[4];
+struct S a650[4];
+struct S a651[4];
+struct S a652[4];
+struct S a653[4];
+struct S a654[4];
+struct S a655[4];
+struct S a656[4];
+struct S a657[4];
+struct S a658[4];
+struct S a659[4];
+struct S a660[4];
+struct S a661[4];
+struct S a662[4];
+struct S a663[4];
+struct S a664[4];
+struct S a665[4];
+struct S a666[4];
+struct S a667[4];
+struct S a668[4];
+struct S a669[4];
+struct S a670[4];
+struct S a671[4];
+struct S a672[4];
+struct S a673[4];
+struct S a674[4];
+struct S a675[4];
+struct S a676[4];
+struct S a677[4];
+struct S a678[4];
+struct S a679[4];
+struct S a680[4];
+struct S a681[4];
+struct S a682[4];
+struct S a683[4];
+struct S a684[4];
+struct S a685[4];
+struct S a686[4];
+struct S a687[4];
+struct S a688[4];
+struct S a689[4];
+struct S a690[4];
+struct S a691[4];
+struct S a692[4];
+struct S a693[4];
+struct S a694[4];
+struct S a695[4];
+struct S a696[4];
+struct S a697[4];
+struct S a698[4];
+struct S a699[4];
+struct S a700[4];
+struct S a701[4];
+struct S a702[4];
+struct S a703[4];
+struct S a704[4];
+struct S a705[4];
+struct S a706[4];
+struct S a707[4];
+struct S a708[4];
+struct S a709[4];
+struct S a710[4];
+struct S a711[4];
+struct S a712[4];
+struct S a713[4];
+struct S a714[4];
+struct S a715[4];
+struct S a716[4];
+struct S a717[4];
+struct S a718[4];
+struct S a719[4];
+struct S a720[4];
+struct S a721[4];
+struct S a722[4];
+struct S a723[4];
+struct S a724[4];
+struct S a725[4];
+struct S a726[4];
+struct S a727[4];
+struct S a728[4];
+struct S a729[4];
+struct S a730[4];
+struct S a731[4];
+struct S a732[4];
+struct S a733[4];
+struct S a734[4];
+struct S a735[4];
+struct S a736[4];
+struct S a737[4];
+struct S a738[4];
+struct S a739[4];
+struct S a740[4];
+struct S a741[4];
+struct S a742[4];
+struct S a743[4];
+struct S a744[4];
+struct S a745[4];
+struct S a746[4];
+struct S a747[4];
+struct S a748[4];
+struct S a749[4];
+struct S a750[4];
+struct S a751[4];
+struct S a752[4];
+struct S a753[4];
+struct S a754[4];
+struct S a755[4];
+struct S a756[4];
+struct S a757[4];
+struct S a758[4];
+struct S a759[4];
+struct S a760[4];
+struct S a761[4];
+struct S a762[4];
+struct S a763[4];
+struct S a764[4];
+struct S a765[4];
+struct S a766[4];
+struct S a767[4];
+struct S a768[4];
+struct S a769[4];
+struct S a770[4];
+struct S a771[4];
+struct S a772[4];
+struct S a773[4];
+struct S a774[4];
+struct S a775[4];
+struct S a776[4];
+struct S a777[4];
+struct S a778[4];
+struct S a779[4];
+struct S a780[4];
+struct S a781[4];
+struct S a782[4];
+struct S a783[4];
+struct S a784[4];
+struct S a785[4];
+struct S a786[4];
+struct S a787[4];
+struct S a788[4];
+struct S a789[4];
+struct S a790[4];
+struct S a791[4];
+struct S a792[4];
+struct S a793[4];
+struct S a794[4];
+struct S a795[4];
+struct S a796[4];
+struct S a797[4];
+struct S a798[4];
+struct S a799[4];
+void main(){int i; for(i=0;i<4;i++){a0[i].x=i;a1[i].x=i;a2[i].x=i;a3[i].x=i;a4[i].x=i;a5[i].x=i;a6[i].x=i;a7[i].x=i;a8[i].x=i;a9[i].x=i;a10[i].x=i;a11[i].x=i;a12[i].x=i;a13[i].x=i;a14[i].x=i;a15[i].x=i;a16[i].x=i;a17[i].x=i;a18[i].x=i;a19[i].x=i;a20[i].x=i;a21[i].x=i;a22[i].x=i;a23[i].x=i;a24[i].x=i;a25[i].x=i;a26[i].x=i;a27[i].x=i;a28[i].x=i;a29[i].x=i;a30[i].x=i;a31[i].x=i;a32[i].x=i;a33[i].x=i;a34[i].x=i;a35[i].x=i;a36[i].x=i;a37[i].x=i;a38[i].x=i;a39[i].x=i;a40[i].x=i;a41[i].x=i;a42[i].x=i;a43[i].x=i;a44[i].x=i;a45[i].x=i;a46[i].x=i;a47[i].x=i;a48[i].x=i;a49[i].x=i;a50[i].x=i;a51[i].x=i;a52[i].x=i;a53[i].x=i;a54[i].x=i;a55[i].x=i;a56[i].x=i;a57[i].x=i;a58[i].x=i;a59[i].x=i;a60[i].x=i;a61[i].x=i;a62[i].x=i;a63[i].x=i;a64[i].x=i;a65[i].x=i;a66[i].x=i;a67[i].x=i;a68[i].x=i;a69[i].x=i;a70[i].x=i;a71[i].x=i;a72[i].x=i;a73[i].x=i;a74[i].x=i;a75[i].x=i;a76[i].x=i;a77[i].x=i;a78[i].x=i;a79[i].x=i;a80[i].x=i;a81[i].x=i;a82[i].x=i;a83[i].x=i;a84[i].x=i;a85[i].x=i;a86[i].x=i;a87[i].x=i;a88[i].x=i;a89[i].x=i;a90[i].x=i;a91[i].x=i;a92[i].x=i;a93[i].x=i;a94[i].x=i;a95[i].x=i;a96[i].x=i;a97[i].x=i;a98[i].x=i;a99[i].x=i;a100[i].x=i;a101[i].x=i;a102[i].x=i;a103[i].x=i;a104[i].x=i;a105[i].x=i;a106[i].x=i;a107[i].x=i;a108[i].x=i;a109[i].x=i;a110[i].x=i;a111[i].x=i;a112[i].x=i;a113[i].x=i;a114[i].x=i;a115[i].x=i;a116[i].x=i;a117[i].x=i;a118[i].x=i;a119[i].x=i;a120[i].x=i;a121[i].x=i;a122[i].x=i;a123[i].x=i;a124[i].x=i;a125[i].x=i;a126[i].x=i;a127[i].x=i;a128[i].x=i;a129[i].x=i;a130[i].x=i;a131[i].x=i;a132[i].x=i;a133[i].x=i;a134[i].x=i;a135[i].x=i;a136[i].x=i;a137[i].x=i;a138[i].x=i;a139[i].x=i;a140[i].x=i;a141[i].x=i;a142[i].x=i;a143[i].x=i;a144[i].x=i;a145[i].x=i;a146[i].x=i;a147[i].x=i;a148[i].x=i;a149[i].x=i;a150[i].x=i;a151[i].x=i;a152[i].x=i;a153[i].x=i;a154[i].x=i;a155[i].x=i;a156[i].x=i;a157[i].x=i;a158[i].x=i;a159[i].x=i;a160[i].x=i;a161[i].x=i;a162[i].x=i;a163[i].x=i;a164[i].x=i;a165[i].x=i;a166[i].x=i;a167[i].x=i;a168[i].x=i;a169[i].x=i;a170[i].x=i;a171[i].x=i;a172[i].x=i;a173[i].x=i;a174[i].x=i;a175[i].x=i;a176[i].x=i;a177[i].x=i;a178[i].x=i;a179[i].x=i;a180[i].x=i;a181[i].x=i;a182[i].x=i;a183[i].x=i;a184[i].x=i;a185[i].x=i;a186[i].x=i;a187[i].x=i;a188[i].x=i;a189[i].x=i;a190[i].x=i;a191[i].x=i;a192[i].x=i;a193[i].x=i;a194[i].x=i;a195[i].x=i;a196[i].x=i;a197[i].x=i;a198[i].x=i;a199[i].x=i;a200[i].x=i;a201[i].x=i;a202[i].x=i;a203[i].x=i;a204[i].x=i;a205[i].x=i;a206[i].x=i;a207[i].x=i;a208[i].x=i;a209[i].x=i;a210[i].x=i;a211[i].x=i;a212[i].x=i;a213[i].x=i;a214[i].x=i;a215[i].x=i;a216[i].x=i;a217[i].x=i;a218[i].x=i;a219[i].x=i;a220[i].x=i;a221[i].x=i;a222[i].x=i;a223[i].x=i;a224[i].x=i;a225[i].x=i;a226[i].x=i;a227[i].x=i;a228[i].x=i;a229[i].x=i;a230[i].x=i;a231[i].x=i;a232[i].x=i;a233[i].x=i;a234[i].x=i;a235[i].x=i;a236[i].x=i;a237[i].x=i;a238[i].x=i;a239[i].x=i;a240[i].x=i;a241[i].x=i;a242[i].x=i;a243[i].x=i;a244[i].x=i;a245[i].x=i;a246[i].x=i;a247[i].x=i;a248[i].x=i;a249[i].x=i;a250[i].x=i;a251[i].x=i;a252[i].x=i;a253[i].x=i;a254[i].x=i;a255[i].x=i;a256[i].x=i;a257[i].x=i;a258[i].x=i;a259[i].x=i;a260[i].x=i;a261[i].x=i;a262[i].x=i;a263[i].x=i;a264[i].x=i;a265[i].x=i;a266[i].x=i;a267[i].x=i;a268[i].x=i;a269[i].x=i;a270[i].x=i;a271[i].x=i;a272[i].x=i;a273[i].x=i;a274[i].x=i;a275[i].x=i;a276[i].x=i;a277[i].x=i;a278[i].x=i;a279[i].x=i;a280[i].x=i;a281[i].x=i;a282[i].x=i;a283[i].x=i;a284[i].x=i;a285[i].x=i;a286[i].x=i;a287[i].x=i;a288[i].x=i;a289[i].x=i;a290[i].x=i;a291[i].x=i;a292[i].x=i;a293[i].x=i;a294[i].x=i;a295[i].x=i;a296[i].x=i;a297[i].x=i;a298[i].x=i;a299[i].x=i;a300[i].x=i;a301[i].x=i;a302[i].x=i;a303[i].x=i;a304[i].x=i;a305[i].x=i;a306[i].x=i;a307[i].x=i;a308[i].x=i;a309[i].x=i;a310[i].x=i;a311[i].x=i;a312[i].x=i;a313[i].x=i;a314[i].x=i;a315[i].x=i;a316[i].x=i;a317[i].x=i;a318[i].x=i;a319[i].x=i;a320[i].x=i;a321[i].x=i;a322[i].x=i;a323[i].x=i;a324[i].x=i;a325[i].x=i;a326[i].x=i;a327[i].x=i;a328[i].x=i;a329[i].x=i;a330[i].x=i;a331[i].x=i;a332[i].x=i;a333[i].x=i;a334[i].x=i;a335[i].x=i;a336[i].x=i;a337[i].x=i;a338[i].x=i;a339[i].x=i;a340[i].x=i;a341[i].x=i;a342[i].x=i;a343[i].x=i;a344[i].x=i;a345[i].x=i;a346[i].x=i;a347[i].x=i;a348[i].x=i;a349[i].x=i;a350[i].x=i;a351[i].x=i;a352[i].x=i;a353[i].x=i;a354[i].x=i;a355[i].x=i;a356[i].x=i;a357[i].x=i;a358[i].x=i;a359[i].x=i;a360[i].x=i;a361[i].x=i;a362[i].x=i;a363[i].x=i;a364[i].x=i;a365[i].x=i;a366[i].x=i;a367[i].x=i;a368[i].x=i;a369[i].x=i;a370[i].x=i;a371[i].x=i;a372[i].x=i;a373[i].x=i;a374[i].x=i;a375[i].x=i;a376[i].x=i;a377[i].x=i;a378[i].x=i;a379[i].x=i;a380[i].x=i;a381[i].x=i;a382[i].x=i;a383[i].x=i;a384[i].x=i;a385[i].x=i;a386[i].x=i;a387[i].x=i;a388[i].x=i;a389[i].x=i;a390[i].x=i;a391[i].x=i;a392[i].x=i;a393[i].x=i;a394[i].x=i;a395[i].x=i;a396[i].x=i;a397[i].x=i;a398[i].x=i;a399[i].x=i;a400[i].x=i;a401[i].x=i;a402[i].x=i;a403[i].x=i;a404[i].x=i;a405[i].x=i;a406[i].x=i;a407[i].x=i;a408[i].x=i;a409[i].x=i;a410[i].x=i;a411[i].x=i;a412[i].x=i;a413[i].x=i;a414[i].x=i;a415[i].x=i;a416[i].x=i;a417[i].x=i;a418[i].x=i;a419[i].x=i;a420[i].x=i;a421[i].x=i;a422[i].x=i;a423[i].x=i;a424[i].x=i;a425[i].x=i;a426[i].x=i;a427[i].x=i;a428[i].x=i;a429[i].x=i;a430[i].x=i;a431[i].x=i;a432[i].x=i;a433[i].x=i;a434[i].x=i;a435[i].x=i;a436[i].x=i;a437[i].x=i;a438[i].x=i;a439[i].x=i;a440[i].x=i;a441[i].x=i;a442[i].x=i;a443[i].x=i;a444[i].x=i;a445[i].x=i;a446[i].x=i;a447[i].x=i;a448[i].x=i;a449[i].x=i;a450[i].x=i;a451[i].x=i;a452[i].x=i;a453[i].x=i;a454[i].x=i;a455[i].x=i;a456[i].x=i;a457[i].x=i;a458[i].x=i;a459[i].x=i;a460[i].x=i;a461[i].x=i;a462[i].x=i;a463[i].x=i;a464[i].x=i;a465[i].x=i;a466[i].x=i;a467[i].x=i;a468[i].x=i;a469[i].x=i;a470[i].x=i;a471[i].x=i;a472[i].x=i;a473[i].x=i;a474[i].x=i;a475[i].x=i;a476[i].x=i;a477[i].x=i;a478[i].x=i;a479[i].x=i;a480[i].x=i;a481[i].x=i;a482[i].x=i;a483[i].x=i;a484[i].x=i;a485[i].x=i;a486[i].x=i;a487[i].x=i;a488[i].x=i;a489[i].x=i;a490[i].x=i;a491[i].x=i;a492[i].x=i;a493[i].x=i;a494[i].x=i;a495[i].x=i;a496[i].x=i;a497[i].x=i;a498[i].x=i;a499[i].x=i;a500[i].x=i;a501[i].x=i;a502[i].x=i;a503[i].x=i;a504[i].x=i;a505[i].x=i;a506[i].x=i;a507[i].x=i;a508[i].x=i;a509[i].x=i;a510[i].x=i;a511[i].x=i;a512[i].x=i;a513[i].x=i;a514[i].x=i;a515[i].x=i;a516[i].x=i;a517[i].x=i;a518[i].x=i;a519[i].x=i;a520[i].x=i;a521[i].x=i;a522[i].x=i;a523[i].x=i;a524[i].x=i;a525[i].x=i;a526[i].x=i;a527[i].x=i;a528[i].x=i;a529[i].x=i;a530[i].x=i;a531[i].x=i;a532[i].x=i;a533[i].x=i;a534[i].x=i;a535[i].x=i;a536[i].x=i;a537[i].x=i;a538[i].x=i;a539[i].x=i;a540[i].x=i;a541[i].x=i;a542[i].x=i;a543[i].x=i;a544[i].x=i;a545[i].x=i;a546[i].x=i;a547[i].x=i;a548[i].x=i;a549[i].x=i;a550[i].x=i;a551[i].x=i;a552[i].x=i;a553[i].x=i;a554[i].x=i;a555[i].x=i;a556[i].x=i;a557[i].x=i;a558[i].x=i;a559[i].x=i;a560[i].x=i;a561[i].x=i;a562[i].x=i;a563[i].x=i;a564[i].x=i;a565[i].x=i;a566[i].x=i;a567[i].x=i;a568[i].x=i;a569[i].x=i;a570[i].x=i;a571[i].x=i;a572[i].x=i;a573[i].x=i;a574[i].x=i;a575[i].x=i;a576[i].x=i;a577[i].x=i;a578[i].x=i;a579[i].x=i;a580[i].x=i;a581[i].x=i;a582[i].x=i;a583[i].x=i;a584[i].x=i;a585[i].x=i;a586[i].x=i;a587[i].x=i;a588[i].x=i;a589[i].x=i;a590[i].x=i;a591[i].x=i;a592[i].x=i;a593[i].x=i;a594[i].x=i;a595[i].x=i;a596[i].x=i;a597[i].x=i;a598[i].x=i;a599[i].x=i;a600[i].x=i;a601[i].x=i;a602[i].x=i;a603[i].x=i;a604[i].x=i;a605[i].x=i;a606[i].x=i;a607[i].x=i;a608[i].x=i;a609[i].x=i;a610[i].x=i;a611[i].x=i;a612[i].x=i;a613[i].x=i;a614[i].x=i;a615[i].x=i;a616[i].x=i;a617[i].x=i;a618[i].x=i;a619[i].x=i;a620[i].x=i;a621[i].x=i;a622[i].x=i;a623[i].x=i;a624[i].x=i;a625[i].x=i;a626[i].x=i;a627[i].x=i;a628[i].x=i;a629[i].x=i;a630[i].x=i;a631[i].x=i;a632[i].x=i;a633[i].x=i;a634[i].x=i;a635[i].x=i;a636[i].x=i;a637[i].x=i;a638[i].x=i;a639[i].x=i;a640[i].x=i;a641[i].x=i;a642[i].x=i;a643[i].x=i;a644[i].x=i;a645[i].x=i;a646[i].x=i;a647[i].x=i;a648[i].x=i;a649[i].x=i;a650[i].x=i;a651[i].x=i;a652[i].x=i;a653[i].x=i;a654[i].x=i;a655[i].x=i;a656[i].x=i;a657[i].x=i;a658[i].x=i;a659[i].x=i;a660[i].x=i;a661[i].x=i;a662[i].x=i;a663[i].x=i;a664[i].x=i;a665[i].x=i;a666[i].x=i;a667[i].x=i;a668[i].x=i;a669[i].x=i;a670[i].x=i;a671[i].x=i;a672[i].x=i;a673[i].x=i;a674[i].x=i;a675[i].x=i;a676[i].x=i;a677[i].x=i;a678[i].x=i;a679[i].x=i;a680[i].x=i;a681[i].x=i;a682[i].x=i;a683[i].x=i;a684[i].x=i;a685[i].x=i;a686[i].x=i;a687[i].x=i;a688[i].x=i;a689[i].x=i;a690[i].x=i;a691[i].x=i;a692[i].x=i;a693[i].x=i;a694[i].x=i;a695[i].x=i;a696[i].x=i;a697[i].x=i;a698[i].x=i;a699[i].x=i;a700[i].x=i;a701[i].x=i;a702[i].x=i;a703[i].x=i;a704[i].x=i;a705[i].x=i;a706[i].x=i;a707[i].x=i;a708[i].x=i;a709[i].x=i;a710[i].x=i;a711[i].x=i;a712[i].x=i;a713[i].x=i;a714[i].x=i;a715[i].x=i;a716[i].x=i;a717[i].x=i;a718[i].x=i;a719[i].x=i;a720[i].x=i;a721[i].x=i;a722[i].x=i;a723[i].x=i;a724[i].x=i;a725[i].x=i;a726[i].x=i;a727[i].x=i;a728[i].x=i;a729[i].x=i;a730[i].x=i;a731[i].x=i;a732[i].x=i;a733[i].x=i;a734[i].x=i;a735[i].x=i;a736[i].x=i;a737[i].x=i;a738[i].x=i;a739[i].x=i;a740[i].x=i;a741[i].x=i;a742[i].x=i;a743[i].x=i;a744[i].x=i;a745[i].x=i;a746[i].x=i;a747[i].x=i;a748[i].x=i;a749[i].x=i;a750[i].x=i;a751[i].x=i;a752[i].x=i;a753[i].x=i;a754[i].x=i;a755[i].x=i;a756[i].x=i;a757[i].x=i;a758[i].x=i;a759[i].x=i;a760[i].x=i;a761[i].x=i;a762[i].x=i;a763[i].x=i;a764[i].x=i;a765[i].x=i;a766[i].x=i;a767[i].x=i;a768[i].x=i;a769[i].x=i;a770[i].x=i;a771[i].x=i;a772[i].x=i;a773[i].x=i;a774[i].x=i;a775[i].x=i;a776[i].x=i;a777[i].x=i;a778[i].x=i;a779[i].x=i;a780[i].x=i;a781[i].x=i;a782[i].x=i;a783[i].x=i;a784[i].x=i;a785[i].x=i;a786[i].x=i;a787[i].x=i;a788[i].x=i;a789[i].x=i;a790[i].x=i;a791[i].x=i;a792[i].x=i;a793[i].x=i;a794[i].x=i;a795[i].x=i;a796[i].x=i;a797[i].x=i;a798[i].x=i;a799[i].x=i;}}
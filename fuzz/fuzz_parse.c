@@ -0,0 +1,554 @@
+// Performance fuzzer for the front end. Instead of crashes it looks for
+// inputs that cost too much time or memory per byte: every input runs
+// through the library compile (lexer, string pool, parser) and the
+// analyses behind --remarks, and fails when it takes longer than
+// FUZZ_BASE_NS + budget_ns * size or holds more than
+// FUZZ_BASE_BYTES + budget_bytes * size of heap.
+//
+// libFuzzer (over-budget inputs abort and are saved as crashes):
+//   clang -O2 -g -fsanitize=fuzzer -I. fuzz/fuzz_parse.c atomc.c lexer.c parser.c
+//       strpool.c lineindex.c cache.c bounds.c callgraph.c constfold.c layout.c namemap.c
+//       hugemem.c util.c -lm
+//   ./a.out -dict=fuzz/atomc.dict fuzz/corpus
+//
+// Standalone (also usable as an AFL target with @@):
+//   cc -O2 -DFUZZ_STANDALONE -I. fuzz/fuzz_parse.c atomc.c lexer.c parser.c
+//       strpool.c lineindex.c cache.c bounds.c callgraph.c constfold.c layout.c namemap.c
+//       hugemem.c util.c -lm -o fuzz_parse
+//   ./fuzz_parse fuzz/corpus                      check the corpus against the budgets
+//                                                 and for superlinear growth
+//   ./fuzz_parse --search=20000 --out=slow Tests  mutate the seeds, keep the slowest
+//
+// Budgets are set with FUZZ_BUDGET_NS and FUZZ_BUDGET_BYTES (per input
+// byte) in the environment or --budget-ns= and --budget-bytes=.
+//
+// A per-byte budget alone lets a quadratic pass through on inputs that are
+// not large enough yet, so checking a corpus also times every input
+// repeated to at least FUZZ_SCALE_MIN_SIZE bytes and to FUZZ_SCALE_FACTOR
+// times that, and fails when the time per byte grows by more than
+// FUZZ_SCALE_SLACK. Each copy gets its own identifiers, so that n functions
+// become n * copies functions rather than the same ones defined again.
+// Smaller inputs would mostly measure them falling out of the caches.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <malloc.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "atomc.h"
+#include "parser.h"
+#include "bounds.h"
+#include "callgraph.h"
+#include "constfold.h"
+#include "layout.h"
+
+#define FUZZ_BASE_NS 2000000LL          // Fixed cost allowed per input
+#define FUZZ_BASE_BYTES (1 << 20)
+#define FUZZ_DEFAULT_NS_PER_BYTE 1500
+#define FUZZ_DEFAULT_BYTES_PER_BYTE 1024
+#define FUZZ_REPEAT 3                   // Runs per input; the fastest counts
+#define FUZZ_SCALE_FACTOR 4
+#define FUZZ_SCALE_SLACK 1.7
+#define FUZZ_SCALE_MIN_SIZE (512 * 1024)
+
+typedef struct {
+    double nsPerByte;
+    double bytesPerByte;
+    long long ns;
+    size_t bytes;
+    int overBudget;
+} Cost;
+
+static FILE *sink;
+static long long budget_ns = FUZZ_DEFAULT_NS_PER_BYTE;
+static long long budget_bytes = FUZZ_DEFAULT_BYTES_PER_BYTE;
+
+static long long now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static size_t heap_in_use(void) {
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+static void setup(void) {
+    if (sink) {
+        return;
+    }
+    sink = fopen("/dev/null", "w");
+    if (!sink) {
+        fprintf(stderr, "fuzz_parse: cannot open /dev/null\n");
+        exit(1);
+    }
+    if (getenv("FUZZ_BUDGET_NS")) {
+        budget_ns = atoll(getenv("FUZZ_BUDGET_NS"));
+    }
+    if (getenv("FUZZ_BUDGET_BYTES")) {
+        budget_bytes = atoll(getenv("FUZZ_BUDGET_BYTES"));
+    }
+}
+
+// Everything a compilation with --remarks does after parsing. Returns the
+// heap it held at its peak, measured before freeing.
+static size_t run_analyses(const Token *tokens, int token_count, const StringPool *strings,
+                           size_t heap_before) {
+    size_t peak = 0;
+    int *brackets = (int *)malloc((token_count + 1) * sizeof(int));
+    if (!brackets) {
+        return 0;
+    }
+    build_bracket_index(tokens, token_count, brackets);
+
+    check_array_bounds(tokens, token_count, brackets, "fuzz", NULL, 1, sink, NULL);
+
+    Outline outline = {NULL, 0, 0};
+    CallGraph graph;
+    Layout layout;
+    if (parseOutline((Token *)tokens, token_count, brackets, &outline, NULL) &&
+        build_call_graph(tokens, token_count, brackets, &outline, &graph)) {
+        ConstEvaluator constants;
+        const_evaluator_init(&constants, tokens, token_count, brackets, &graph);
+        print_inline_remarks(&graph, tokens, strings, "fuzz", NULL, sink);
+        print_fold_remarks(&constants, "fuzz", NULL, sink);
+        peak = heap_in_use() - heap_before;
+        free_call_graph(&graph);
+    }
+    if (compute_layout(tokens, token_count, brackets, 1, &layout)) {
+        print_layout(&layout, tokens, sink);
+        size_t held = heap_in_use() - heap_before;
+        peak = held > peak ? held : peak;
+        free_layout(&layout);
+    }
+    free(outline.items);
+    free(brackets);
+    return peak;
+}
+
+static Cost measure(const uint8_t *data, size_t size) {
+    Cost cost = {0, 0, -1, 0, 0};
+    for (int run = 0; run < FUZZ_REPEAT; run++) {
+        // A fresh context, so every run pays for its own buffers
+        size_t heap_before = heap_in_use();
+        long long start = now_ns();
+        AtomcContext *context = atomc_context_new();
+        if (!context) {
+            fprintf(stderr, "fuzz_parse: out of memory\n");
+            exit(1);
+        }
+
+        AtomcStatus status = atomc_compile_buffer(context, (const char *)data, size);
+        size_t bytes = heap_in_use() - heap_before;
+        if (status == ATOMC_OK || status == ATOMC_ERROR_BOUNDS) {
+            int token_count;
+            const Token *tokens = atomc_tokens(context, &token_count);
+            size_t analyses = run_analyses(tokens, token_count, atomc_strings(context), heap_before);
+            bytes = analyses > bytes ? analyses : bytes;
+        }
+        atomc_context_free(context);
+
+        long long ns = now_ns() - start;
+        if (cost.ns < 0 || ns < cost.ns) {
+            cost.ns = ns;
+        }
+        if (bytes > cost.bytes) {
+            cost.bytes = bytes;
+        }
+        // One slow run of a large input is enough to know
+        if (ns > 100 * FUZZ_BASE_NS) {
+            break;
+        }
+    }
+
+    double length = size > 0 ? (double)size : 1;
+    cost.nsPerByte = cost.ns / length;
+    cost.bytesPerByte = cost.bytes / length;
+    cost.overBudget = cost.ns > FUZZ_BASE_NS + budget_ns * (long long)size ||
+                      cost.bytes > FUZZ_BASE_BYTES + (size_t)budget_bytes * size;
+    return cost;
+}
+
+static void print_cost(const char *name, size_t size, const Cost *cost) {
+    printf("%s: %zu bytes, %.3f ms, %.1f ns/byte, %.1f heap bytes/byte%s\n", name, size,
+           cost->ns / 1e6, cost->nsPerByte, cost->bytesPerByte, cost->overBudget ? "  OVER BUDGET" : "");
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    setup();
+    Cost cost = measure(data, size);
+    if (cost.overBudget) {
+        print_cost("input", size, &cost);
+        abort();
+    }
+    return 0;
+}
+
+#ifdef FUZZ_STANDALONE
+
+typedef struct {
+    uint8_t *data;
+    size_t size;
+    double score;       // ns per byte
+} Sample;
+
+static uint8_t *read_all(const char *path, size_t *size) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *data = (uint8_t *)malloc(length > 0 ? length : 1);
+    if (data && fread(data, 1, length, file) != (size_t)length) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    *size = length;
+    return data;
+}
+
+// Call visit for path, or for every regular file in it if it is a directory
+static int for_each_input(const char *path, int (*visit)(const char *, void *), void *arg) {
+    struct stat info;
+    if (stat(path, &info) != 0) {
+        fprintf(stderr, "fuzz_parse: cannot open %s\n", path);
+        return 0;
+    }
+    if (!S_ISDIR(info.st_mode)) {
+        return visit(path, arg);
+    }
+    DIR *dir = opendir(path);
+    if (!dir) {
+        return 0;
+    }
+    int ok = 1;
+    struct dirent *entry;
+    while ((entry = readdir(dir))) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        char child[4096];
+        snprintf(child, sizeof(child), "%s/%s", path, entry->d_name);
+        if (stat(child, &info) == 0 && S_ISREG(info.st_mode)) {
+            ok = visit(child, arg) && ok;
+        }
+    }
+    closedir(dir);
+    return ok;
+}
+
+static int is_name_char(uint8_t c) {
+    return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+// data repeated copies times, with "_N" appended to every identifier of
+// copy N > 0; NULL if out of memory
+static uint8_t *repeat_input(const uint8_t *data, size_t size, size_t copies, size_t *repeated_size) {
+    // An identifier of one byte grows the most, by "_" and the digits of N
+    uint8_t *repeated = (uint8_t *)malloc(size * copies * 22 + 1);
+    size_t out = 0;
+    for (size_t copy = 0; repeated && copy < copies; copy++) {
+        for (size_t i = 0; i < size; ) {
+            uint8_t c = data[i];
+            if (c == '\'' || c == '"') {
+                // Literals are copied as they are
+                size_t end = i + 1;
+                while (end < size && data[end] != c && data[end] != '\n') {
+                    end += data[end] == '\\' ? 2 : 1;
+                }
+                end = end < size ? end + 1 : size;
+                memcpy(repeated + out, data + i, end - i);
+                out += end - i;
+                i = end;
+                continue;
+            }
+            if (!is_name_char(c) || (c >= '0' && c <= '9')) {
+                // Numbers too, suffixes and hex digits included
+                size_t end = i + 1;
+                while (c >= '0' && c <= '9' && end < size && is_name_char(data[end])) {
+                    end++;
+                }
+                memcpy(repeated + out, data + i, end - i);
+                out += end - i;
+                i = end;
+                continue;
+            }
+            size_t end = i;
+            char name[256];
+            while (end < size && is_name_char(data[end])) {
+                end++;
+            }
+            snprintf(name, sizeof(name), "%.*s", (int)(end - i), (const char *)data + i);
+            memcpy(repeated + out, data + i, end - i);
+            out += end - i;
+            if (copy > 0 && keyword_index(name) < 0) {
+                out += sprintf((char *)repeated + out, "_%zu", copy);
+            }
+            i = end;
+        }
+    }
+    *repeated_size = out;
+    return repeated;
+}
+
+// Growth of the time per byte when the input, repeated *copies times, gets
+// FUZZ_SCALE_FACTOR times longer; 0 if it cannot be measured
+static double scaling_ratio(const uint8_t *data, size_t size, size_t *copies) {
+    *copies = (FUZZ_SCALE_MIN_SIZE + size - 1) / size;
+    size_t small_size = 0, large_size = 0;
+    uint8_t *small = repeat_input(data, size, *copies, &small_size);
+    uint8_t *large = repeat_input(data, size, *copies * FUZZ_SCALE_FACTOR, &large_size);
+    double ratio = 0;
+    // Long runs are measured once by measure(); alternating them evens out
+    // the noise of other load
+    double small_ns = 0, large_ns = 0;
+    for (int run = 0; small && large && run < FUZZ_REPEAT; run++) {
+        double ns = measure(small, small_size).nsPerByte;
+        small_ns = run == 0 || ns < small_ns ? ns : small_ns;
+        ns = measure(large, large_size).nsPerByte;
+        large_ns = run == 0 || ns < large_ns ? ns : large_ns;
+    }
+    ratio = small_ns > 0 ? large_ns / small_ns : 0;
+    free(small);
+    free(large);
+    return ratio;
+}
+
+static int check_input(const char *path, void *arg) {
+    (void)arg;
+    size_t size;
+    uint8_t *data = read_all(path, &size);
+    if (!data) {
+        fprintf(stderr, "fuzz_parse: cannot read %s\n", path);
+        return 0;
+    }
+    Cost cost = measure(data, size);
+    print_cost(path, size, &cost);
+
+    size_t copies = 1;
+    double ratio = size > 0 ? scaling_ratio(data, size, &copies) : 0;
+    int superlinear = ratio > FUZZ_SCALE_SLACK;
+    if (ratio > 0) {
+        printf("%s: %.2fx the time per byte from %zu to %zu copies%s\n", path, ratio, copies,
+               copies * FUZZ_SCALE_FACTOR, superlinear ? "  SUPERLINEAR" : "");
+    }
+    free(data);
+    return !cost.overBudget && !superlinear;
+}
+
+typedef struct {
+    Sample *items;
+    int count;
+    int capacity;
+} Population;
+
+static int add_seed(const char *path, void *arg) {
+    Population *population = (Population *)arg;
+    if (population->count == population->capacity) {
+        return 1;
+    }
+    Sample *sample = &population->items[population->count];
+    sample->data = read_all(path, &sample->size);
+    if (sample->data) {
+        sample->score = measure(sample->data, sample->size).nsPerByte;
+        population->count++;
+    }
+    return 1;
+}
+
+// Fragments that tend to deepen nesting or hit error recovery
+static const char *const fragments[] = {
+    "(", ")", "{", "}", "[", "]", ";", ",", "if(", "else ", "while(", "for(;;)", "return ",
+    "(int)", "(double)", "(struct S)", "struct S{int a;};", "a=", "f(", "a[", ".x", "!", "-",
+    "\"", "'", "/*", "*/", "//", "\\", "0x", "1e", "1.5", "int ", "double ", "char ", "void ",
+    "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+};
+
+static uint64_t rng_state = 0x9e3779b97f4a7c15ULL;
+
+static uint64_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+// New input made from parent by one mutation; NULL if out of memory
+static uint8_t *mutate(const Sample *parent, size_t max_size, size_t *size) {
+    size_t length = parent->size;
+    size_t at = length ? next_random() % (length + 1) : 0;
+    const uint8_t *insert = NULL;
+    size_t insert_length = 0, remove = 0, repeat = 1;
+
+    switch (next_random() % 4) {
+        case 0: {   // Insert a fragment
+            const char *fragment = fragments[next_random() % (sizeof(fragments) / sizeof(fragments[0]))];
+            insert = (const uint8_t *)fragment;
+            insert_length = strlen(fragment);
+            break;
+        }
+        case 1:     // Repeat a slice, which multiplies nesting
+            if (length > 0) {
+                size_t from = next_random() % length;
+                insert_length = 1 + next_random() % (length - from < 64 ? length - from : 64);
+                insert = parent->data + from;
+                at = from;
+                repeat = 1 + next_random() % 16;
+            }
+            break;
+        case 2:     // Delete a slice
+            if (length > 0) {
+                remove = 1 + next_random() % (length - at + 1 < 32 ? length - at + 1 : 32);
+                if (at + remove > length) {
+                    remove = length - at;
+                }
+            }
+            break;
+        default:    // Change a byte
+            if (length > 0 && at < length) {
+                remove = 1;
+                insert = (const uint8_t *)fragments[next_random() % 8];
+                insert_length = 1;
+            }
+            break;
+    }
+
+    size_t new_size = length - remove + insert_length * repeat;
+    if (new_size > max_size) {
+        new_size = 0;
+        remove = 0;
+        insert_length = 0;
+    }
+    uint8_t *data = (uint8_t *)malloc(new_size > length ? new_size + 1 : length + 1);
+    if (!data) {
+        return NULL;
+    }
+    // The inserted slice may come from the parent, so build the copy in order
+    memcpy(data, parent->data, at);
+    size_t out = at;
+    for (size_t r = 0; r < repeat && insert_length > 0; r++) {
+        memcpy(data + out, insert, insert_length);
+        out += insert_length;
+    }
+    memcpy(data + out, parent->data + at + remove, length - at - remove);
+    *size = out + length - at - remove;
+    return data;
+}
+
+static int search(Population *population, long iterations, size_t max_size, const char *out_dir) {
+    for (long i = 0; i < iterations && population->count > 0; i++) {
+        const Sample *parent = &population->items[next_random() % population->count];
+        Sample child;
+        child.data = mutate(parent, max_size, &child.size);
+        if (!child.data) {
+            return 0;
+        }
+        // Small inputs have too much timer noise to rank
+        Cost cost = measure(child.data, child.size);
+        child.score = child.size >= 64 ? cost.nsPerByte : 0;
+
+        // Replace the cheapest member if the child is worse than it
+        int cheapest = 0;
+        for (int k = 1; k < population->count; k++) {
+            if (population->items[k].score < population->items[cheapest].score) {
+                cheapest = k;
+            }
+        }
+        if (population->count < population->capacity) {
+            population->items[population->count++] = child;
+        } else if (child.score > population->items[cheapest].score) {
+            free(population->items[cheapest].data);
+            population->items[cheapest] = child;
+        } else {
+            free(child.data);
+        }
+    }
+
+    // Report the worst inputs found and keep them
+    int ok = 1;
+    for (int k = 0; k < population->count; k++) {
+        Sample *sample = &population->items[k];
+        char name[4096];
+        snprintf(name, sizeof(name), "%s/slow-%03d.c", out_dir ? out_dir : ".", k);
+        Cost cost = measure(sample->data, sample->size);
+        print_cost(out_dir ? name : "candidate", sample->size, &cost);
+        ok = ok && !cost.overBudget;
+        if (out_dir) {
+            FILE *file = fopen(name, "wb");
+            if (file) {
+                fwrite(sample->data, 1, sample->size, file);
+                fclose(file);
+            }
+        }
+    }
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    long iterations = 0;
+    size_t max_size = 64 * 1024;
+    const char *out_dir = NULL;
+    int inputs = 0;
+
+    setup();
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--budget-ns=", 12) == 0) {
+            budget_ns = atoll(argv[i] + 12);
+        } else if (strncmp(argv[i], "--budget-bytes=", 15) == 0) {
+            budget_bytes = atoll(argv[i] + 15);
+        } else if (strncmp(argv[i], "--search=", 9) == 0) {
+            iterations = atol(argv[i] + 9);
+        } else if (strncmp(argv[i], "--max-size=", 11) == 0) {
+            max_size = (size_t)atoll(argv[i] + 11);
+        } else if (strncmp(argv[i], "--seed=", 7) == 0) {
+            rng_state = (uint64_t)atoll(argv[i] + 7) * 0x9e3779b97f4a7c15ULL + 1;
+        } else if (strncmp(argv[i], "--out=", 6) == 0) {
+            out_dir = argv[i] + 6;
+        } else if (argv[i][0] == '-') {
+            inputs = 0;
+            break;
+        } else {
+            inputs++;
+        }
+    }
+    if (inputs == 0) {
+        printf("Usage: %s [--budget-ns=N] [--budget-bytes=N] FILE|DIR...\n"
+               "       %s --search=ITERATIONS [--seed=N] [--max-size=BYTES] [--out=DIR] FILE|DIR...\n",
+               argv[0], argv[0]);
+        return 2;
+    }
+
+    int ok = 1;
+    if (iterations == 0) {
+        for (int i = 1; i < argc; i++) {
+            if (argv[i][0] != '-') {
+                ok = for_each_input(argv[i], check_input, NULL) && ok;
+            }
+        }
+    } else {
+        Sample items[16];
+        Population population = {items, 0, 16};
+        for (int i = 1; i < argc; i++) {
+            if (argv[i][0] != '-') {
+                for_each_input(argv[i], add_seed, &population);
+            }
+        }
+        ok = search(&population, iterations, max_size, out_dir);
+        for (int k = 0; k < population.count; k++) {
+            free(population.items[k].data);
+        }
+    }
+
+    fclose(sink);
+    return ok ? 0 : 1;
+}
+
+#endif
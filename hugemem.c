@@ -0,0 +1,299 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include "hugemem.h"
+
+#define HUGE_HEADER 64          // Keeps the data cache-line aligned
+#define NUMA_MAX_NODES 1024
+#define NUMA_MPOL_PREFERRED 1   // From linux/mempolicy.h: prefer the node, fall back to others
+
+// In front of every buffer
+typedef struct {
+    size_t mapped;      // Bytes of the mapping, 0 for a heap block
+    size_t usable;      // Bytes available after the header
+    int reserved;       // MAP_HUGETLB pages, which mremap cannot move
+} BlockHeader;
+
+static HugePageMode mode = HUGE_PAGES_OFF;
+static _Thread_local int thread_node = -1;
+
+void huge_set_mode(HugePageMode new_mode) {
+    mode = new_mode;
+}
+
+HugePageMode huge_mode(void) {
+    return mode;
+}
+
+int huge_parse_mode(const char *text, HugePageMode *parsed) {
+    static const HugePageMode modes[] = {HUGE_PAGES_OFF, HUGE_PAGES_TRANSPARENT, HUGE_PAGES_EXPLICIT};
+    for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        if (strcmp(text, huge_mode_name(modes[i])) == 0) {
+            *parsed = modes[i];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+const char *huge_mode_name(HugePageMode which) {
+    switch (which) {
+        case HUGE_PAGES_TRANSPARENT: return "thp";
+        case HUGE_PAGES_EXPLICIT: return "hugetlb";
+        default: return "off";
+    }
+}
+
+static BlockHeader *header_of(void *buffer) {
+    return (BlockHeader *)((char *)buffer - HUGE_HEADER);
+}
+
+static void *heap_block(BlockHeader *old, size_t size) {
+    BlockHeader *header = (BlockHeader *)realloc(old, HUGE_HEADER + size);
+    if (!header) {
+        return NULL;
+    }
+    header->mapped = 0;
+    header->usable = size;
+    return (char *)header + HUGE_HEADER;
+}
+
+// Prefer node for the pages of [address, address + length), before they are touched
+static void bind_to_node(void *address, size_t length, int node) {
+    unsigned long mask[NUMA_MAX_NODES / (8 * sizeof(unsigned long))] = {0};
+    if (node < 0 || node >= NUMA_MAX_NODES) {
+        return;
+    }
+    mask[node / (8 * sizeof(unsigned long))] = 1UL << (node % (8 * sizeof(unsigned long)));
+    // Best effort: without the syscall the pages simply go where they are touched
+    syscall(SYS_mbind, address, length, NUMA_MPOL_PREFERRED, mask, NUMA_MAX_NODES + 1, 0);
+}
+
+static size_t mapping_size(size_t size) {
+    return (HUGE_HEADER + size + HUGE_PAGE_SIZE - 1) & ~((size_t)HUGE_PAGE_SIZE - 1);
+}
+
+// Anonymous memory aligned to HUGE_PAGE_SIZE, so that transparent huge
+// pages can back all of it
+static char *aligned_mapping(size_t mapped) {
+    char *raw = (char *)mmap(NULL, mapped + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        return NULL;
+    }
+    char *map = (char *)(((uintptr_t)raw + HUGE_PAGE_SIZE - 1) & ~((uintptr_t)HUGE_PAGE_SIZE - 1));
+    if (map > raw) {
+        munmap(raw, map - raw);
+    }
+    if (raw + HUGE_PAGE_SIZE > map) {
+        munmap(map + mapped, raw + HUGE_PAGE_SIZE - map);
+    }
+    madvise(map, mapped, MADV_HUGEPAGE);
+    if (thread_node >= 0) {
+        bind_to_node(map, mapped, thread_node);
+    }
+    return map;
+}
+
+static void *mapped_block(size_t size) {
+    size_t mapped = mapping_size(size);
+    char *map = NULL;
+    int reserved = 0;
+    if (mode == HUGE_PAGES_EXPLICIT) {
+        // Fails unless the administrator reserved enough pages (vm.nr_hugepages)
+        map = (char *)mmap(NULL, mapped, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        reserved = map != MAP_FAILED;
+        if (!reserved) {
+            map = NULL;
+        } else if (thread_node >= 0) {
+            bind_to_node(map, mapped, thread_node);
+        }
+    }
+    if (!map && !(map = aligned_mapping(mapped))) {
+        return NULL;
+    }
+
+    BlockHeader *header = (BlockHeader *)map;
+    header->mapped = mapped;
+    header->usable = mapped - HUGE_HEADER;
+    header->reserved = reserved;
+    return map + HUGE_HEADER;
+}
+
+// Move a transparent mapping to a larger aligned range. Only page tables
+// move, so nothing is copied and its huge pages stay huge.
+static void *grow_mapping(BlockHeader *header, size_t size) {
+    size_t mapped = mapping_size(size);
+    char *target = aligned_mapping(mapped);
+    if (!target) {
+        return NULL;
+    }
+    void *moved = mremap(header, header->mapped, mapped, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+    if (moved == MAP_FAILED) {
+        munmap(target, mapped);
+        return NULL;
+    }
+    header = (BlockHeader *)moved;
+    header->mapped = mapped;
+    header->usable = mapped - HUGE_HEADER;
+    return (char *)moved + HUGE_HEADER;
+}
+
+void *huge_alloc(size_t size) {
+    if (mode != HUGE_PAGES_OFF && size >= HUGE_MIN_BYTES) {
+        void *buffer = mapped_block(size);
+        if (buffer) {
+            return buffer;
+        }
+    }
+    return heap_block(NULL, size);
+}
+
+void *huge_realloc(void *buffer, size_t size) {
+    if (!buffer) {
+        return huge_alloc(size);
+    }
+    BlockHeader *header = header_of(buffer);
+    if (header->mapped == 0 && (mode == HUGE_PAGES_OFF || size < HUGE_MIN_BYTES)) {
+        return heap_block(header, size);
+    }
+    if (size <= header->usable) {
+        return buffer;
+    }
+    if (header->mapped && !header->reserved) {
+        void *moved = grow_mapping(header, size);
+        if (moved) {
+            return moved;
+        }
+    }
+    // Callers grow geometrically, so copying costs no more than realloc would
+    void *grown = huge_alloc(size);
+    if (!grown) {
+        return NULL;
+    }
+    memcpy(grown, buffer, header->usable);
+    huge_free(buffer);
+    return grown;
+}
+
+void huge_free(void *buffer) {
+    if (!buffer) {
+        return;
+    }
+    BlockHeader *header = header_of(buffer);
+    if (header->mapped) {
+        munmap(header, header->mapped);
+    } else {
+        free(header);
+    }
+}
+
+// Highest number in a sysfs list such as "0-1,4", -1 if unreadable
+static int last_in_list(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        return -1;
+    }
+    int last = -1, value;
+    char separator;
+    while (fscanf(file, "%d%c", &value, &separator) >= 1) {
+        last = value;
+        if (separator != ',' && separator != '-') {
+            break;
+        }
+    }
+    fclose(file);
+    return last;
+}
+
+int numa_node_count(void) {
+    static int count = 0;
+    if (count == 0) {
+        int last = last_in_list("/sys/devices/system/node/online");
+        count = last >= 0 ? last + 1 : 1;
+    }
+    return count;
+}
+
+int numa_place_worker(int worker) {
+    int nodes = numa_node_count();
+    if (nodes < 2 || mode == HUGE_PAGES_OFF) {
+        return -1;
+    }
+    int node = worker % nodes;
+
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        return -1;
+    }
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    int first, last, any = 0;
+    while (fscanf(file, "%d", &first) == 1) {
+        last = first;
+        if (fscanf(file, "-%d", &last) != 1) {
+            last = first;
+        }
+        for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++) {
+            CPU_SET(cpu, &cpus);
+            any = 1;
+        }
+        if (fgetc(file) != ',') {
+            break;
+        }
+    }
+    fclose(file);
+
+    // A node without CPUs (memory only) or a restricted cpuset keeps the thread where it is
+    if (!any || sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+        return -1;
+    }
+    thread_node = node;
+    return node;
+}
+
+int dtlb_counter_start(void) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.inherit = 1;           // Include worker threads, added in when they exit
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    int counter = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (counter < 0) {
+        return -1;
+    }
+    if (ioctl(counter, PERF_EVENT_IOC_RESET, 0) != 0 || ioctl(counter, PERF_EVENT_IOC_ENABLE, 0) != 0) {
+        close(counter);
+        return -1;
+    }
+    return counter;
+}
+
+int dtlb_counter_stop(int counter, long long *misses) {
+    if (counter < 0) {
+        return 0;
+    }
+    ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t value;
+    int ok = read(counter, &value, sizeof(value)) == (ssize_t)sizeof(value);
+    close(counter);
+    *misses = ok ? (long long)value : 0;
+    return ok;
+}
@@ -0,0 +1,51 @@
+#ifndef HUGEMEM_H
+#define HUGEMEM_H
+
+#include <stddef.h>
+
+// Memory for buffers that grow with the input (token arrays, bracket
+// indices). Buffers of at least HUGE_MIN_BYTES can live in their own
+// mapping backed by 2 MB pages, which keeps the TLB from missing on every
+// few tokens of a gigabyte-scale program. Smaller ones, and all of them
+// when huge pages are off, come from the heap. Every buffer carries a small
+// header, so use huge_realloc and huge_free on them, never realloc or free.
+
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024)
+#define HUGE_MIN_BYTES HUGE_PAGE_SIZE
+
+typedef enum {
+    HUGE_PAGES_OFF,             // Heap only (the default)
+    HUGE_PAGES_TRANSPARENT,     // Own mappings with madvise(MADV_HUGEPAGE)
+    HUGE_PAGES_EXPLICIT         // MAP_HUGETLB from the reserved pool, else as above
+} HugePageMode;
+
+// Set the mode before other threads start. huge_parse_mode accepts "off",
+// "thp" and "hugetlb"; it returns 0 for anything else.
+void huge_set_mode(HugePageMode mode);
+HugePageMode huge_mode(void);
+int huge_parse_mode(const char *text, HugePageMode *mode);
+const char *huge_mode_name(HugePageMode mode);
+
+void *huge_alloc(size_t size);
+// Grow or shrink like realloc; the contents are kept. NULL if out of memory,
+// in which case buffer is still valid.
+void *huge_realloc(void *buffer, size_t size);
+void huge_free(void *buffer);
+
+// Number of NUMA nodes, 1 if it cannot be told
+int numa_node_count(void);
+
+// Keep the calling worker thread on NUMA node worker % numa_node_count()
+// and place its mapped buffers there. Does nothing on a single node or when
+// huge pages are off, since then no buffer is mapped and bound to the node
+// and pinning would only keep the scheduler from balancing the threads.
+// Returns the node, or -1 if the thread was left alone.
+int numa_place_worker(int worker);
+
+// Count data TLB misses of this process and the threads it starts from now
+// on. Returns -1 where perf_event_open is unavailable (or not permitted).
+int dtlb_counter_start(void);
+// Stop the counter and close it. Returns 0 if it could not be read.
+int dtlb_counter_stop(int counter, long long *misses);
+
+#endif
@@ -0,0 +1,440 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "layout.h"
+#include "constfold.h"
+#include "namemap.h"
+#include "util.h"
+
+typedef struct {
+    Layout *layout;
+    int structCapacity;
+    int fieldCapacity;
+    int arrayCapacity;
+    const Token *tokens;
+    int tokenCount;
+    const int *brackets;
+    ConstEvaluator constants;   // Array sizes
+    NameMap structNames;        // Struct name to its latest definition
+    NameMap arrayNames;         // Array name to its innermost visible declaration
+    int *visible;               // Arrays in scope, innermost last
+    int visibleCount, visibleCapacity;
+} LayoutBuilder;
+
+// value rounded up to a multiple of align, -1 if that overflows
+static long long align_up(long long value, int align) {
+    long long sum;
+    if (value < 0 || __builtin_add_overflow(value, align - 1, &sum)) {
+        return -1;
+    }
+    return sum / align * align;
+}
+
+// Add a member of size bytes and alignment align at the end of *size.
+// Returns 0 if the total overflows.
+static int append_member(long long *size, int align, long long member_size) {
+    *size = align_up(*size, align);
+    return *size >= 0 && !__builtin_add_overflow(*size, member_size, size);
+}
+
+// Latest struct defined with this name, or -1
+static int find_struct(const LayoutBuilder *builder, const char *name) {
+    return name_map_get(&builder->structNames, name);
+}
+
+// Size and alignment of the type starting at token k; *length receives its
+// number of tokens. Returns 0 for void and for unknown or incomplete structs.
+static int type_layout(const LayoutBuilder *builder, int k, long long *size, int *align, int *length) {
+    const Token *token = &builder->tokens[k];
+    *length = 1;
+    if (token_is_keyword(token, KEYWORD_CHAR)) {
+        *size = *align = 1;
+        return 1;
+    }
+    if (token_is_keyword(token, KEYWORD_INT) || token_is_keyword(token, KEYWORD_FLOAT)) {
+        *size = *align = 4;
+        return 1;
+    }
+    if (token_is_keyword(token, KEYWORD_DOUBLE)) {
+        *size = *align = 8;
+        return 1;
+    }
+    if (token_is_keyword(token, KEYWORD_STRUCT) && k + 1 < builder->tokenCount &&
+        builder->tokens[k + 1].type == TOKEN_IDENTIFIER) {
+        *length = 2;
+        int index = find_struct(builder, builder->tokens[k + 1].value);
+        if (index < 0 || builder->layout->structs[index].size < 0) {
+            return 0;
+        }
+        *size = builder->layout->structs[index].size;
+        *align = builder->layout->structs[index].align;
+        return 1;
+    }
+    return 0;
+}
+
+// Number of elements of the declarator at name, -1 for a scalar and -2 if
+// the size is not a constant
+static long long element_count(LayoutBuilder *builder, int name) {
+    int open = name + 1;
+    if (open >= builder->tokenCount || builder->tokens[open].type != TOKEN_LBRACKET ||
+        builder->brackets[open] < open) {
+        return -1;
+    }
+    ConstValue value;
+    if (!const_eval(&builder->constants, open + 1, builder->brackets[open], &value) ||
+        value.isReal || value.integer < 0) {
+        return -2;
+    }
+    return value.integer;
+}
+
+// Size of a struct whose members are placed in order of decreasing
+// alignment, -1 if it overflows
+static long long packed_size(const FieldLayout *fields, int count, int struct_align) {
+    long long size = 0;
+    for (int align = 8; align >= 1; align /= 2) {
+        for (int i = 0; i < count; i++) {
+            if (fields[i].align == align && !append_member(&size, align, fields[i].size)) {
+                return -1;
+            }
+        }
+    }
+    return align_up(size, struct_align);
+}
+
+// Lay out the struct defined at k: STRUCT ID LBRACE member* RBRACE
+static int add_struct(LayoutBuilder *builder, int k) {
+    Layout *layout = builder->layout;
+    const Token *tokens = builder->tokens;
+    int close = builder->brackets[k + 2];
+    if (!grow_array((void **)&layout->structs, &builder->structCapacity, layout->structCount, sizeof(StructLayout))) {
+        return 0;
+    }
+    StructLayout *layout_struct = &layout->structs[layout->structCount];
+    layout_struct->nameIndex = k + 1;
+    layout_struct->size = 0;
+    layout_struct->align = 1;
+    layout_struct->firstField = layout->fieldCount;
+    layout_struct->fieldCount = 0;
+
+    long long offset = 0;
+    int complete = 1;
+    for (int m = k + 3; m < close; ) {
+        long long size = 0;
+        int align = 1, length;
+        int known = type_layout(builder, m, &size, &align, &length);
+        int d = m + length;
+
+        // Declarators: ID arrayDecl? (COMMA ID arrayDecl?)* SEMICOLON
+        while (d < close && tokens[d].type == TOKEN_IDENTIFIER) {
+            long long count = element_count(builder, d);
+            if (!grow_array((void **)&layout->fields, &builder->fieldCapacity, layout->fieldCount, sizeof(FieldLayout))) {
+                return 0;
+            }
+            FieldLayout *field = &layout->fields[layout->fieldCount++];
+            field->nameIndex = d;
+            field->typeIndex = m;
+            field->count = count;
+            field->size = known && count != -2 ? size : -1;
+            if (field->size >= 0 && count >= 0 && __builtin_mul_overflow(size, count, &field->size)) {
+                field->size = -1;
+            }
+            field->align = known ? align : 1;
+            field->loopAccesses = 0;
+            if (field->size < 0) {
+                complete = 0;
+            } else if (complete) {
+                long long end = offset;
+                complete = append_member(&end, field->align, field->size);
+                field->offset = end - field->size;
+                offset = end;
+            }
+            if (field->align > layout_struct->align) {
+                layout_struct->align = field->align;
+            }
+            layout_struct->fieldCount++;
+
+            d++;
+            if (count != -1) {
+                d = builder->brackets[d] + 1;
+            }
+            if (tokens[d].type != TOKEN_COMMA) {
+                break;
+            }
+            d++;
+        }
+        // Continue after the ';'
+        while (d < close && tokens[d].type != TOKEN_SEMICOLON) {
+            d++;
+        }
+        m = d + 1;
+    }
+
+    FieldLayout *fields = &layout->fields[layout_struct->firstField];
+    if (complete) {
+        layout_struct->size = align_up(offset, layout_struct->align);
+        layout_struct->packedSize = packed_size(fields, layout_struct->fieldCount, layout_struct->align);
+    }
+    if (!complete || layout_struct->size < 0 || layout_struct->packedSize < 0) {
+        layout_struct->size = layout_struct->packedSize = -1;
+    }
+    layout->structCount++;
+    return name_map_set(&builder->structNames, tokens[k + 1].value, layout->structCount - 1);
+}
+
+// Array of structs visible at token k under this name, or NULL
+static ArrayLayout *find_array(const LayoutBuilder *builder, int k) {
+    int index = name_map_get(&builder->arrayNames, builder->tokens[k].value);
+    return index >= 0 ? &builder->layout->arrays[index] : NULL;
+}
+
+static FieldLayout *find_field(Layout *layout, const Token *tokens, int struct_index, const char *name) {
+    const StructLayout *layout_struct = &layout->structs[struct_index];
+    for (int i = 0; i < layout_struct->fieldCount; i++) {
+        FieldLayout *field = &layout->fields[layout_struct->firstField + i];
+        if (strcmp(tokens[field->nameIndex].value, name) == 0) {
+            return field;
+        }
+    }
+    return NULL;
+}
+
+// Record the arrays declared by "struct ID name[N], ...;" at k; returns its ';'
+static int add_arrays(LayoutBuilder *builder, int k, int scope_end) {
+    Layout *layout = builder->layout;
+    const Token *tokens = builder->tokens;
+    int struct_index = find_struct(builder, tokens[k + 1].value);
+    int d = k + 2;
+
+    while (d < builder->tokenCount && tokens[d].type == TOKEN_IDENTIFIER) {
+        long long count = element_count(builder, d);
+        if (d + 1 < builder->tokenCount && tokens[d + 1].type == TOKEN_LPAREN) {
+            return d;   // Function returning a struct
+        }
+        if (count >= 0 && struct_index >= 0) {
+            if (!grow_array((void **)&layout->arrays, &builder->arrayCapacity, layout->arrayCount, sizeof(ArrayLayout))) {
+                return -1;
+            }
+            ArrayLayout *array = &layout->arrays[layout->arrayCount++];
+            memset(array, 0, sizeof(*array));
+            array->nameIndex = d;
+            array->structIndex = struct_index;
+            array->count = count;
+            array->scopeEnd = scope_end;
+            array->previous = name_map_get(&builder->arrayNames, tokens[d].value);
+            if (!name_map_set(&builder->arrayNames, tokens[d].value, layout->arrayCount - 1) ||
+                !grow_array((void **)&builder->visible, &builder->visibleCapacity, builder->visibleCount, sizeof(int))) {
+                return -1;
+            }
+            builder->visible[builder->visibleCount++] = layout->arrayCount - 1;
+        }
+        d++;
+        if (count != -1) {
+            d = builder->brackets[d] + 1;
+        }
+        if (d >= builder->tokenCount || tokens[d].type != TOKEN_COMMA) {
+            break;
+        }
+        d++;
+    }
+    return d;
+}
+
+int compute_layout(const Token *tokens, int token_count, const int *brackets, int soa, Layout *layout) {
+    LayoutBuilder builder;
+    memset(&builder, 0, sizeof(builder));
+    memset(layout, 0, sizeof(*layout));
+    builder.layout = layout;
+    builder.tokens = tokens;
+    builder.tokenCount = token_count;
+    builder.brackets = brackets;
+    const_evaluator_init(&builder.constants, tokens, token_count, brackets, NULL);
+    name_map_init(&builder.structNames);
+    name_map_init(&builder.arrayNames);
+
+    int *scopes = NULL, *loops = NULL;
+    int scope_count = 0, scope_capacity = 0, loop_count = 0, loop_capacity = 0;
+    int *ends = (int *)malloc((token_count > 0 ? token_count : 1) * sizeof(int));
+    int ok = ends != NULL;
+    if (ok) {
+        memset(ends, -1, token_count * sizeof(int));
+    }
+
+    for (int k = 0; ok && k < token_count; k++) {
+        while (loop_count > 0 && loops[loop_count - 1] < k) {
+            loop_count--;
+        }
+        const Token *token = &tokens[k];
+        int starts_item = k == 0 || tokens[k - 1].type == TOKEN_SEMICOLON ||
+                          tokens[k - 1].type == TOKEN_LBRACE || tokens[k - 1].type == TOKEN_RBRACE;
+
+        if (token_is_keyword(token, KEYWORD_STRUCT) && k + 2 < token_count &&
+            tokens[k + 1].type == TOKEN_IDENTIFIER && tokens[k + 2].type == TOKEN_LBRACE &&
+            brackets[k + 2] > k + 2) {
+            ok = add_struct(&builder, k);
+            k = brackets[k + 2];
+        } else if (starts_item && token_is_keyword(token, KEYWORD_STRUCT) && k + 2 < token_count &&
+                   tokens[k + 1].type == TOKEN_IDENTIFIER) {
+            int scope_end = scope_count > 0 ? brackets[scopes[scope_count - 1]] : token_count - 1;
+            int end = add_arrays(&builder, k, scope_end);
+            ok = end >= 0;
+            k = end > k ? end - 1 : k;
+        } else if (token->type == TOKEN_LBRACE) {
+            if ((ok = grow_array((void **)&scopes, &scope_capacity, scope_count, sizeof(int)))) {
+                scopes[scope_count++] = k;
+            }
+        } else if (token->type == TOKEN_RBRACE) {
+            scope_count -= scope_count > 0;
+            // Arrays declared in the block go out of scope
+            while (ok && builder.visibleCount > 0 &&
+                   layout->arrays[builder.visible[builder.visibleCount - 1]].scopeEnd == k) {
+                const ArrayLayout *array = &layout->arrays[builder.visible[--builder.visibleCount]];
+                ok = name_map_set(&builder.arrayNames, tokens[array->nameIndex].value, array->previous);
+            }
+        } else if ((token_is_keyword(token, KEYWORD_FOR) || token_is_keyword(token, KEYWORD_WHILE)) &&
+                   k + 1 < token_count && tokens[k + 1].type == TOKEN_LPAREN) {
+            if ((ok = grow_array((void **)&loops, &loop_capacity, loop_count, sizeof(int)))) {
+                loops[loop_count++] = statement_end_memo(tokens, token_count, brackets, k, ends);
+            }
+        } else if (token->type == TOKEN_IDENTIFIER && (k == 0 || tokens[k - 1].type != TOKEN_DOT)) {
+            ArrayLayout *array = find_array(&builder, k);
+            if (!array) {
+                continue;
+            }
+            // name[index].member is a member access; anything else uses whole elements
+            int close = k + 1 < token_count && tokens[k + 1].type == TOKEN_LBRACKET ? brackets[k + 1] : -1;
+            FieldLayout *field = NULL;
+            if (close > k && close + 2 < token_count && tokens[close + 1].type == TOKEN_DOT) {
+                field = find_field(layout, tokens, array->structIndex, tokens[close + 2].value);
+            }
+            if (!field) {
+                array->wholeUses++;
+            } else if (loop_count > 0) {
+                array->loopAccesses++;
+                field->loopAccesses++;
+            }
+        }
+    }
+
+    for (int i = 0; i < layout->arrayCount; i++) {
+        ArrayLayout *array = &layout->arrays[i];
+        const StructLayout *layout_struct = &layout->structs[array->structIndex];
+        array->soa = soa && array->wholeUses == 0 && array->loopAccesses > 0 && layout_struct->size >= 0;
+        if (!array->soa) {
+            if (layout_struct->size < 0 ||
+                __builtin_mul_overflow(array->count, layout_struct->size, &array->size)) {
+                array->size = -1;
+            }
+            continue;
+        }
+        // The member arrays follow each other
+        array->size = 0;
+        for (int f = 0; f < layout_struct->fieldCount; f++) {
+            const FieldLayout *field = &layout->fields[layout_struct->firstField + f];
+            long long member;
+            if (__builtin_mul_overflow(field->size, array->count, &member) ||
+                !append_member(&array->size, field->align, member)) {
+                array->size = -1;
+                break;
+            }
+        }
+    }
+    free(scopes);
+    free(loops);
+    free(ends);
+    free(builder.visible);
+    name_map_free(&builder.structNames);
+    name_map_free(&builder.arrayNames);
+    if (!ok) {
+        free_layout(layout);
+    }
+    return ok;
+}
+
+void free_layout(Layout *layout) {
+    free(layout->structs);
+    free(layout->fields);
+    free(layout->arrays);
+    memset(layout, 0, sizeof(*layout));
+}
+
+static void print_type(const Token *tokens, const FieldLayout *field, FILE *out) {
+    if (token_is_keyword(&tokens[field->typeIndex], KEYWORD_STRUCT)) {
+        fprintf(out, "struct %s", tokens[field->typeIndex + 1].value);
+    } else {
+        fprintf(out, "%s", tokens[field->typeIndex].value);
+    }
+}
+
+void print_layout(const Layout *layout, const Token *tokens, FILE *out) {
+    for (int s = 0; s < layout->structCount; s++) {
+        const StructLayout *layout_struct = &layout->structs[s];
+        const char *name = tokens[layout_struct->nameIndex].value;
+        if (layout_struct->size < 0) {
+            fprintf(out, "struct %s: size unknown\n", name);
+            continue;
+        }
+        fprintf(out, "struct %s: size %lld, align %d\n", name, layout_struct->size, layout_struct->align);
+
+        long long end = 0;
+        for (int i = 0; i < layout_struct->fieldCount; i++) {
+            const FieldLayout *field = &layout->fields[layout_struct->firstField + i];
+            if (field->offset > end) {
+                fprintf(out, "  %6lld  (%lld bytes padding)\n", end, field->offset - end);
+            }
+            fprintf(out, "  %6lld  ", field->offset);
+            print_type(tokens, field, out);
+            fprintf(out, " %s", tokens[field->nameIndex].value);
+            if (field->count >= 0) {
+                fprintf(out, "[%lld]", field->count);
+            }
+            fprintf(out, " (%lld bytes", field->size);
+            if (field->loopAccesses > 0) {
+                fprintf(out, ", %d uses in loops", field->loopAccesses);
+            }
+            fprintf(out, ")\n");
+            end = field->offset + field->size;
+        }
+        if (layout_struct->size > end) {
+            fprintf(out, "  %6lld  (%lld bytes padding)\n", end, layout_struct->size - end);
+        }
+        if (layout_struct->packedSize < layout_struct->size) {
+            fprintf(out, "  ordering the members by alignment would make it %lld bytes\n",
+                    layout_struct->packedSize);
+        }
+    }
+
+    for (int a = 0; a < layout->arrayCount; a++) {
+        const ArrayLayout *array = &layout->arrays[a];
+        const StructLayout *layout_struct = &layout->structs[array->structIndex];
+        const char *name = tokens[array->nameIndex].value;
+        if (array->size < 0) {
+            fprintf(out, "array %s: %lld x struct %s, size unknown\n", name, array->count,
+                    tokens[layout_struct->nameIndex].value);
+            continue;
+        }
+        fprintf(out, "array %s: %lld x struct %s, %lld bytes, %s\n", name, array->count,
+                tokens[layout_struct->nameIndex].value, array->size,
+                array->soa ? "structure of arrays" : "array of structs");
+
+        if (array->soa) {
+            // One array per member, each aligned for its member type
+            long long offset = 0;
+            for (int i = 0; i < layout_struct->fieldCount; i++) {
+                const FieldLayout *field = &layout->fields[layout_struct->firstField + i];
+                offset = align_up(offset, field->align);
+                fprintf(out, "  %6lld  ", offset);
+                print_type(tokens, field, out);
+                fprintf(out, " %s[%lld]", tokens[field->nameIndex].value, array->count);
+                if (field->count >= 0) {
+                    fprintf(out, "[%lld]", field->count);
+                }
+                fprintf(out, " (%lld bytes)\n", field->size * array->count);
+                offset += field->size * array->count;
+            }
+        } else if (array->wholeUses == 0 && array->loopAccesses > 0) {
+            fprintf(out, "  members are used separately in loops; --soa stores it as structure of arrays\n");
+        }
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <stdio.h>
+
+#include "lexer.h"
+
+// Place of one member in its struct
+typedef struct {
+    int nameIndex;
+    int typeIndex;          // First token of the member type
+    long long size;         // Whole member, arrays included
+    int align;
+    long long count;        // Array elements, or -1 for a scalar member
+    long long offset;
+    int loopAccesses;       // array[i].member uses inside loops
+} FieldLayout;
+
+typedef struct {
+    int nameIndex;
+    long long size;         // -1 if a member has an unknown type or size
+    int align;
+    long long packedSize;   // Size with the members sorted by alignment
+    int firstField;         // Members are fields[firstField..firstField+fieldCount)
+    int fieldCount;
+} StructLayout;
+
+// An array of structs and how its elements are used
+typedef struct {
+    int nameIndex;
+    int structIndex;
+    long long count;
+    long long size;         // Bytes in its storage order, -1 if that overflows
+    int scopeEnd;           // Last token where the name refers to this array
+    int wholeUses;          // Uses other than name[index].member
+    int loopAccesses;       // name[index].member uses inside loops
+    int soa;                // Stored as one array per member
+    int previous;           // Array of the same name it hides, or -1
+} ArrayLayout;
+
+typedef struct {
+    StructLayout* structs;
+    int structCount;
+    FieldLayout* fields;
+    int fieldCount;
+    ArrayLayout* arrays;
+    int arrayCount;
+} Layout;
+
+// Compute sizes, alignments and offsets (char 1, int and float 4, double 8,
+// structs padded to their strictest member) of every struct, and find the
+// arrays of structs. A struct whose size does not fit in a long long has an
+// unknown size. With soa, arrays whose elements are only ever used member by
+// member, some of them inside loops, are laid out as structure of arrays.
+// Returns 0 if out of memory.
+int compute_layout(const Token *tokens, int token_count, const int *brackets, int soa, Layout *layout);
+void free_layout(Layout *layout);
+
+// Print the structs and arrays of structs with their offsets
+void print_layout(const Layout *layout, const Token *tokens, FILE *out);
+
+#endif
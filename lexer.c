@@ -2,7 +2,11 @@
 #include <ctype.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
 #include "lexer.h"
+#include "hugemem.h"
+#include "util.h"
 
 #define MAX_TOKEN_LEN 256
 #define SAFEALLOC(var,Type) if((var=(Type*)malloc(sizeof(Type)))==NULL) { \
@@ -16,14 +20,19 @@
 //Struct to represent a token - kept in lexer.h
 
 //List of the reserved keywords
-const char *keywords[] = {"if", "else", "while", "return", "int", "float", "char", "void", "for", "double", NULL};
+const char *keywords[] = {"if", "else", "while", "return", "int", "float", "char", "void", "for", "double", "struct", NULL};
 
-//Function to check if a string is a keyword
-int is_keyword(const char *str) {
+//Function to find a keyword, returns its Keyword value or -1
+int keyword_index(const char *str) {
     for(int i = 0; keywords[i] != NULL; i++) {
-        if(strcmp(str,keywords[i]) == 0) return 1;  //Return 1 if keyword
+        if(str[0] == keywords[i][0] && strcmp(str,keywords[i]) == 0) return i;
     }
-    return 0;   //Return 0 if not keyword
+    return -1;  //Not a keyword
+}
+
+//Function to check if a string is a keyword
+int is_keyword(const char *str) {
+    return keyword_index(str) >= 0;
 }
 
 // Helper function to check if a character is a hexadecimal digit
@@ -36,6 +45,22 @@ int is_octal_digit(char c) {
     return c >= '0' && c <= '7';
 }
 
+// Append a character to a token value. Characters past the end of the buffer
+// are dropped, but *i still counts them so end_value can tell.
+static inline void store_char(char *value, int *i, char c) {
+    if (*i < MAX_TOKEN_LEN - 1) {
+        value[*i] = c;
+    }
+    (*i)++;
+}
+
+// NUL-terminate a value built with store_char. Returns 0 if characters were
+// dropped; numeric literals cut short this way are errors.
+static inline int end_value(char *value, int i) {
+    value[i < MAX_TOKEN_LEN - 1 ? i : MAX_TOKEN_LEN - 1] = '\0';
+    return i < MAX_TOKEN_LEN;
+}
+
 // Helper function to handle real number tokenization
 void handle_real_number(const char **input, Token *token) {
     int i = 0;
@@ -44,46 +69,228 @@ void handle_real_number(const char **input, Token *token) {
     
     // Integer part
     while(isdigit(**input)) {
-        token->value[i++] = *(*input)++;
+        store_char(token->value, &i, *(*input)++);
     }
     
     // Decimal point and fraction
     if(**input == '.') {
         has_decimal = 1;
-        token->value[i++] = *(*input)++;
+        store_char(token->value, &i, *(*input)++);
         while(isdigit(**input)) {
-            token->value[i++] = *(*input)++;
+            store_char(token->value, &i, *(*input)++);
         }
     }
     
     // Exponent part
     if(**input == 'e' || **input == 'E') {
         has_exp = 1;
-        token->value[i++] = *(*input)++;
+        store_char(token->value, &i, *(*input)++);
         if(**input == '+' || **input == '-') {
-            token->value[i++] = *(*input)++;
+            store_char(token->value, &i, *(*input)++);
         }
         if(isdigit(**input)) {
             while(isdigit(**input)) {
-                token->value[i++] = *(*input)++;
+                store_char(token->value, &i, *(*input)++);
             }
         } else {
             token->type = TOKEN_ERROR;
-            token->value[i] = '\0';
+            end_value(token->value, i);
             return;
         }
     }
     
-    token->value[i] = '\0';
-    
-    // Valid real number must have either a decimal part or an exponent
-    if(has_exp || has_decimal) {
+    // Valid real number must have either a decimal part or an exponent,
+    // and all of its digits
+    if(end_value(token->value, i) && (has_exp || has_decimal)) {
         token->type = TOKEN_REAL;
     } else {
         token->type = TOKEN_ERROR;
     }
 }
 
+// Powers of ten that are exactly representable as doubles
+static const double exact_powers_of_ten[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+#define MAX_EXACT_POWER 22
+#define MAX_EXACT_MANTISSA (1ULL << 53)
+
+// Value of a hexadecimal digit, without branching on its case
+static inline unsigned hex_value(char c) {
+    return (c & 0xf) + 9 * ((c >> 6) & 1);
+}
+
+// Decode a real literal. Most literals have at most 19 significant digits
+// and a small exponent; when the digits fit in 53 bits and the power of ten
+// is exact, one IEEE multiplication or division gives the correctly rounded
+// result (Clinger's fast path). Everything else goes through strtod.
+// Returns 0 if the value does not fit in a double.
+static int decode_real(const char *text, double *result) {
+    const char *p = text;
+    uint64_t mantissa = 0;
+    int digits = 0;         // Significant digits kept in mantissa
+    int exponent = 0;       // Decimal exponent applied to mantissa
+    int truncated = 0;      // Nonzero digits did not fit in mantissa
+    int fraction = 0;
+
+    for (;; p++) {
+        if (*p == '.' && !fraction) {
+            fraction = 1;
+            continue;
+        }
+        if (!isdigit((unsigned char)*p)) {
+            break;
+        }
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            digits += mantissa != 0;
+            exponent -= fraction;
+        } else {
+            truncated |= *p != '0';
+            exponent += !fraction;
+        }
+    }
+    if (*p == 'e' || *p == 'E') {
+        p++;
+        int negative = *p == '-';
+        if (*p == '+' || *p == '-') {
+            p++;
+        }
+        int value = 0;
+        while (isdigit((unsigned char)*p)) {
+            if (value < 100000) {
+                value = value * 10 + (*p - '0');
+            }
+            p++;
+        }
+        exponent += negative ? -value : value;
+    }
+
+    if (mantissa == 0 && !truncated) {
+        *result = 0.0;
+        return 1;
+    }
+    if (!truncated && mantissa <= MAX_EXACT_MANTISSA) {
+        // Move surplus powers of ten into the mantissa while it stays exact
+        while (exponent > MAX_EXACT_POWER && mantissa <= MAX_EXACT_MANTISSA / 10) {
+            mantissa *= 10;
+            exponent--;
+        }
+        if (exponent >= -MAX_EXACT_POWER && exponent <= MAX_EXACT_POWER) {
+            double value = (double)mantissa;
+            *result = exponent < 0 ? value / exact_powers_of_ten[-exponent]
+                                   : value * exact_powers_of_ten[exponent];
+            return 1;
+        }
+    }
+
+    *result = strtod(text, NULL);
+    return isfinite(*result);
+}
+
+// Decode the escape sequence after a backslash; *input points past the
+// backslash and is moved past the sequence. Returns the byte it stands for.
+int decode_escape(const char **input) {
+    const char *p = *input;
+    int value;
+    switch (*p) {
+        case 'n': value = '\n'; p++; break;
+        case 't': value = '\t'; p++; break;
+        case 'r': value = '\r'; p++; break;
+        case 'a': value = '\a'; p++; break;
+        case 'b': value = '\b'; p++; break;
+        case 'f': value = '\f'; p++; break;
+        case 'v': value = '\v'; p++; break;
+        case 'x':
+            // Hexadecimal escape: as many digits as follow, truncated to a byte
+            value = 0;
+            for (p++; is_hex_digit(*p); p++) {
+                value = ((value << 4) | hex_value(*p)) & 0xff;
+            }
+            break;
+        default:
+            if (is_octal_digit(*p)) {
+                // Octal escape: up to three digits
+                value = 0;
+                for (int n = 0; n < 3 && is_octal_digit(*p); n++, p++) {
+                    value = (value << 3) | (*p - '0');
+                }
+                value &= 0xff;
+            } else if (*p) {
+                value = (unsigned char)*p++;   // \\ \' \" \? and unknown escapes
+            } else {
+                value = '\\';                   // Backslash at the end of the input
+            }
+            break;
+    }
+    *input = p;
+    return value;
+}
+
+// Decode the text of a literal token into token->literal; keywords get
+// their Keyword. Returns 0 if the value of a numeric literal does not fit
+// in 64 bits (integers) or a double (reals), or a keyword token is not a
+// keyword; other tokens are left alone. Literals too long for the token
+// value are already errors from the lexer.
+int decode_literal(Token *token) {
+    const char *p = token->value;
+    uint64_t value = 0;
+
+    switch (token->type) {
+        case TOKEN_NUMBER_ZEC:
+            for (; *p; p++) {
+                unsigned digit = (unsigned)(*p - '0');
+                if (value > ((uint64_t)INT64_MAX - digit) / 10) {
+                    return 0;
+                }
+                value = value * 10 + digit;
+            }
+            break;
+        case TOKEN_NUMBER_HEX:
+            // Like C, hexadecimal and octal literals may use all 64 bits
+            for (p += 2; *p; p++) {
+                if (value >> 60) {
+                    return 0;
+                }
+                value = (value << 4) | hex_value(*p);
+            }
+            break;
+        case TOKEN_NUMBER_OCT:
+            for (; *p; p++) {
+                if (value >> 61) {
+                    return 0;
+                }
+                value = (value << 3) | (unsigned)(*p - '0');
+            }
+            break;
+        case TOKEN_REAL:
+            return decode_real(p, &token->literal.real);
+        case TOKEN_CHAR_LITERAL:
+            // value holds the literal with its quotes
+            p++;
+            if (*p == '\\') {
+                p++;
+                value = (uint64_t)decode_escape(&p);
+            } else if (*p != '\'') {
+                value = (unsigned char)*p;
+            }
+            break;
+        case TOKEN_STRING:
+            // Strings are decoded into a pool after lexing, see strpool.h
+            token->literal.string = -1;
+            return 1;
+        case TOKEN_KEYWORD:
+            token->literal.keyword = keyword_index(token->value);
+            return token->literal.keyword >= 0;
+        default:
+            return 1;
+    }
+    token->literal.integer = (int64_t)value;
+    return 1;
+}
+
 //Function to retrieve the next token from the input string
 Token get_token(const char **input) {
     Token token;    //Initialize token struct
@@ -105,9 +312,9 @@ Token get_token(const char **input) {
         int i = 0;
         // Continue adding characters to token value as long as they are alphanumeric or underscore
         while (isalnum(**input) || **input == '_') {
-            token.value[i++] = *(*input)++;
+            store_char(token.value, &i, *(*input)++);
         }
-        token.value[i] = '\0';  // Null-terminate the string
+        end_value(token.value, i);  // Null-terminate the string
         token.type = is_keyword(token.value) ? TOKEN_KEYWORD : TOKEN_IDENTIFIER;    // Check if it's a keyword
     } else if(isdigit(**input)) {
         // Handle numbers (digits only)
@@ -115,20 +322,27 @@ Token get_token(const char **input) {
         
         // Hexadecimal: starts with '0x'
         if(**input == '0' && (*(*input + 1) == 'x' || *(*input + 1) == 'X')) {
-            token.value[i++] = *(*input)++; // '0'
-            token.value[i++] = *(*input)++; //'x' or 'X'
+            store_char(token.value, &i, *(*input)++); // '0'
+            store_char(token.value, &i, *(*input)++); //'x' or 'X'
             if(is_hex_digit(**input)) {
                 while(is_hex_digit(**input)) {
-                    token.value[i++] = *(*input)++;
+                    store_char(token.value, &i, *(*input)++);
                 }
                 token.type = TOKEN_NUMBER_HEX;
             } else {
                 token.type = TOKEN_ERROR;
             }
         } else if(**input == '0') { // Octal: starts with '0'
-            token.value[i++] = *(*input)++; // '0'
+            // Unless it is a real number such as 0.2e+1
+            const char* peek = *input;
+            while(isdigit(*peek)) peek++;
+            if(*peek == '.' || *peek == 'e' || *peek == 'E') {
+                handle_real_number(input, &token);
+                return token;
+            }
+            store_char(token.value, &i, *(*input)++); // '0'
             while(is_octal_digit(**input)) {
-                token.value[i++] = *(*input)++;
+                store_char(token.value, &i, *(*input)++);
             }
             token.type = TOKEN_NUMBER_OCT;
         } else if(**input >= '0' && **input <='9') {
@@ -150,24 +364,30 @@ Token get_token(const char **input) {
             }
             
             while(isdigit(**input)) {
-                token.value[i++] = *(*input)++;
+                store_char(token.value, &i, *(*input)++);
             }
             token.type = TOKEN_NUMBER_ZEC;
         }
-        token.value[i] = '\0';
+        if (!end_value(token.value, i)) {
+            token.type = TOKEN_ERROR;   // Too long to keep all its digits
+        }
     } else if(**input == '.' && isdigit(*(*input + 1))) {   // Handle the real numbers
         handle_real_number(input, &token);
     } else if(**input == '"') {
         // Handle strings (delimited by double quotes)
         int i = 0;
         (*input)++; // Skip the opening quote
-        // Continue adding characters to token value until closing quote is found
+        // Continue adding characters to token value until closing quote is found.
+        // Escapes are kept as written, so an escaped quote does not end the string.
         while(**input && **input != '"') {
-            token.value[i++] = *(*input)++;
+            if(**input == '\\' && *(*input + 1)) {
+                store_char(token.value, &i, *(*input)++);
+            }
+            store_char(token.value, &i, *(*input)++);
         }
         if(**input == '"')
             (*input)++; // Skip the closing quote
-        token.value[i] = '\0';  // Null-terminate the string
+        end_value(token.value, i);  // Null-terminate; the pool decodes it from the source
         token.type = TOKEN_STRING;  // Token is a string
     } else if(**input == '\'') {
         int i = 0;
@@ -178,6 +398,10 @@ Token get_token(const char **input) {
             if(**input) {
                 token.value[i++] = *(*input)++; //Store escaped characters
             }
+            // Octal and hexadecimal escapes run up to the closing quote
+            while(**input && **input != '\'' && **input != '\n' && i < 8) {
+                token.value[i++] = *(*input)++;
+            }
         } else if(**input && **input != '\'') {
             token.value[i++] = *(*input)++; //Store the character
         }
@@ -350,37 +574,16 @@ Token get_token(const char **input) {
     return token;   // Return the constructed token
 }
 
-// Function to read the entire content of a file into a string
+// Function to read the entire content of a file into a string, exiting if
+// it cannot be read
 char *read_file(const char *filename){
-    FILE *file = fopen(filename, "rb");  // Open the file in read mode
-    
-    if(!file) {
+    size_t length;
+    char *buffer = load_file(filename, &length);
+    if(!buffer) {
         fprintf(stderr, "Error opening file: %s\n", filename);
         exit(1);
     }
-    
-    // Find the file length
-    fseek(file, 0, SEEK_END); 
-    long length = ftell(file);
-    fseek(file, 0, SEEK_SET);
-    
-    // Allocate memory for the file content
-    char *buffer = (char *)malloc(length + 1);
-    if(!buffer){
-        fprintf(stderr, "Memory allocation failure\n");
-        fclose(file);
-        exit(1);
-    }
-    
-    // Read file content into buffer
-    size_t bytes_read = fread(buffer, 1, length, file);
-    if (bytes_read < (size_t)length) {
-        fprintf(stderr, "Warning: Only read %zu of %ld bytes\n", bytes_read, length);
-    }
-    
-    buffer[bytes_read] = '\0';  // Null-terminate the string
-    fclose(file);   // Close the file
-    return buffer;  // Return the file content
+    return buffer;
 }
 
 // Function to handle errors
@@ -389,36 +592,178 @@ void err(const char *message) {
     exit(1);
 }
 
-// Main function to process the input file
-Token *tokenize_file(const char *filename, int *token_count) {
-    char *source = read_file(filename);
+// Function to get the next token of a source string, with its byte offset.
+// *input is the current position inside source.
+Token next_token(const char *source, const char **input) {
+    // Skip whitespace here too, so the token offset points at its first character
+    while (isspace(**input)) {
+        (*input)++;
+    }
+    int offset = (int)(*input - source);
+    Token token = get_token(input);
+    token.offset = offset;
+    // Literals also carry their value; a number that does not fit is an error
+    if (!decode_literal(&token)) {
+        token.type = TOKEN_ERROR;
+    }
+    return token;
+}
+
+// Function to tokenize a source string into a caller-owned token buffer.
+// The buffer is grown as needed and kept, so reusing it across calls avoids
+// allocation once it is large enough. Returns 1 on success, 0 if out of memory.
+int tokenize_source_into(const char *source, Token **tokens, int *capacity, int *token_count) {
     const char *input = source;
-    
-    int capacity = INITIAL_CAPACITY;
     *token_count = 0;
-    Token *tokens = (Token *)malloc(capacity * sizeof(Token));
+
+    Token token;
+    while ((token = next_token(source, &input)).type != TOKEN_EOF) {
+        if (*token_count >= *capacity) {
+            int new_capacity = *capacity > 0 ? *capacity * 2 : INITIAL_CAPACITY;
+            Token *new_tokens = (Token *)huge_realloc(*tokens, new_capacity * sizeof(Token));
+            if (!new_tokens) {
+                return 0;
+            }
+            *tokens = new_tokens;
+            *capacity = new_capacity;
+        }
+        (*tokens)[(*token_count)++] = token;
+    }
+
+    return 1;
+}
+
+// Function to tokenize a source string that is already in memory
+Token *tokenize_source(const char *source, int *token_count) {
+    int capacity = INITIAL_CAPACITY;
+    Token *tokens = (Token *)huge_alloc(capacity * sizeof(Token));
     if (!tokens) {
         fprintf(stderr, "Memory allocation failed for tokens!\n");
-        free(source);
         return NULL;
     }
 
-    Token token;
-    while ((token = get_token(&input)).type != TOKEN_EOF) {
-        if (*token_count >= capacity) {
-            capacity *= 2;
-            Token *new_tokens = (Token *)realloc(tokens, capacity * sizeof(Token));
-            if (!new_tokens) {
-                fprintf(stderr, "Memory reallocation failed!\n");
-                free(tokens);
-                free(source);
-                return NULL;
+    if (!tokenize_source_into(source, &tokens, &capacity, token_count)) {
+        fprintf(stderr, "Memory reallocation failed!\n");
+        huge_free(tokens);
+        return NULL;
+    }
+
+    return tokens;  // Return dynamic array
+}
+
+// Main function to process the input file
+Token *tokenize_file(const char *filename, int *token_count) {
+    char *source = read_file(filename);
+    Token *tokens = tokenize_source(source, token_count);
+    free(source);
+    return tokens;
+}
+
+// Function to match every bracket with its partner in one linear pass.
+// match[i] receives the index of the token matching tokens[i] for ( ) [ ] { },
+// and -1 for other tokens and unmatched brackets. The stack of open brackets
+// is threaded through match itself (each open entry stores the previous top
+// as -(index + 2)), so no extra memory is needed. Returns 1 if balanced.
+int build_bracket_index(const Token *tokens, int token_count, int *match) {
+    int top = -1;
+    int balanced = 1;
+
+    for (int i = 0; i < token_count; i++) {
+        TokenType opener;
+        switch (tokens[i].type) {
+            case TOKEN_LPAREN: case TOKEN_LBRACKET: case TOKEN_LBRACE:
+                match[i] = -(top + 2);  // Push
+                top = i;
+                continue;
+            case TOKEN_RPAREN: opener = TOKEN_LPAREN; break;
+            case TOKEN_RBRACKET: opener = TOKEN_LBRACKET; break;
+            case TOKEN_RBRACE: opener = TOKEN_LBRACE; break;
+            default:
+                match[i] = -1;
+                continue;
+        }
+        if (top >= 0 && tokens[top].type == opener) {
+            int previous = -match[top] - 2;    // Pop
+            match[top] = i;
+            match[i] = top;
+            top = previous;
+        } else {
+            match[i] = -1;  // Stray or mismatched closer
+            balanced = 0;
+        }
+    }
+
+    // Brackets still open at the end have no partner
+    while (top >= 0) {
+        int previous = -match[top] - 2;
+        match[top] = -1;
+        top = previous;
+        balanced = 0;
+    }
+    return balanced;
+}
+
+int token_is_keyword(const Token *token, Keyword keyword) {
+    return token->type == TOKEN_KEYWORD && token->literal.keyword == (int)keyword;
+}
+
+// Walk the statement starting at token i to its last token, using the bracket
+// index. Bodies of for, while and if follow their header; else branches belong
+// to the innermost if that does not have one yet. A header reached with no if
+// pending starts a statement ending where this one does, so with memo such
+// positions are looked up, or set to known_end if it is not -1.
+static int walk_statement(const Token *tokens, int token_count, const int *brackets, int i,
+                          int *memo, int known_end) {
+    int open_ifs = 0;
+    for (;;) {
+        if (i >= token_count) {
+            return token_count - 1;
+        }
+        if (memo && open_ifs == 0) {
+            if (memo[i] >= 0) {
+                return memo[i];
+            }
+            if (known_end >= 0) {
+                memo[i] = known_end;
+            }
+        }
+        int end;
+        const Token *token = &tokens[i];
+        if (token->type == TOKEN_LBRACE && brackets[i] > i) {
+            end = brackets[i];
+        } else if ((token_is_keyword(token, KEYWORD_FOR) || token_is_keyword(token, KEYWORD_WHILE) ||
+                    token_is_keyword(token, KEYWORD_IF)) &&
+                   i + 1 < token_count && brackets[i + 1] > i + 1) {
+            open_ifs += token_is_keyword(token, KEYWORD_IF);
+            i = brackets[i + 1] + 1;
+            continue;
+        } else {
+            while (i < token_count && tokens[i].type != TOKEN_SEMICOLON) {
+                if (brackets[i] > i) {
+                    i = brackets[i];
+                }
+                i++;
             }
-            tokens = new_tokens;
+            end = i < token_count ? i : token_count - 1;
         }
-        tokens[(*token_count)++] = token;
+        if (open_ifs > 0 && end + 1 < token_count && token_is_keyword(&tokens[end + 1], KEYWORD_ELSE)) {
+            open_ifs--;
+            i = end + 2;
+            continue;
+        }
+        return end;
     }
+}
 
-    free(source);
-    return tokens;  // Return dynamic array
-}
\ No newline at end of file
+// Function to find the last token of the statement starting at token i
+int statement_end(const Token *tokens, int token_count, const int *brackets, int i) {
+    return walk_statement(tokens, token_count, brackets, i, NULL, -1);
+}
+
+int statement_end_memo(const Token *tokens, int token_count, const int *brackets, int i, int *memo) {
+    int end = walk_statement(tokens, token_count, brackets, i, memo, -1);
+    if (i < token_count && memo[i] < 0) {
+        walk_statement(tokens, token_count, brackets, i, memo, end);
+    }
+    return end;
+}
@@ -1,6 +1,8 @@
 #ifndef LEXER_H
 #define LEXER_H
 
+#include <stdint.h>
+
 typedef enum {
     TOKEN_IDENTIFIER, TOKEN_NUMBER_ZEC, TOKEN_STRING, TOKEN_PLUS, TOKEN_MINUS,
     TOKEN_MULTIPLY, TOKEN_DIVIDE, TOKEN_ASSIGN, TOKEN_SEMICOLON,
@@ -13,11 +15,40 @@ typedef enum {
     TOKEN_LBRACKET, TOKEN_RBRACKET, TOKEN_REAL, TOKEN_CAST
 } TokenType;
 
+// Keywords, in the order of the lexer's keyword table
+typedef enum {
+    KEYWORD_IF, KEYWORD_ELSE, KEYWORD_WHILE, KEYWORD_RETURN, KEYWORD_INT,
+    KEYWORD_FLOAT, KEYWORD_CHAR, KEYWORD_VOID, KEYWORD_FOR, KEYWORD_DOUBLE,
+    KEYWORD_STRUCT
+} Keyword;
+
 typedef struct {
     TokenType type;
+    int offset;     // Byte offset of the token in the source
+    union {
+        int64_t integer;    // TOKEN_NUMBER_ZEC, TOKEN_NUMBER_HEX, TOKEN_NUMBER_OCT, TOKEN_CHAR_LITERAL
+        double real;        // TOKEN_REAL
+        int string;         // TOKEN_STRING: index in the string pool, -1 until interned
+        int keyword;        // TOKEN_KEYWORD: Keyword, so the parser never compares text
+    } literal;      // Decoded value of a literal
     char value[256];
 } Token;
 
+char *read_file(const char *filename);
+int keyword_index(const char *str);
+int decode_literal(Token *token);
+int decode_escape(const char **input);
+Token next_token(const char *source, const char **input);
+// Token arrays come from huge_alloc (hugemem.h); free them with huge_free
+int tokenize_source_into(const char *source, Token **tokens, int *capacity, int *token_count);
+Token *tokenize_source(const char *source, int *token_count);
 Token *tokenize_file(const char *filename, int *token_count);
+int build_bracket_index(const Token *tokens, int token_count, int *match);
+int token_is_keyword(const Token *token, Keyword keyword);
+int statement_end(const Token *tokens, int token_count, const int *brackets, int start);
+// statement_end for passes that ask about every statement in order. memo holds
+// token_count entries set to -1 and keeps the ends found, so that chains of
+// brace-less for, while and if headers are walked once instead of per header.
+int statement_end_memo(const Token *tokens, int token_count, const int *brackets, int start, int *memo);
 
 #endif
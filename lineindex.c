@@ -0,0 +1,110 @@
+#include <stdlib.h>
+#include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "lineindex.h"
+
+void line_index_init(LineIndex *index, const char *source) {
+    index->source = source;
+    atomic_init(&index->table, NULL);
+}
+
+void line_index_free(LineIndex *index) {
+    free(atomic_load(&index->table));
+    atomic_store(&index->table, NULL);
+}
+
+#if defined(__SSE2__)
+// Bit i set where data[i] is a newline, for 16 bytes
+static inline unsigned newline_mask(const char *data) {
+    __m128i chunk = _mm_loadu_si128((const __m128i *)data);
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')));
+}
+#endif
+
+static size_t count_newlines(const char *data, size_t length) {
+    size_t count = 0, i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= length; i += 16) {
+        count += __builtin_popcount(newline_mask(data + i));
+    }
+#endif
+    for (; i < length; i++) {
+        count += data[i] == '\n';
+    }
+    return count;
+}
+
+static LineTable *build_table(const char *source) {
+    size_t length = strlen(source);
+    size_t lines = count_newlines(source, length) + 1;
+    LineTable *table = (LineTable *)malloc(sizeof(LineTable) + lines * sizeof(int));
+    if (!table) {
+        return NULL;
+    }
+    table->length = length;
+    table->count = (int)lines;
+
+    int n = 0;
+    size_t i = 0;
+    table->starts[n++] = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= length; i += 16) {
+        for (unsigned mask = newline_mask(source + i); mask; mask &= mask - 1) {
+            table->starts[n++] = (int)(i + __builtin_ctz(mask) + 1);
+        }
+    }
+#endif
+    for (; i < length; i++) {
+        if (source[i] == '\n') {
+            table->starts[n++] = (int)(i + 1);
+        }
+    }
+    return table;
+}
+
+int line_index_lookup(LineIndex *index, int offset, int *line, int *column) {
+    LineTable *table = atomic_load_explicit(&index->table, memory_order_acquire);
+    if (!table) {
+        // Several threads may race to build it; the first one to publish wins
+        LineTable *built = build_table(index->source);
+        if (!built) {
+            return 0;
+        }
+        LineTable *expected = NULL;
+        if (atomic_compare_exchange_strong(&index->table, &expected, built)) {
+            table = built;
+        } else {
+            free(built);
+            table = expected;
+        }
+    }
+
+    if (offset < 0 || (size_t)offset > table->length) {
+        offset = (int)table->length;
+    }
+    // Last line starting at or before offset
+    int low = 0, high = table->count - 1;
+    while (low < high) {
+        int mid = low + (high - low + 1) / 2;
+        if (table->starts[mid] <= offset) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+    *line = low + 1;
+    *column = offset - table->starts[low] + 1;
+    return 1;
+}
+
+void print_location(FILE *out, const char *filename, LineIndex *index, int offset, int token_index) {
+    int line, column;
+    if (index && line_index_lookup(index, offset, &line, &column)) {
+        fprintf(out, "%s:%d:%d", filename, line, column);
+    } else {
+        fprintf(out, "%s: token %d", filename, token_index);
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef LINEINDEX_H
+#define LINEINDEX_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+// Start offsets of the lines of a source text
+typedef struct {
+    size_t length;      // Length of the source
+    int count;          // Number of lines
+    int starts[];       // Byte offset of the first character of each line
+} LineTable;
+
+// Maps byte offsets to line and column. Tokens only carry offsets; the
+// table is built on the first lookup, so inputs without diagnostics never
+// pay for it. Lookups are safe from several threads.
+typedef struct {
+    const char *source;
+    _Atomic(LineTable *) table;
+} LineIndex;
+
+void line_index_init(LineIndex *index, const char *source);
+void line_index_free(LineIndex *index);
+
+// 1-based line and column of offset; offsets past the end map to the end
+// of the source. Returns 0 if the table could not be allocated.
+int line_index_lookup(LineIndex *index, int offset, int *line, int *column);
+
+// Print "file:line:column" for offset, or "file: token N" when index is
+// NULL or the table could not be built
+void print_location(FILE *out, const char *filename, LineIndex *index, int offset, int token_index);
+
+#endif
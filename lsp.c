@@ -0,0 +1,1119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include "lsp.h"
+#include "lexer.h"
+#include "parser.h"
+#include "cache.h"
+#include "hugemem.h"
+#include "bounds.h"
+#include "util.h"
+
+#define LSP_DIAG_CAPACITY (64 * 1024)
+#define LSP_MAX_HEADER (64 * 1024)          // Longer headers end the session
+#define LSP_MAX_CONTENT (64 * 1024 * 1024)  // So does a larger Content-Length
+#define LSP_HISTOGRAM_BUCKETS 12    // Upper bounds 0.125 ms * 2^i, the last one open
+#define LSP_POLL_EVERY 32           // Function bodies parsed between checks for newer input
+
+typedef struct {
+    char *data;
+    size_t length;
+    size_t capacity;
+} TextBuffer;
+
+// Last result of one function, found again by the hash of its tokens
+typedef struct {
+    uint64_t hash;
+    int offset;             // Byte offset of its name
+    uint64_t layout;        // Of the text and position it had, when it has a message
+    int ok;
+    int errorOffset;        // Where its diagnostic points, -1 for the end of the text
+    char *message;          // Messages of its body, or NULL
+    int fresh;              // Parsed by the current analysis
+} FunctionResult;
+
+// Token range and hash of a function of the last analysis
+typedef struct {
+    int first;
+    int last;
+    uint64_t hash;
+} FunctionSpan;
+
+typedef struct Document {
+    char *uri;
+    TextBuffer text;
+    long version;
+    int dirty;              // Edited since the last published diagnostics
+    double changedAt;       // When the last edit arrived
+    Token *tokens;          // Kept in step with text by re-lexing around each edit
+    int tokenCount;
+    int tokenCapacity;
+    int tokensValid;        // 0 until the first full lex
+    int sameHead;           // Tokens at the start unchanged since the last analysis
+    int sameTail;           // Same at the end, shifted by the change in count
+    int analyzedCount;      // Token count at the last analysis
+    FunctionSpan *spans;    // Functions of the last analysis, in token order
+    int spanCount;
+    int *brackets;
+    int bracketCapacity;
+    Outline outline;
+    FunctionResult *functions;  // Sorted by hash
+    int functionCount;
+    struct Document *next;
+} Document;
+
+typedef struct {
+    const char *name;
+    long counts[LSP_HISTOGRAM_BUCKETS];
+    long total;
+    double sum;
+    double max;
+} Histogram;
+
+typedef struct {
+    char *input;            // Bytes read from stdin and not yet handled
+    size_t inputLength;
+    size_t inputCapacity;
+    Document *documents;
+    char *diag;
+    BoundsWorkspace *bounds;    // Reused by every analysis
+    Histogram diagnostics;  // Edit received to diagnostics sent
+    Histogram symbols;      // documentSymbol received to answered
+    Histogram analysis;     // Lexing and parsing of one version
+    int shutdown;
+} Server;
+
+static int text_reserve(TextBuffer *buf, size_t extra) {
+    if (buf->length + extra + 1 <= buf->capacity) {
+        return 1;
+    }
+    size_t capacity = buf->capacity ? buf->capacity : 4096;
+    while (capacity < buf->length + extra + 1) {
+        capacity *= 2;
+    }
+    char *data = (char *)realloc(buf->data, capacity);
+    if (!data) {
+        return 0;
+    }
+    buf->data = data;
+    buf->capacity = capacity;
+    return 1;
+}
+
+static int text_put(TextBuffer *buf, const char *data, size_t length) {
+    if (!text_reserve(buf, length)) {
+        return 0;
+    }
+    memcpy(buf->data + buf->length, data, length);
+    buf->length += length;
+    buf->data[buf->length] = '\0';
+    return 1;
+}
+
+static int text_puts(TextBuffer *buf, const char *text) {
+    return text_put(buf, text, strlen(text));
+}
+
+static int text_printf(TextBuffer *buf, const char *format, ...) {
+    char line[512];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    return length >= 0 && (size_t)length < sizeof(line) && text_put(buf, line, length);
+}
+
+// Append text as a JSON string literal
+static int text_put_json_string(TextBuffer *buf, const char *text, size_t length) {
+    int ok = text_puts(buf, "\"");
+    for (size_t i = 0; ok && i < length; i++) {
+        unsigned char c = (unsigned char)text[i];
+        if (c == '"' || c == '\\') {
+            char escaped[2] = {'\\', (char)c};
+            ok = text_put(buf, escaped, 2);
+        } else if (c == '\n') {
+            ok = text_puts(buf, "\\n");
+        } else if (c < 0x20) {
+            ok = text_printf(buf, "\\u%04x", c);
+        } else {
+            ok = text_put(buf, text + i, 1);
+        }
+    }
+    return ok && text_puts(buf, "\"");
+}
+
+static void histogram_add(Histogram *histogram, double ms) {
+    int bucket = 0;
+    for (double bound = 0.125; bucket < LSP_HISTOGRAM_BUCKETS - 1 && ms > bound; bound *= 2) {
+        bucket++;
+    }
+    histogram->counts[bucket]++;
+    histogram->total++;
+    histogram->sum += ms;
+    histogram->max = ms > histogram->max ? ms : histogram->max;
+}
+
+static int histogram_put(TextBuffer *buf, const Histogram *histogram) {
+    int ok = text_printf(buf, "\"%s\":{\"count\":%ld,\"meanMs\":%.4f,\"maxMs\":%.4f,\"buckets\":[",
+                         histogram->name, histogram->total,
+                         histogram->total ? histogram->sum / histogram->total : 0.0, histogram->max);
+    double bound = 0.125;
+    for (int i = 0; ok && i < LSP_HISTOGRAM_BUCKETS; i++, bound *= 2) {
+        if (i < LSP_HISTOGRAM_BUCKETS - 1) {
+            ok = text_printf(buf, "%s{\"leMs\":%g,\"count\":%ld}", i ? "," : "", bound, histogram->counts[i]);
+        } else {
+            ok = text_printf(buf, ",{\"leMs\":null,\"count\":%ld}", histogram->counts[i]);
+        }
+    }
+    return ok && text_puts(buf, "]}");
+}
+
+// JSON is read in place: a value is a pointer to its first character in the
+// NUL-terminated message body
+
+static const char *json_space(const char *p) {
+    while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') {
+        p++;
+    }
+    return p;
+}
+
+// Pointer past the value at p, or NULL if it is malformed
+static const char *json_skip(const char *p) {
+    p = json_space(p);
+    if (*p == '"') {
+        for (p++; *p && *p != '"'; p++) {
+            if (*p == '\\' && p[1]) {
+                p++;
+            }
+        }
+        return *p ? p + 1 : NULL;
+    }
+    if (*p == '{' || *p == '[') {
+        int depth = 0;
+        do {
+            if (*p == '"') {
+                if (!(p = json_skip(p))) {
+                    return NULL;
+                }
+                continue;
+            }
+            if (!*p) {
+                return NULL;
+            }
+            depth += (*p == '{' || *p == '[') - (*p == '}' || *p == ']');
+            p++;
+        } while (depth > 0);
+        return p;
+    }
+    const char *start = p;
+    while (*p && !strchr(",:}] \t\r\n", *p)) {
+        p++;
+    }
+    return p > start ? p : NULL;
+}
+
+// Value of key in the object at p, or NULL
+static const char *json_member(const char *p, const char *key) {
+    if (!p || *(p = json_space(p)) != '{') {
+        return NULL;
+    }
+    size_t key_length = strlen(key);
+    for (p = json_space(p + 1); *p == '"';) {
+        const char *name = p + 1, *after = json_skip(p);
+        if (!after) {
+            return NULL;
+        }
+        p = json_space(after);
+        if (*p != ':') {
+            return NULL;
+        }
+        const char *value = json_space(p + 1);
+        if ((size_t)(after - 1 - name) == key_length && memcmp(name, key, key_length) == 0) {
+            return value;
+        }
+        if (!(p = json_skip(value))) {
+            return NULL;
+        }
+        p = json_space(p);
+        if (*p != ',') {
+            return NULL;
+        }
+        p = json_space(p + 1);
+    }
+    return NULL;
+}
+
+// Follow a NULL-terminated list of keys
+static const char *json_path(const char *p, ...) {
+    va_list keys;
+    va_start(keys, p);
+    for (const char *key; p && (key = va_arg(keys, const char *));) {
+        p = json_member(p, key);
+    }
+    va_end(keys);
+    return p;
+}
+
+// First element of the array at p, or NULL if it is empty
+static const char *json_first(const char *p) {
+    if (!p || *(p = json_space(p)) != '[') {
+        return NULL;
+    }
+    p = json_space(p + 1);
+    return *p == ']' ? NULL : p;
+}
+
+static const char *json_next(const char *element) {
+    const char *p = json_skip(element);
+    if (!p || *(p = json_space(p)) != ',') {
+        return NULL;
+    }
+    return json_space(p + 1);
+}
+
+static int json_long(const char *p, long *value) {
+    char *end;
+    if (!p) {
+        return 0;
+    }
+    *value = strtol(p, &end, 10);
+    return end != p;
+}
+
+static int put_utf8(char *out, uint32_t code) {
+    if (code < 0x80) {
+        out[0] = (char)code;
+        return 1;
+    }
+    if (code < 0x800) {
+        out[0] = (char)(0xc0 | code >> 6);
+        out[1] = (char)(0x80 | (code & 0x3f));
+        return 2;
+    }
+    if (code < 0x10000) {
+        out[0] = (char)(0xe0 | code >> 12);
+        out[1] = (char)(0x80 | ((code >> 6) & 0x3f));
+        out[2] = (char)(0x80 | (code & 0x3f));
+        return 3;
+    }
+    out[0] = (char)(0xf0 | code >> 18);
+    out[1] = (char)(0x80 | ((code >> 12) & 0x3f));
+    out[2] = (char)(0x80 | ((code >> 6) & 0x3f));
+    out[3] = (char)(0x80 | (code & 0x3f));
+    return 4;
+}
+
+// Decode the JSON string at p into a malloc'd UTF-8 buffer
+static char *json_string(const char *p, size_t *length) {
+    const char *end = p ? json_skip(p) : NULL;
+    if (!end || *p != '"') {
+        return NULL;
+    }
+    char *out = (char *)malloc(end - p);
+    size_t n = 0;
+    for (p++; out && p < end - 1; p++) {
+        if (*p != '\\') {
+            out[n++] = *p;
+            continue;
+        }
+        char c = *++p;
+        if (c == 'u' && end - 1 - p > 4) {
+            uint32_t code = (uint32_t)strtoul((char[5]){p[1], p[2], p[3], p[4], 0}, NULL, 16);
+            p += 4;
+            // Surrogate pair for characters outside the basic plane
+            if (code >= 0xd800 && code < 0xdc00 && end - 1 - p > 6 && p[1] == '\\' && p[2] == 'u') {
+                uint32_t low = (uint32_t)strtoul((char[5]){p[3], p[4], p[5], p[6], 0}, NULL, 16);
+                code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                p += 6;
+            }
+            n += put_utf8(out + n, code);
+        } else {
+            out[n++] = c == 'n' ? '\n' : c == 't' ? '\t' : c == 'r' ? '\r' : c == 'b' ? '\b' :
+                       c == 'f' ? '\f' : c;
+        }
+    }
+    if (out) {
+        out[n] = '\0';
+        *length = n;
+    }
+    return out;
+}
+
+// Byte offset of an LSP position: a line and a column in UTF-16 units
+static size_t offset_of(const TextBuffer *text, long line, long character) {
+    size_t i = 0;
+    for (; line > 0; line--) {
+        const char *newline = (const char *)memchr(text->data + i, '\n', text->length - i);
+        if (!newline) {
+            return text->length;
+        }
+        i = newline - text->data + 1;
+    }
+    while (character > 0 && i < text->length && text->data[i] != '\n') {
+        unsigned char c = (unsigned char)text->data[i];
+        int bytes = c < 0x80 ? 1 : c < 0xe0 ? 2 : c < 0xf0 ? 3 : 4;
+        character -= bytes == 4 ? 2 : 1;
+        i += bytes;
+    }
+    return i < text->length ? i : text->length;
+}
+
+// LSP position of a byte offset (-1 for the end of the text)
+static void position_of(const Document *doc, LineIndex *lines, int offset, int *line, int *character) {
+    if (offset < 0 || (size_t)offset > doc->text.length) {
+        offset = (int)doc->text.length;
+    }
+    int row = 1, column = 1;
+    line_index_lookup(lines, offset, &row, &column);
+    *line = row - 1;
+    *character = 0;
+    for (int i = offset - (column - 1); i < offset; i++) {
+        unsigned char c = (unsigned char)doc->text.data[i];
+        *character += (c & 0xc0) != 0x80;
+        *character += c >= 0xf0;
+    }
+}
+
+static int put_range(TextBuffer *buf, const Document *doc, LineIndex *lines, int start, int end) {
+    int start_line, start_character, end_line, end_character;
+    position_of(doc, lines, start, &start_line, &start_character);
+    position_of(doc, lines, end, &end_line, &end_character);
+    return text_printf(buf, "{\"start\":{\"line\":%d,\"character\":%d},\"end\":{\"line\":%d,\"character\":%d}}",
+                       start_line, start_character, end_line, end_character);
+}
+
+// End of the token starting at offset, for the width of a diagnostic
+static int token_end(const Document *doc, int offset) {
+    int low = 0, high = doc->tokenCount;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (doc->tokens[middle].offset < offset) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (offset < 0 || low >= doc->tokenCount || doc->tokens[low].offset != offset) {
+        return offset;
+    }
+    const char *newline = (const char *)memchr(doc->text.data + offset, '\n', doc->text.length - offset);
+    int end = offset + (int)strlen(doc->tokens[low].value);
+    return newline && newline - doc->text.data < end ? (int)(newline - doc->text.data) : end;
+}
+
+// Send one message with its Content-Length header
+static int send_message(const TextBuffer *body) {
+    char header[64];
+    int length = snprintf(header, sizeof(header), "Content-Length: %zu\r\n\r\n", body->length);
+    const char *parts[2] = {header, body->data};
+    size_t sizes[2] = {(size_t)length, body->length};
+    for (int i = 0; i < 2; i++) {
+        for (size_t sent = 0; sent < sizes[i];) {
+            ssize_t n = write(STDOUT_FILENO, parts[i] + sent, sizes[i] - sent);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                return 0;
+            }
+            sent += n;
+        }
+    }
+    return 1;
+}
+
+// Answer a request; result is raw JSON
+static void send_result(const char *id, size_t id_length, const char *result) {
+    TextBuffer body = {0};
+    if (text_puts(&body, "{\"jsonrpc\":\"2.0\",\"id\":") && text_put(&body, id, id_length) &&
+        text_puts(&body, ",\"result\":") && text_put(&body, result, strlen(result)) &&
+        text_puts(&body, "}")) {
+        send_message(&body);
+    }
+    free(body.data);
+}
+
+static void send_error(const char *id, size_t id_length, int code, const char *message) {
+    TextBuffer body = {0};
+    if (text_puts(&body, "{\"jsonrpc\":\"2.0\",\"id\":") && text_put(&body, id, id_length) &&
+        text_printf(&body, ",\"error\":{\"code\":%d,\"message\":\"%s\"}}", code, message)) {
+        send_message(&body);
+    }
+    free(body.data);
+}
+
+// Make sure at least need bytes are buffered. Returns 0 at end of input.
+static int fill_input(Server *server, size_t need) {
+    while (server->inputLength < need) {
+        if (need > server->inputCapacity) {
+            size_t capacity = server->inputCapacity ? server->inputCapacity : 65536;
+            while (capacity < need) {
+                capacity = capacity <= SIZE_MAX / 4 ? capacity * 2 : need;
+            }
+            char *grown = (char *)realloc(server->input, capacity + 1);
+            if (!grown) {
+                return 0;
+            }
+            server->input = grown;
+            server->inputCapacity = capacity;
+        }
+        ssize_t n = read(STDIN_FILENO, server->input + server->inputLength,
+                         server->inputCapacity - server->inputLength);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return 0;
+        }
+        server->inputLength += n;
+    }
+    return 1;
+}
+
+// Whether a message (or part of one) is waiting
+static int input_pending(Server *server) {
+    struct pollfd in = {STDIN_FILENO, POLLIN, 0};
+    return server->inputLength > 0 || poll(&in, 1, 0) > 0;
+}
+
+// Next message body, malloc'd and NUL-terminated, or NULL at end of input
+static char *read_message(Server *server) {
+    size_t header_end = 0, searched = 0;
+    while (!header_end) {
+        for (size_t i = searched; i + 3 < server->inputLength; i++) {
+            if (memcmp(server->input + i, "\r\n\r\n", 4) == 0) {
+                header_end = i + 4;
+                break;
+            }
+        }
+        searched = server->inputLength > 3 ? server->inputLength - 3 : 0;
+        if (!header_end && server->inputLength > LSP_MAX_HEADER) {
+            fprintf(stderr, "LSP header longer than %d bytes\n", LSP_MAX_HEADER);
+            return NULL;
+        }
+        if (!header_end && !fill_input(server, server->inputLength + 1)) {
+            return NULL;
+        }
+    }
+
+    long content_length = -1;
+    server->input[header_end - 2] = '\0';
+    for (char *line = server->input; line && line < server->input + header_end - 2;) {
+        if (strncasecmp(line, "Content-Length:", 15) == 0) {
+            content_length = strtol(line + 15, NULL, 10);
+        }
+        line = strstr(line, "\r\n");
+        line = line ? line + 2 : NULL;
+    }
+    // The framing cannot be trusted past an oversized message, so stop there
+    if (content_length > LSP_MAX_CONTENT) {
+        fprintf(stderr, "LSP Content-Length %ld is over the limit of %d bytes\n",
+                content_length, LSP_MAX_CONTENT);
+        return NULL;
+    }
+    if (content_length < 0 || !fill_input(server, header_end + content_length)) {
+        return NULL;
+    }
+    char *body = (char *)malloc(content_length + 1);
+    if (body) {
+        memcpy(body, server->input + header_end, content_length);
+        body[content_length] = '\0';
+    }
+    server->inputLength -= header_end + content_length;
+    memmove(server->input, server->input + header_end + content_length, server->inputLength);
+    return body;
+}
+
+static Document *find_document(Server *server, const char *uri) {
+    for (Document *doc = server->documents; doc; doc = doc->next) {
+        if (strcmp(doc->uri, uri) == 0) {
+            return doc;
+        }
+    }
+    return NULL;
+}
+
+static void free_results(FunctionResult *results, int count) {
+    for (int i = 0; i < count; i++) {
+        free(results[i].message);
+    }
+    free(results);
+}
+
+static void close_document(Server *server, const char *uri) {
+    for (Document **link = &server->documents; *link; link = &(*link)->next) {
+        Document *doc = *link;
+        if (strcmp(doc->uri, uri) == 0) {
+            *link = doc->next;
+            free(doc->uri);
+            free(doc->text.data);
+            huge_free(doc->tokens);
+            free(doc->spans);
+            free(doc->brackets);
+            free(doc->outline.items);
+            free_results(doc->functions, doc->functionCount);
+            free(doc);
+            return;
+        }
+    }
+}
+
+// First token starting at or after offset
+static int token_at(const Document *doc, int offset) {
+    int low = 0, high = doc->tokenCount;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (doc->tokens[middle].offset < offset) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// Bring the tokens in step with an edit that replaced [start, end) of the
+// old text by length bytes. The lexer keeps no state between tokens, so
+// lexing restarts at the last token before the edit and stops at the first
+// new token after it that starts where an old token did (shifted): the
+// tokens from there on are the old ones.
+static int relex(Document *doc, size_t start, size_t end, size_t length) {
+    int count = doc->tokenCount;
+    int delta = (int)length - (int)(end - start);
+    int first = token_at(doc, (int)start);
+    first = first > 0 ? first - 1 : 0;
+    int resume = token_at(doc, (int)end);
+
+    Token *fresh = NULL;
+    int fresh_count = 0, fresh_capacity = 0;
+    // Text before the first token is whitespace, so an edit there restarts at the edit
+    int restart = first < count && doc->tokens[first].offset < (int)start ? doc->tokens[first].offset : (int)start;
+    const char *input = doc->text.data + restart;
+    for (;;) {
+        Token token = next_token(doc->text.data, &input);
+        if (token.type == TOKEN_EOF) {
+            resume = count;
+            break;
+        }
+        if ((size_t)token.offset >= start + length) {
+            while (resume < count && doc->tokens[resume].offset + delta < token.offset) {
+                resume++;
+            }
+            if (resume < count && doc->tokens[resume].offset + delta == token.offset) {
+                break;
+            }
+        }
+        if (fresh_count == fresh_capacity) {
+            fresh_capacity = fresh_capacity ? fresh_capacity * 2 : 16;
+            Token *grown = (Token *)realloc(fresh, fresh_capacity * sizeof(Token));
+            if (!grown) {
+                free(fresh);
+                return 0;
+            }
+            fresh = grown;
+        }
+        fresh[fresh_count++] = token;
+    }
+
+    int new_count = first + fresh_count + (count - resume);
+    if (new_count > doc->tokenCapacity) {
+        Token *grown = (Token *)huge_realloc(doc->tokens, (new_count + count / 8 + 16) * sizeof(Token));
+        if (!grown) {
+            free(fresh);
+            return 0;
+        }
+        doc->tokens = grown;
+        doc->tokenCapacity = new_count + count / 8 + 16;
+    }
+    memmove(doc->tokens + first + fresh_count, doc->tokens + resume, (count - resume) * sizeof(Token));
+    if (fresh_count > 0) {
+        memcpy(doc->tokens + first, fresh, fresh_count * sizeof(Token));
+    }
+    for (int i = first + fresh_count; delta != 0 && i < new_count; i++) {
+        doc->tokens[i].offset += delta;
+    }
+    free(fresh);
+
+    doc->tokenCount = new_count;
+    doc->sameHead = first < doc->sameHead ? first : doc->sameHead;
+    doc->sameTail = count - resume < doc->sameTail ? count - resume : doc->sameTail;
+    return 1;
+}
+
+// Apply one entry of contentChanges: a range edit or the whole text
+static int apply_change(Document *doc, const char *change) {
+    size_t length;
+    char *text = json_string(json_member(change, "text"), &length);
+    if (!text) {
+        return 0;
+    }
+    const char *range = json_member(change, "range");
+    long start_line, start_character, end_line, end_character;
+    size_t start = 0, end = doc->text.length;
+    if (range && json_long(json_path(range, "start", "line", NULL), &start_line) &&
+        json_long(json_path(range, "start", "character", NULL), &start_character) &&
+        json_long(json_path(range, "end", "line", NULL), &end_line) &&
+        json_long(json_path(range, "end", "character", NULL), &end_character)) {
+        start = offset_of(&doc->text, start_line, start_character);
+        end = offset_of(&doc->text, end_line, end_character);
+        end = end < start ? start : end;
+    }
+
+    int ok = length <= end - start || text_reserve(&doc->text, length - (end - start));
+    if (ok) {
+        char *data = doc->text.data;
+        memmove(data + start + length, data + end, doc->text.length - end + 1);
+        memcpy(data + start, text, length);
+        doc->text.length = doc->text.length - (end - start) + length;
+    }
+    free(text);
+    if (doc->tokensValid && !(ok && relex(doc, start, end, length))) {
+        doc->tokensValid = 0;
+    }
+    return ok;
+}
+
+// Hash of a function's tokens from its return type to its closing '}'
+static uint64_t function_hash(const Token *tokens, int first, int last) {
+    uint64_t hash = 0;
+    for (int k = first; k <= last; k++) {
+        hash = hash_bytes(&tokens[k].type, sizeof(tokens[k].type), hash);
+        hash = hash_bytes(tokens[k].value, strlen(tokens[k].value), hash);
+    }
+    return hash;
+}
+
+// Hash of the function in tokens [first, last], taken from the last
+// analysis when none of its tokens changed since
+static uint64_t span_hash(const Document *doc, int first, int last) {
+    int shift = doc->tokenCount - doc->analyzedCount;
+    int old_first = -1;
+    if (last < doc->sameHead) {
+        old_first = first;
+    } else if (first >= doc->tokenCount - doc->sameTail) {
+        old_first = first - shift;
+    }
+    int low = 0, high = doc->spanCount;
+    while (old_first >= 0 && low < high) {
+        int middle = low + (high - low) / 2;
+        if (doc->spans[middle].first < old_first) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (old_first >= 0 && low < doc->spanCount && doc->spans[low].first == old_first &&
+        doc->spans[low].last == last - (old_first == first ? 0 : shift)) {
+        return doc->spans[low].hash;
+    }
+    return function_hash(doc->tokens, first, last);
+}
+
+static int compare_results(const void *a, const void *b) {
+    uint64_t x = ((const FunctionResult *)a)->hash, y = ((const FunctionResult *)b)->hash;
+    return x < y ? -1 : x > y;
+}
+
+// Hash of the text of the function in tokens [first, last] and of the line
+// and column it starts at. When it and the offset match, every position
+// inside the function is the same.
+static uint64_t function_layout(const Document *doc, LineIndex *lines, int first, int last) {
+    const Token *tokens = doc->tokens;
+    int line = 0, column = 0;
+    line_index_lookup(lines, tokens[first].offset, &line, &column);
+    uint64_t seed = ((uint64_t)(uint32_t)line << 32) | (uint32_t)column;
+    return hash_bytes(doc->text.data + tokens[first].offset, tokens[last].offset + 1 - tokens[first].offset, seed);
+}
+
+// Previous result of a function with these tokens. One with a message is
+// only reused at the same offset, line and column and with the same text,
+// since the message carries positions; the layout is only worked out then.
+static const FunctionResult *find_result(const Document *doc, uint64_t hash, int offset, LineIndex *lines,
+                                         int first, int last) {
+    int low = 0, high = doc->functionCount;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (doc->functions[middle].hash < hash) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    int has_layout = 0;
+    uint64_t layout = 0;
+    for (int i = low; i < doc->functionCount && doc->functions[i].hash == hash; i++) {
+        const FunctionResult *result = &doc->functions[i];
+        if (result->message && result->offset != offset) {
+            continue;
+        }
+        if (result->message && !has_layout) {
+            layout = function_layout(doc, lines, first, last);
+            has_layout = 1;
+        }
+        if (!result->message || result->layout == layout) {
+            return result;
+        }
+    }
+    return NULL;
+}
+
+// Keep the results of the count items of results as the document's
+// function results: all of them, or with partial only the freshly parsed
+// ones added to the previous results
+static int keep_results(Document *doc, const Outline *outline, FunctionResult *results, int count, int partial) {
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+        const OutlineItem *item = &outline->items[i];
+        if (item->kind == OUTLINE_FUNCTION && item->bodyEnd >= 0 && (!partial || results[i].fresh)) {
+            results[kept] = results[i];
+            results[kept++].fresh = 0;
+        } else {
+            free(results[i].message);
+        }
+    }
+    if (partial) {
+        FunctionResult *merged = (FunctionResult *)realloc(doc->functions,
+                                                          (doc->functionCount + kept + 1) * sizeof(FunctionResult));
+        if (!merged) {
+            free_results(results, kept);
+            return 0;
+        }
+        memcpy(merged + doc->functionCount, results, kept * sizeof(FunctionResult));
+        free(results);
+        doc->functions = merged;
+        doc->functionCount += kept;
+    } else {
+        free_results(doc->functions, doc->functionCount);
+        doc->functions = results;
+        doc->functionCount = kept;
+    }
+    qsort(doc->functions, doc->functionCount, sizeof(FunctionResult), compare_results);
+    return 1;
+}
+
+static int put_diagnostic(TextBuffer *buf, const Document *doc, LineIndex *lines, int offset,
+                          const char *message, int *first) {
+    size_t length = strlen(message);
+    while (length > 0 && message[length - 1] == '\n') {
+        length--;
+    }
+    int ok = text_puts(buf, *first ? "{\"range\":" : ",{\"range\":") &&
+             put_range(buf, doc, lines, offset, token_end(doc, offset)) &&
+             text_puts(buf, ",\"severity\":1,\"source\":\"atomc\",\"message\":") &&
+             (length ? text_put_json_string(buf, message, length) :
+                                   text_put_json_string(buf, "Syntax error", 12)) &&
+             text_puts(buf, "}");
+    *first = 0;
+    return ok;
+}
+
+// Lex and parse a document and publish its diagnostics. With cancellable,
+// gives up (returning 0) as soon as a newer message is waiting; the bodies
+// parsed so far are kept for the next attempt.
+static int analyze(Server *server, Document *doc, int cancellable) {
+    double start = now_ms();
+    int ok = 1;
+    if (!doc->tokensValid) {
+        ok = tokenize_source_into(doc->text.data ? doc->text.data : "", &doc->tokens,
+                                  &doc->tokenCapacity, &doc->tokenCount);
+        doc->tokensValid = ok;
+        doc->sameHead = doc->sameTail = 0;
+        doc->spanCount = 0;
+    }
+    if (ok && doc->tokenCount + 1 > doc->bracketCapacity) {
+        int *grown = (int *)realloc(doc->brackets, (doc->tokenCount + 1) * sizeof(int));
+        ok = grown != NULL;
+        if (ok) {
+            doc->brackets = grown;
+            doc->bracketCapacity = doc->tokenCount + 1;
+        }
+    }
+    if (!ok) {
+        doc->tokenCount = 0;
+        return 1;
+    }
+    build_bracket_index(doc->tokens, doc->tokenCount, doc->brackets);
+
+    LineIndex lines;
+    line_index_init(&lines, doc->text.data ? doc->text.data : "");
+    ParseDiagnostics diag = {server->diag, LSP_DIAG_CAPACITY, 0, 0, &lines, 0, -1};
+    server->diag[0] = '\0';
+    int skeleton_ok = parseOutline(doc->tokens, doc->tokenCount, doc->brackets, &doc->outline, &diag);
+
+    TextBuffer body = {0};
+    int first = 1;
+    ok = text_puts(&body, "{\"jsonrpc\":\"2.0\",\"method\":\"textDocument/publishDiagnostics\",\"params\":{\"uri\":") &&
+         text_put_json_string(&body, doc->uri, strlen(doc->uri)) &&
+         text_printf(&body, ",\"version\":%ld,\"diagnostics\":[", doc->version);
+    if (!skeleton_ok) {
+        // Without a skeleton the function boundaries are unknown; the
+        // results of the last good version stay for the next edit
+        ok = ok && put_diagnostic(&body, doc, &lines, diag.errors ? diag.errorOffset : -1, server->diag, &first);
+    } else {
+        const Outline *outline = &doc->outline;
+        FunctionResult *results = (FunctionResult *)calloc(outline->count + 1, sizeof(FunctionResult));
+        FunctionSpan *spans = (FunctionSpan *)malloc((outline->count + 1) * sizeof(FunctionSpan));
+        int span_count = 0;
+        ok = ok && results && spans;
+        int parsed = 0;
+        for (int i = 0; ok && i < outline->count; i++) {
+            const OutlineItem *item = &outline->items[i];
+            FunctionResult *result = &results[i];
+            result->ok = 1;
+            if (item->kind != OUTLINE_FUNCTION || item->bodyEnd < 0) {
+                continue;
+            }
+            int first_token = item->nameIndex > 0 ? item->nameIndex - 1 : 0;
+            result->hash = span_hash(doc, first_token, item->bodyEnd);
+            result->offset = doc->tokens[item->nameIndex].offset;
+            spans[span_count].first = first_token;
+            spans[span_count].last = item->bodyEnd;
+            spans[span_count++].hash = result->hash;
+            const FunctionResult *previous = find_result(doc, result->hash, result->offset, &lines,
+                                                         first_token, item->bodyEnd);
+            if (previous) {
+                result->ok = previous->ok;
+                result->layout = previous->layout;
+                result->errorOffset = previous->errorOffset;
+                result->message = previous->message ? strdup(previous->message) : NULL;
+            } else {
+                if (cancellable && ++parsed % LSP_POLL_EVERY == 0 && input_pending(server)) {
+                    keep_results(doc, outline, results, i, 1);
+                    free(spans);
+                    free(body.data);
+                    line_index_free(&lines);
+                    return 0;
+                }
+                ParseDiagnostics function = {server->diag, LSP_DIAG_CAPACITY, 0, 0, &lines, 0, -1};
+                result->ok = parseFunctionBody(doc->tokens, doc->tokenCount, item, &function);
+                result->errorOffset = function.errors ? function.errorOffset : result->offset;
+                result->message = function.length ? strdup(server->diag) : NULL;
+                if (result->message) {
+                    result->layout = function_layout(doc, &lines, first_token, item->bodyEnd);
+                }
+                result->fresh = 1;
+            }
+            if (!result->ok) {
+                ok = put_diagnostic(&body, doc, &lines, result->errorOffset,
+                                    result->message ? result->message : "", &first);
+            }
+        }
+        // Like the command line, check array bounds once the syntax is clean
+        if (ok && first) {
+            BoundsReport report;
+            ParseDiagnostics bounds = {server->diag, LSP_DIAG_CAPACITY, 0, 0, &lines, 0, -1};
+            server->diag[0] = '\0';
+            int bounds_ok = check_array_bounds_into(doc->tokens, doc->tokenCount, doc->brackets, doc->uri,
+                                                    server->bounds, &bounds, &report);
+            if (bounds_ok == 0) {
+                ok = put_diagnostic(&body, doc, &lines, report.errorOffset, server->diag, &first);
+            }
+        }
+        if (results) {
+            keep_results(doc, outline, results, outline->count, 0);
+        }
+        // Everything is now relative to this analysis
+        if (ok) {
+            free(doc->spans);
+            doc->spans = spans;
+            doc->spanCount = span_count;
+            doc->sameHead = doc->sameTail = doc->analyzedCount = doc->tokenCount;
+        } else {
+            free(spans);
+        }
+    }
+    ok = ok && text_puts(&body, "]}}");
+    if (ok) {
+        send_message(&body);
+    }
+    free(body.data);
+    line_index_free(&lines);
+
+    double end = now_ms();
+    histogram_add(&server->analysis, end - start);
+    if (doc->dirty) {
+        histogram_add(&server->diagnostics, end - doc->changedAt);
+    }
+    doc->dirty = 0;
+    return 1;
+}
+
+static void document_symbols(Server *server, Document *doc, const char *id, size_t id_length) {
+    static const int kinds[] = {12, 13, 23};    // LSP SymbolKind Function, Variable, Struct
+    if (doc->dirty) {
+        analyze(server, doc, 0);
+    }
+    LineIndex lines;
+    line_index_init(&lines, doc->text.data ? doc->text.data : "");
+    TextBuffer result = {0};
+    int ok = text_puts(&result, "[");
+    for (int i = 0; ok && i < doc->outline.count; i++) {
+        const OutlineItem *item = &doc->outline.items[i];
+        const Token *name = &doc->tokens[item->nameIndex];
+        int end = item->bodyEnd >= 0 ? doc->tokens[item->bodyEnd].offset + 1 : token_end(doc, name->offset);
+        if (item->kind == OUTLINE_STRUCT && item->nameIndex + 1 < doc->tokenCount &&
+            doc->brackets[item->nameIndex + 1] > item->nameIndex + 1) {
+            end = doc->tokens[doc->brackets[item->nameIndex + 1]].offset + 1;
+        }
+        ok = text_puts(&result, i ? ",{\"name\":" : "{\"name\":") &&
+             text_put_json_string(&result, name->value, strlen(name->value)) &&
+             text_printf(&result, ",\"kind\":%d,\"range\":", kinds[item->kind]) &&
+             put_range(&result, doc, &lines, name->offset, end) &&
+             text_puts(&result, ",\"selectionRange\":") &&
+             put_range(&result, doc, &lines, name->offset, token_end(doc, name->offset)) &&
+             text_puts(&result, "}");
+    }
+    ok = ok && text_puts(&result, "]");
+    if (ok) {
+        send_result(id, id_length, result.data);
+    } else {
+        send_error(id, id_length, -32603, "Out of memory");
+    }
+    free(result.data);
+    line_index_free(&lines);
+}
+
+static void latency_report(Server *server, const char *id, size_t id_length) {
+    TextBuffer result = {0};
+    if (text_puts(&result, "{") && histogram_put(&result, &server->diagnostics) &&
+        text_puts(&result, ",") && histogram_put(&result, &server->symbols) &&
+        text_puts(&result, ",") && histogram_put(&result, &server->analysis) &&
+        text_puts(&result, "}")) {
+        send_result(id, id_length, result.data);
+    }
+    free(result.data);
+}
+
+// Handle one message. Returns the exit code after "exit", -1 otherwise.
+static int handle_message(Server *server, const char *message, double received) {
+    size_t length;
+    char *method = json_string(json_member(message, "method"), &length);
+    const char *id = json_member(message, "id");
+    const char *id_end = id ? json_skip(id) : NULL;
+    size_t id_length = id_end ? (size_t)(id_end - id) : 0;
+    const char *params = json_member(message, "params");
+    char *uri = json_string(json_path(params, "textDocument", "uri", NULL), &length);
+    Document *doc = uri ? find_document(server, uri) : NULL;
+    int code = -1;
+
+    if (!method) {
+        // Responses to requests we never send
+    } else if (strcmp(method, "exit") == 0) {
+        code = server->shutdown ? 0 : 1;
+    } else if (id_end && server->shutdown) {
+        send_error(id, id_length, -32600, "Server is shut down");
+    } else if (strcmp(method, "initialize") == 0 && id_end) {
+        send_result(id, id_length,
+                    "{\"capabilities\":{\"textDocumentSync\":{\"openClose\":true,\"change\":2},"
+                    "\"documentSymbolProvider\":true},"
+                    "\"serverInfo\":{\"name\":\"atomc-lsp\",\"version\":\"" COMPILER_VERSION "\"}}");
+    } else if (strcmp(method, "shutdown") == 0 && id_end) {
+        server->shutdown = 1;
+        send_result(id, id_length, "null");
+    } else if (strcmp(method, "textDocument/didOpen") == 0 && uri) {
+        if (doc) {
+            close_document(server, uri);
+        }
+        doc = (Document *)calloc(1, sizeof(Document));
+        char *text = json_string(json_path(params, "textDocument", "text", NULL), &length);
+        if (doc && text && (doc->uri = strdup(uri))) {
+            doc->text.data = text;
+            doc->text.length = length;
+            doc->text.capacity = length + 1;
+            json_long(json_path(params, "textDocument", "version", NULL), &doc->version);
+            doc->dirty = 1;
+            doc->changedAt = received;
+            doc->next = server->documents;
+            server->documents = doc;
+        } else {
+            free(text);
+            free(doc);
+        }
+    } else if (strcmp(method, "textDocument/didChange") == 0 && doc) {
+        json_long(json_path(params, "textDocument", "version", NULL), &doc->version);
+        for (const char *change = json_first(json_member(params, "contentChanges")); change;
+             change = json_next(change)) {
+            apply_change(doc, change);
+        }
+        doc->dirty = 1;
+        doc->changedAt = received;
+    } else if (strcmp(method, "textDocument/didClose") == 0 && uri) {
+        close_document(server, uri);
+        TextBuffer body = {0};
+        if (text_puts(&body, "{\"jsonrpc\":\"2.0\",\"method\":\"textDocument/publishDiagnostics\",\"params\":{\"uri\":") &&
+            text_put_json_string(&body, uri, strlen(uri)) && text_puts(&body, ",\"diagnostics\":[]}}")) {
+            send_message(&body);
+        }
+        free(body.data);
+    } else if (strcmp(method, "textDocument/documentSymbol") == 0 && id_end) {
+        if (doc) {
+            document_symbols(server, doc, id, id_length);
+        } else {
+            send_result(id, id_length, "[]");
+        }
+        histogram_add(&server->symbols, now_ms() - received);
+    } else if (strcmp(method, "atomc/latency") == 0 && id_end) {
+        latency_report(server, id, id_length);
+    } else if (id_end) {
+        send_error(id, id_length, -32601, "Method not found");
+    }
+
+    free(method);
+    free(uri);
+    return code;
+}
+
+int run_lsp(void) {
+    Server server;
+    memset(&server, 0, sizeof(server));
+    server.diagnostics.name = "diagnostics";
+    server.symbols.name = "documentSymbol";
+    server.analysis.name = "analysis";
+    server.diag = (char *)malloc(LSP_DIAG_CAPACITY);
+    server.bounds = bounds_workspace_new();
+    if (!server.diag || !server.bounds) {
+        free(server.diag);
+        bounds_workspace_free(server.bounds);
+        return 1;
+    }
+
+    int code = 1;
+    for (;;) {
+        // Analysis waits until every queued edit has been applied
+        Document *dirty = server.documents;
+        while (dirty && !dirty->dirty) {
+            dirty = dirty->next;
+        }
+        if (dirty && !input_pending(&server)) {
+            analyze(&server, dirty, 1);
+            continue;
+        }
+
+        char *message = read_message(&server);
+        if (!message) {
+            break;
+        }
+        code = handle_message(&server, message, now_ms());
+        free(message);
+        if (code >= 0) {
+            break;
+        }
+        code = 1;
+    }
+
+    while (server.documents) {
+        close_document(&server, server.documents->uri);
+    }
+    free(server.input);
+    free(server.diag);
+    bounds_workspace_free(server.bounds);
+    return code;
+}
@@ -0,0 +1,17 @@
+#ifndef LSP_H
+#define LSP_H
+
+// Language server over stdin and stdout (JSON-RPC with Content-Length
+// headers, the LSP base protocol). Open documents keep their text, tokens,
+// outline and the result of every function body; an edit re-lexes only the
+// tokens around it and parses again only the skeleton and the functions
+// whose tokens changed, and analysis waits
+// until no newer message is queued, so stale versions are dropped instead
+// of analyzed. Supports incremental text sync, publishDiagnostics and
+// documentSymbol, plus the custom request "atomc/latency" returning
+// histograms of the edit-to-diagnostics, documentSymbol and analysis times.
+
+// Serve until "exit". Returns 0 after a shutdown request, 1 otherwise.
+int run_lsp(void);
+
+#endif
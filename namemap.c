@@ -0,0 +1,77 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "namemap.h"
+#include "cache.h"
+
+void name_map_init(NameMap *map) {
+    memset(map, 0, sizeof(*map));
+}
+
+void name_map_free(NameMap *map) {
+    free(map->keys);
+    free(map->values);
+    memset(map, 0, sizeof(*map));
+}
+
+void name_map_clear(NameMap *map) {
+    if (map->size > 0) {
+        memset(map->keys, 0, map->size * sizeof(const char *));
+    }
+    map->used = 0;
+}
+
+static size_t find_slot(const NameMap *map, const char *name) {
+    size_t mask = map->size - 1;
+    size_t slot = hash_bytes(name, strlen(name), 0) & mask;
+    while (map->keys[slot] && strcmp(map->keys[slot], name) != 0) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+int name_map_get(const NameMap *map, const char *name) {
+    if (map->size == 0) {
+        return -1;
+    }
+    size_t slot = find_slot(map, name);
+    return map->keys[slot] ? map->values[slot] : -1;
+}
+
+// Double the table, keeping it at most half full
+static int grow(NameMap *map) {
+    NameMap bigger;
+    bigger.size = map->size ? map->size * 2 : 64;
+    bigger.used = map->used;
+    bigger.keys = (const char **)calloc(bigger.size, sizeof(const char *));
+    bigger.values = (int *)malloc(bigger.size * sizeof(int));
+    if (!bigger.keys || !bigger.values) {
+        free(bigger.keys);
+        free(bigger.values);
+        return 0;
+    }
+    for (size_t i = 0; i < map->size; i++) {
+        if (map->keys[i]) {
+            size_t slot = find_slot(&bigger, map->keys[i]);
+            bigger.keys[slot] = map->keys[i];
+            bigger.values[slot] = map->values[i];
+        }
+    }
+    free(map->keys);
+    free(map->values);
+    *map = bigger;
+    return 1;
+}
+
+int name_map_set(NameMap *map, const char *name, int index) {
+    if ((map->used + 1) * 2 > map->size && !grow(map)) {
+        return 0;
+    }
+    size_t slot = find_slot(map, name);
+    if (!map->keys[slot]) {
+        map->keys[slot] = name;
+        map->used++;
+    }
+    map->values[slot] = index;
+    return 1;
+}
@@ -0,0 +1,28 @@
+#ifndef NAMEMAP_H
+#define NAMEMAP_H
+
+#include <stddef.h>
+
+// Hash map from a name to the index of its innermost declaration, for the
+// analyses that walk scopes. Keys are not copied: they must outlive the map
+// (token text does). Older declarations of the same name are chained by
+// the caller, which restores them with name_map_set when a scope closes.
+typedef struct {
+    const char **keys;
+    int *values;
+    size_t size;            // Slots, a power of two
+    size_t used;
+} NameMap;
+
+void name_map_init(NameMap *map);
+void name_map_free(NameMap *map);
+// Forget every name but keep the table for reuse
+void name_map_clear(NameMap *map);
+
+// Index stored for name, or -1
+int name_map_get(const NameMap *map, const char *name);
+
+// Store index for name (-1 hides it). Returns 0 if out of memory.
+int name_map_set(NameMap *map, const char *name, int index);
+
+#endif
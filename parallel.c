@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "parallel.h"
+#include "hugemem.h"
+
+#define WORKER_DIAG_CAPACITY (64 * 1024)
+#define BODIES_PER_GRAB 16
+
+// Outcome of one function body
+typedef struct {
+    int ok;
+    int worker;
+    size_t diagStart;
+    size_t diagLength;
+} BodyResult;
+
+typedef struct {
+    Token *tokens;
+    int tokenCount;
+    const Outline *outline;
+    BodyResult *results;
+    atomic_int next;    // Next outline item to hand out
+    int trace;
+    LineIndex *lines;
+} SharedWork;
+
+typedef struct {
+    SharedWork *work;
+    int id;
+    char *buffer;
+    size_t length;
+} Worker;
+
+static void *worker_main(void *arg) {
+    Worker *worker = (Worker *)arg;
+    SharedWork *work = worker->work;
+    const Outline *outline = work->outline;
+
+    // With huge pages on a NUMA machine the helper threads spread over the
+    // nodes; each allocates its buffer once placed, so the pages are local to it
+    if (worker->id > 0) {
+        numa_place_worker(worker->id);
+    }
+    worker->buffer = (char *)malloc(WORKER_DIAG_CAPACITY);
+    if (!worker->buffer) {
+        return NULL;    // The others take its share
+    }
+    worker->buffer[0] = '\0';
+
+    for (;;) {
+        // Grab a small run of items at a time to keep the counter cold
+        int first = atomic_fetch_add(&work->next, BODIES_PER_GRAB);
+        if (first >= outline->count) {
+            break;
+        }
+        int last = first + BODIES_PER_GRAB < outline->count ? first + BODIES_PER_GRAB : outline->count;
+        for (int i = first; i < last; i++) {
+            const OutlineItem *item = &outline->items[i];
+            BodyResult *result = &work->results[i];
+            result->ok = 1;
+            result->worker = worker->id;
+            result->diagStart = worker->length;
+            result->diagLength = 0;
+            // Bodies the skeleton could not skip were already parsed there
+            if (item->kind != OUTLINE_FUNCTION || item->bodyEnd < 0) {
+                continue;
+            }
+
+            ParseDiagnostics diag = {worker->buffer + worker->length,
+                                     WORKER_DIAG_CAPACITY - worker->length, 0, work->trace,
+                                     work->lines, 0, 0};
+            result->ok = parseFunctionBody(work->tokens, work->tokenCount, item, &diag);
+            result->diagLength = diag.length;
+            worker->length += diag.length;
+        }
+    }
+    return NULL;
+}
+
+// Append text to diag the way the parser would (buffer or stdout)
+static void merge_text(ParseDiagnostics *diag, const char *text, size_t length) {
+    if (!diag || !diag->buffer) {
+        fwrite(text, 1, length, stdout);
+        return;
+    }
+    if (diag->length + 1 >= diag->capacity) {
+        return;
+    }
+    size_t room = diag->capacity - diag->length - 1;
+    if (length > room) {
+        length = room;
+    }
+    memcpy(diag->buffer + diag->length, text, length);
+    diag->length += length;
+    diag->buffer[diag->length] = '\0';
+}
+
+int parse_parallel(Token *tokens, int token_count, int jobs, ParseDiagnostics *diag) {
+    int *brackets = (int *)huge_alloc((token_count + 1) * sizeof(int));
+    if (!brackets) {
+        return 0;
+    }
+    build_bracket_index(tokens, token_count, brackets);
+
+    // Skeleton: top-level declarations, with function bodies skipped
+    Outline outline = {NULL, 0, 0};
+    int ok = parseOutline(tokens, token_count, brackets, &outline, diag);
+    if (!ok || outline.count == 0) {
+        free(outline.items);
+        huge_free(brackets);
+        return ok;
+    }
+
+    if (jobs > outline.count) {
+        jobs = outline.count;
+    }
+    SharedWork work;
+    work.tokens = tokens;
+    work.tokenCount = token_count;
+    work.outline = &outline;
+    work.results = (BodyResult *)calloc(outline.count, sizeof(BodyResult));
+    work.trace = diag ? diag->trace : 0;
+    work.lines = diag ? diag->lines : NULL;
+    atomic_init(&work.next, 0);
+    Worker *workers = (Worker *)calloc(jobs, sizeof(Worker));
+    pthread_t *threads = (pthread_t *)calloc(jobs, sizeof(pthread_t));
+    if (!work.results || !workers || !threads) {
+        ok = 0;
+        jobs = 0;
+    }
+
+    // Worker 0 runs on the calling thread
+    int started = 0;
+    for (int i = 0; i < jobs; i++) {
+        workers[i].work = &work;
+        workers[i].id = i;
+        if (i > 0 && pthread_create(&threads[i], NULL, worker_main, &workers[i]) != 0) {
+            break;
+        }
+        started = i + 1;
+    }
+    if (started > 0) {
+        worker_main(&workers[0]);
+    }
+    for (int i = 1; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    // Merge the outcome in source order
+    for (int i = 0; started > 0 && i < outline.count; i++) {
+        const BodyResult *result = &work.results[i];
+        if (result->diagLength > 0) {
+            merge_text(diag, workers[result->worker].buffer + result->diagStart, result->diagLength);
+        }
+        if (!result->ok) {
+            ok = 0;
+        }
+    }
+
+    for (int i = 0; i < jobs && workers; i++) {
+        free(workers[i].buffer);
+    }
+    free(workers);
+    free(threads);
+    free(work.results);
+    free(outline.items);
+    huge_free(brackets);
+    return ok;
+}
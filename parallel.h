@@ -0,0 +1,13 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "lexer.h"
+#include "parser.h"
+
+// Parse a program with the top-level skeleton on the calling thread and the
+// function bodies spread over `jobs` worker threads. Each worker collects its
+// messages in its own buffer; they are merged into diag in source order, so
+// the output does not depend on scheduling. Returns 1 if successful, 0 otherwise.
+int parse_parallel(Token *tokens, int token_count, int jobs, ParseDiagnostics *diag);
+
+#endif
@@ -2,273 +2,491 @@
 #include <string.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <stdarg.h>
 
 #include "lexer.h"
 #include "parser.h"
 
+// The expression and statement parsers keep their nesting on explicit
+// heap stacks instead of the C stack, so input depth is limited only by memory.
+typedef enum {
+    FRAME_PAREN,        // ( expr )
+    FRAME_INDEX,        // [ expr ]
+    FRAME_CALL          // f( expr, ... )
+} ExprFrameKind;
+
+typedef struct {
+    unsigned char kind;
+    bool onlyAssigns;   // Enclosing expression state, restored on close
+    bool castSeen;
+} ExprFrame;
+
+typedef enum {
+    STMT_BLOCK,         // Inside { ... }
+    STMT_IF,            // if (...) body, may be followed by else
+    STMT_ELSE,          // else body
+    STMT_LOOP           // for/while body
+} StmtFrameKind;
+
+// What a top-level or block item is, decided before any of it is consumed
+typedef enum {
+    ITEM_STATEMENT,
+    ITEM_FUNCTION,
+    ITEM_VARIABLE,
+    ITEM_STRUCT
+} ItemKind;
+
 typedef struct {
     Token* tokens;
     int tokenCount;
     int currentIndex;
+    TokenStream* stream;        // Supplies more tokens on demand, or NULL
+    ParseDiagnostics* diag;     // NULL: errors to stdout, no trace
+    const int* brackets;        // Matching bracket of each token, or NULL
+    Outline* outline;           // Collects top-level items, or NULL
+    bool skimBodies;            // Skip function bodies using brackets
+    int nesting;                // Depth of blocks and struct bodies
+    ExprFrame* exprStack;       // Open (, [ and call argument lists
+    int exprTop;
+    int exprCapacity;
+    unsigned char* stmtStack;   // Open blocks and statements awaiting a body
+    int stmtTop;
+    int stmtCapacity;
 } Parser;
 
 void initParser(Parser* parser, Token* tokens, int tokenCount) {
     parser->tokens = tokens;
     parser->tokenCount = tokenCount;
     parser->currentIndex = 0;
+    parser->stream = NULL;
+    parser->diag = NULL;
+    parser->brackets = NULL;
+    parser->outline = NULL;
+    parser->skimBodies = false;
+    parser->nesting = 0;
+    parser->exprStack = NULL;
+    parser->exprTop = 0;
+    parser->exprCapacity = 0;
+    parser->stmtStack = NULL;
+    parser->stmtTop = 0;
+    parser->stmtCapacity = 0;
+}
+
+void finishParser(Parser* parser) {
+    free(parser->exprStack);
+    free(parser->stmtStack);
+    parser->exprStack = NULL;
+    parser->stmtStack = NULL;
+}
+
+// Append a message to the diagnostic buffer, or print it if there is none
+static void emitMessage(Parser* parser, const char* format, va_list args) {
+    ParseDiagnostics* diag = parser->diag;
+    if (!diag || !diag->buffer) {
+        vprintf(format, args);
+        return;
+    }
+    // Messages that do not fit are truncated; the buffer is never reallocated
+    if (diag->length + 1 < diag->capacity) {
+        int written = vsnprintf(diag->buffer + diag->length, diag->capacity - diag->length, format, args);
+        if (written > 0) {
+            diag->length += (size_t)written;
+            if (diag->length >= diag->capacity) {
+                diag->length = diag->capacity - 1;
+            }
+        }
+    }
+}
+
+// Report a syntax error
+static void report(Parser* parser, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    emitMessage(parser, format, args);
+    va_end(args);
+}
+
+// Debug trace of the parser's progress, only emitted when tracing is on
+static void trace(Parser* parser, const char* format, ...) {
+    if (!parser->diag || !parser->diag->trace) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    emitMessage(parser, format, args);
+    va_end(args);
+}
+
+// Position of the token at index for error messages: "line L, column C"
+// when the source is known, otherwise "token N"
+static const char* positionOf(Parser* parser, int index, char* buffer, size_t size) {
+    int line, column;
+    int offset = index < parser->tokenCount ? parser->tokens[index].offset : -1;
+    if (parser->diag && parser->diag->errors++ == 0) {
+        parser->diag->errorOffset = offset;
+    }
+    if (parser->diag && parser->diag->lines) {
+        if (line_index_lookup(parser->diag->lines, offset, &line, &column)) {
+            snprintf(buffer, size, "line %d, column %d", line, column);
+            return buffer;
+        }
+    }
+    snprintf(buffer, size, "token %d", index);
+    return buffer;
+}
+
+// Pull tokens from the stream until index is available. Returns false
+// once the stream has ended before index.
+static bool fillTokens(Parser* parser, int index) {
+    TokenStream* stream = parser->stream;
+    if (!stream) {
+        return false;
+    }
+    while (stream->tokenCount <= index && stream->fill(stream)) {
+    }
+    // The stream may have moved its array while growing it
+    parser->tokens = stream->tokens;
+    parser->tokenCount = stream->tokenCount;
+    return index < parser->tokenCount;
 }
 
 Token getCurrentToken(Parser* parser) {
-    if(parser->currentIndex < parser->tokenCount) {
+    if(parser->currentIndex < parser->tokenCount || fillTokens(parser, parser->currentIndex)) {
         return parser->tokens[parser->currentIndex];
     } else {
-        Token eofToken = {TOKEN_EOF, "EOF"};
+        Token eofToken = {.type = TOKEN_EOF, .value = "EOF"};
         return eofToken;
     }
 }
 
 Token peekNextToken(Parser* parser) {
-    if(parser->currentIndex + 1 < parser->tokenCount) {
+    if(parser->currentIndex + 1 < parser->tokenCount || fillTokens(parser, parser->currentIndex + 1)) {
         return parser->tokens[parser->currentIndex + 1];
     } else {
-        Token eofToken = {TOKEN_EOF, "EOF"};
+        Token eofToken = {.type = TOKEN_EOF, .value = "EOF"};
         return eofToken;
     }
 }
 
+// Type of the token at index, without copying the token
+static inline TokenType typeAt(Parser* parser, int index) {
+    if (index < parser->tokenCount || fillTokens(parser, index)) {
+        return parser->tokens[index].type;
+    }
+    return TOKEN_EOF;
+}
+
+static inline TokenType currentType(Parser* parser) {
+    return typeAt(parser, parser->currentIndex);
+}
+
+// Keyword of the token at index, or -1 if it is not a keyword
+static inline int keywordAt(Parser* parser, int index) {
+    return typeAt(parser, index) == TOKEN_KEYWORD ? parser->tokens[index].literal.keyword : -1;
+}
+
+static inline bool isTypeKeyword(int keyword) {
+    return keyword == KEYWORD_INT || keyword == KEYWORD_FLOAT || keyword == KEYWORD_CHAR ||
+           keyword == KEYWORD_VOID || keyword == KEYWORD_DOUBLE;
+}
+
 void advance(Parser* parser) {
     parser->currentIndex++;
 }
 
 bool match(Parser* parser, TokenType type) {
-    Token currentToken = getCurrentToken(parser);
-    if (currentToken.type == type) {
+    if (currentType(parser) == type) {
         advance(parser);
         return true;
     }
     return false;
 }
 
-void backup(Parser* src, Parser* dest) {
-    dest->tokens = src->tokens;
-    dest->tokenCount = src->tokenCount;
-    dest->currentIndex = src->currentIndex;
+static bool pushExprFrame(Parser* parser, ExprFrameKind kind, bool onlyAssigns, bool castSeen) {
+    if (parser->exprTop >= parser->exprCapacity) {
+        int capacity = parser->exprCapacity > 0 ? parser->exprCapacity * 2 : 32;
+        ExprFrame* stack = (ExprFrame*)realloc(parser->exprStack, capacity * sizeof(ExprFrame));
+        if (!stack) {
+            report(parser, "Out of memory: expression nested too deeply\n");
+            return false;
+        }
+        parser->exprStack = stack;
+        parser->exprCapacity = capacity;
+    }
+    ExprFrame* frame = &parser->exprStack[parser->exprTop++];
+    frame->kind = (unsigned char)kind;
+    frame->onlyAssigns = onlyAssigns;
+    frame->castSeen = castSeen;
+    return true;
 }
 
-void restore(Parser* src, Parser* dest) {
-    dest->currentIndex = src->currentIndex;
+static bool pushStmtFrame(Parser* parser, StmtFrameKind kind) {
+    if (parser->stmtTop >= parser->stmtCapacity) {
+        int capacity = parser->stmtCapacity > 0 ? parser->stmtCapacity * 2 : 32;
+        unsigned char* stack = (unsigned char*)realloc(parser->stmtStack, capacity);
+        if (!stack) {
+            report(parser, "Out of memory: statements nested too deeply\n");
+            return false;
+        }
+        parser->stmtStack = stack;
+        parser->stmtCapacity = capacity;
+    }
+    parser->stmtStack[parser->stmtTop++] = (unsigned char)kind;
+    return true;
 }
 
 bool expect(Parser* parser, TokenType type) {
     if (match(parser, type)) {
         return true;
     }
-    printf("Syntax error: Expected token type %d, got %d ('%s')\n", 
+    report(parser, "Syntax error: Expected token type %d, got %d ('%s')\n", 
            type, getCurrentToken(parser).type, getCurrentToken(parser).value);
     return false;
 }
 
 // Forward declarations
 bool parseExpr(Parser* parser);
-bool parseExprAssign(Parser* parser);
-bool parseExprOr(Parser* parser);
-bool parseExprAnd(Parser* parser);
-bool parseExprEq(Parser* parser);
-bool parseExprRel(Parser* parser);
-bool parseExprAdd(Parser* parser);
-bool parseExprMul(Parser* parser);
-bool parseExprCast(Parser* parser);
-bool parseExprUnary(Parser* parser);
-bool parseExprPostfix(Parser* parser);
-bool parseExprPrimary(Parser* parser);
 bool parseTypeName(Parser* parser);
 bool parseStatement(Parser* parser);
 bool parseBlock(Parser* parser);
-bool parseDeclaration(Parser* parser);
+bool parseDeclaration(Parser* parser, ItemKind item);
+bool parseStructDefinition(Parser* parser);
 bool parseVarDeclaration(Parser* parser);
+bool parseVarDeclarators(Parser* parser);
+bool parseArrayDeclarator(Parser* parser);
 bool parseFunctionDeclaration(Parser* parser);
-bool parseForStatement(Parser* parser);
-bool parseIfStatement(Parser* parser);
+bool parseFunctionRest(Parser* parser);
+bool parseForHeader(Parser* parser);
+bool parseWhileHeader(Parser* parser);
+bool parseIfHeader(Parser* parser);
 bool parseReturnStatement(Parser* parser);
 bool parseExpressionStatement(Parser* parser);
 bool parseProgram(Parser* parser);
 
 
+// Add a top-level item to the outline, if one is being collected
+static bool recordOutline(Parser* parser, OutlineKind kind, int nameIndex, int bodyStart, int bodyEnd) {
+    Outline* outline = parser->outline;
+    if (!outline || parser->nesting > 0) {
+        return true;
+    }
+    if (outline->count >= outline->capacity) {
+        int capacity = outline->capacity > 0 ? outline->capacity * 2 : 64;
+        OutlineItem* items = (OutlineItem*)realloc(outline->items, capacity * sizeof(OutlineItem));
+        if (!items) {
+            report(parser, "Out of memory while building the outline\n");
+            return false;
+        }
+        outline->items = items;
+        outline->capacity = capacity;
+    }
+    OutlineItem* item = &outline->items[outline->count++];
+    item->kind = kind;
+    item->nameIndex = nameIndex;
+    item->bodyStart = bodyStart;
+    item->bodyEnd = bodyEnd;
+    return true;
+}
+
 bool isComment(Token token) {
     // Check if the token value starts with "//" or "/*"
     return (token.value[0] == '/' && 
            (token.value[1] == '/' || token.value[1] == '*'));
 }
 
-// Parse expression
-bool parseExpr(Parser* parser) {
-    return parseExprAssign(parser);
-}
-
-// Parse assignment expression
-bool parseExprAssign(Parser* parser) {
-    int startPos = parser->currentIndex;
-    
-    // Try to parse unary expression followed by assignment
-    if (parseExprUnary(parser) && match(parser, TOKEN_ASSIGN)) {
-        // Successfully parsed LHS and '=', now parse RHS
-        if (parseExprAssign(parser)) {
-            return true;
-        } else {
-            // If RHS parsing fails, backtrack
-            parser->currentIndex = startPos;
-            return false;
+// Check whether the '(' at the current token starts a cast: ( typeName ) operand.
+// A parenthesized identifier is a cast only when an operand follows it.
+static bool isCastAhead(Parser* parser) {
+    int i = parser->currentIndex + 1;
+    TokenType type = typeAt(parser, i);
+    if (type == TOKEN_KEYWORD) {
+        int keyword = parser->tokens[i].literal.keyword;
+        if (keyword == KEYWORD_STRUCT) {
+            return typeAt(parser, i + 1) == TOKEN_IDENTIFIER && typeAt(parser, i + 2) == TOKEN_RPAREN;
         }
-    } else {
-        // Backtrack and parse as logical OR expression
-        parser->currentIndex = startPos;
-        return parseExprOr(parser);
+        return isTypeKeyword(keyword) && typeAt(parser, i + 1) == TOKEN_RPAREN;
     }
-}
-
-// Parse OR expression
-bool parseExprOr(Parser* parser) {
-    if (!parseExprAnd(parser)) {
-        return false;
+    if (type == TOKEN_IDENTIFIER && typeAt(parser, i + 1) == TOKEN_RPAREN) {
+        TokenType next = typeAt(parser, i + 2);
+        return next == TOKEN_IDENTIFIER || next == TOKEN_LPAREN ||
+               next == TOKEN_NUMBER_ZEC || next == TOKEN_NUMBER_HEX ||
+               next == TOKEN_NUMBER_OCT || next == TOKEN_REAL ||
+               next == TOKEN_STRING || next == TOKEN_CHAR_LITERAL;
     }
-    
-    while (getCurrentToken(parser).type == TOKEN_OR) {
-        advance(parser);
-        if (!parseExprAnd(parser)) {
-            return false;
-        }
-    }
-    
-    return true;
+    return false;
 }
 
-// Parse AND expression
-bool parseExprAnd(Parser* parser) {
-    if (!parseExprEq(parser)) {
-        return false;
-    }
-    
-    while (getCurrentToken(parser).type == TOKEN_AND) {
-        advance(parser);
-        if (!parseExprEq(parser)) {
+static bool isBinaryOperator(TokenType type) {
+    switch (type) {
+        case TOKEN_OR: case TOKEN_AND:
+        case TOKEN_EQUAL: case TOKEN_NOTEQUAL:
+        case TOKEN_LESS: case TOKEN_LESSEQUAL: case TOKEN_GREATER: case TOKEN_GREATEREQUAL:
+        case TOKEN_PLUS: case TOKEN_MINUS:
+        case TOKEN_MULTIPLY: case TOKEN_DIVIDE:
+            return true;
+        default:
             return false;
-        }
     }
-    
-    return true;
 }
 
-// Parse equality expression
-bool parseExprEq(Parser* parser) {
-    if (!parseExprRel(parser)) {
-        return false;
-    }
+// Parse expression:
+//   expr    = operand ( binaryOp operand | ASSIGN expr )*
+//   operand = ( LPAREN typeName RPAREN )* ( SUB | NOT | INC | DEC )* primary postfix*
+//   primary = ID ( LPAREN ( expr ( COMMA expr )* )? RPAREN )? | literal | LPAREN expr RPAREN
+//   postfix = LBRACKET expr RBRACKET | DOT ID | INC | DEC
+// Only acceptance matters here, so operator precedence needs no stack; the
+// nested ( [ and argument lists are kept on parser->exprStack. An assignment
+// is accepted only where the grammar's exprUnary ASSIGN exprAssign allows it:
+// no other binary operator and no cast on its left side.
+bool parseExpr(Parser* parser) {
+    int base = parser->exprTop;
+    bool onlyAssigns = true;    // No binary operator other than '=' at this level yet
     
-    while (getCurrentToken(parser).type == TOKEN_EQUAL || 
-           getCurrentToken(parser).type == TOKEN_NOTEQUAL) {
-        advance(parser);
-        if (!parseExprRel(parser)) {
-            return false;
+    while (true) {
+        // Operand: casts and prefix operators
+        bool castSeen = false;
+        while (currentType(parser) == TOKEN_LPAREN && isCastAhead(parser)) {
+            advance(parser);            // '('
+            parseTypeName(parser);
+            advance(parser);            // ')'
+            castSeen = true;
         }
-    }
-    
-    return true;
-}
-
-// Parse relational expression
-bool parseExprRel(Parser* parser) {
-    if (!parseExprAdd(parser)) {
-        return false;
-    }
-    
-    while (getCurrentToken(parser).type == TOKEN_LESS || 
-           getCurrentToken(parser).type == TOKEN_LESSEQUAL ||
-           getCurrentToken(parser).type == TOKEN_GREATER ||
-           getCurrentToken(parser).type == TOKEN_GREATEREQUAL) {
-        advance(parser);
-        if (!parseExprAdd(parser)) {
-            return false;
+        while (currentType(parser) == TOKEN_MINUS || 
+               currentType(parser) == TOKEN_NOT ||
+               currentType(parser) == TOKEN_PLUS_1 ||
+               currentType(parser) == TOKEN_MINUS_1) {
+            advance(parser);
         }
-    }
-    
-    return true;
-}
-
-// Parse addition/subtraction expression
-bool parseExprAdd(Parser* parser) {
-    if (!parseExprMul(parser)) {
-        return false;
-    }
-    
-    while (getCurrentToken(parser).type == TOKEN_PLUS || 
-           getCurrentToken(parser).type == TOKEN_MINUS) {
-        advance(parser);
-        if (!parseExprMul(parser)) {
+        
+        // Primary
+        TokenType type = currentType(parser);
+        bool opened = false;    // A nested expression was opened
+        if (type == TOKEN_IDENTIFIER) {
+            trace(parser, "Found identifier: %s\n", parser->tokens[parser->currentIndex].value);
+            advance(parser);
+            
+            // Check for function call
+            if (currentType(parser) == TOKEN_LPAREN) {
+                trace(parser, "Found function call\n");
+                advance(parser);
+                if (currentType(parser) != TOKEN_RPAREN) {
+                    // Parse the first argument
+                    if (!pushExprFrame(parser, FRAME_CALL, onlyAssigns, castSeen)) {
+                        parser->exprTop = base;
+                        return false;
+                    }
+                    opened = true;
+                } else {
+                    advance(parser);
+                    trace(parser, "Successfully parsed function call\n");
+                }
+            }
+        } else if (type == TOKEN_NUMBER_ZEC || 
+                   type == TOKEN_NUMBER_HEX ||
+                   type == TOKEN_NUMBER_OCT ||
+                   type == TOKEN_REAL ||
+                   type == TOKEN_STRING ||
+                   type == TOKEN_CHAR_LITERAL) {
+            trace(parser, "Found string literal: %s\n", parser->tokens[parser->currentIndex].value);
+            advance(parser);
+        } else if (type == TOKEN_LPAREN) {
+            advance(parser);
+            if (!pushExprFrame(parser, FRAME_PAREN, onlyAssigns, castSeen)) {
+                parser->exprTop = base;
+                return false;
+            }
+            opened = true;
+        } else {
+            if (parser->exprTop > base && parser->exprStack[parser->exprTop - 1].kind == FRAME_CALL) {
+                report(parser, "Failed to parse function argument\n");
+            }
+            parser->exprTop = base;
             return false;
         }
-    }
-    
-    return true;
-}
-
-// Parse multiplication/division expression
-bool parseExprMul(Parser* parser) {
-    if (!parseExprCast(parser)) {
-        return false;
-    }
-    
-    while (getCurrentToken(parser).type == TOKEN_MULTIPLY || 
-           getCurrentToken(parser).type == TOKEN_DIVIDE) {
-        advance(parser);
-        if (!parseExprCast(parser)) {
-            return false;
+        if (opened) {
+            onlyAssigns = true;
+            continue;
         }
-    }
-    
-    return true;
-}
-
-// Parse type casting expression
-bool parseExprCast(Parser* parser) {
-    if (getCurrentToken(parser).type == TOKEN_LPAREN) {
-        int startPos = parser->currentIndex;
-        
-        // Try parsing '(' typeName ')' exprCast
-        Parser backupParser;
-        backup(parser, &backupParser);
         
-        advance(&backupParser);  // Consume '('
-        
-        if (parseTypeName(&backupParser) && match(&backupParser, TOKEN_RPAREN)) {
-            // If this path succeeds, continue with it
-            restore(&backupParser, parser);
-            advance(parser);  // Consume '('
-            parseTypeName(parser);
-            match(parser, TOKEN_RPAREN);
-            return parseExprCast(parser);
+        // Postfix and binary operators. Closing a nested expression resumes
+        // the postfix chain of the operand that contains it.
+        bool needOperand = false;
+        while (!needOperand) {
+            type = currentType(parser);
+            if (type == TOKEN_LBRACKET) {
+                // Handle array indexing
+                advance(parser);
+                if (!pushExprFrame(parser, FRAME_INDEX, onlyAssigns, castSeen)) {
+                    parser->exprTop = base;
+                    return false;
+                }
+                onlyAssigns = true;
+                needOperand = true;
+            } else if (type == TOKEN_DOT) {
+                // Handle structure member access
+                advance(parser);
+                if (!match(parser, TOKEN_IDENTIFIER)) {
+                    parser->exprTop = base;
+                    return false;
+                }
+            } else if (type == TOKEN_PLUS_1 || type == TOKEN_MINUS_1) {
+                // Handle postfix increment/decrement
+                advance(parser);
+            } else if (isBinaryOperator(type)) {
+                onlyAssigns = false;
+                advance(parser);
+                needOperand = true;
+            } else if (type == TOKEN_ASSIGN && onlyAssigns && !castSeen) {
+                advance(parser);
+                needOperand = true;
+            } else if (parser->exprTop == base) {
+                return true;    // End of the whole expression
+            } else {
+                // End of a nested expression: close its frame
+                ExprFrame frame = parser->exprStack[--parser->exprTop];
+                onlyAssigns = frame.onlyAssigns;
+                castSeen = frame.castSeen;
+                if (frame.kind == FRAME_CALL && type == TOKEN_COMMA) {
+                    // Next argument
+                    advance(parser);
+                    parser->exprTop++;
+                    onlyAssigns = true;
+                    needOperand = true;
+                } else if (frame.kind == FRAME_INDEX) {
+                    if (!match(parser, TOKEN_RBRACKET)) {
+                        parser->exprTop = base;
+                        return false;
+                    }
+                } else if (!match(parser, TOKEN_RPAREN)) {
+                    if (frame.kind == FRAME_CALL) {
+                        report(parser, "Expected closing parenthesis in function call\n");
+                    }
+                    parser->exprTop = base;
+                    return false;
+                } else if (frame.kind == FRAME_CALL) {
+                    trace(parser, "Successfully parsed function call\n");
+                }
+            }
         }
-        
-        // If the above fails, reset position
-        parser->currentIndex = startPos;
     }
-    
-    return parseExprUnary(parser);
 }
 
 // Parse type name
 bool parseTypeName(Parser* parser) {
     // Check for basic types: int, float, char, void
-    if (getCurrentToken(parser).type == TOKEN_KEYWORD) {
-        const char* keyword = getCurrentToken(parser).value;
-        if (strcmp(keyword, "int") == 0 || 
-            strcmp(keyword, "float") == 0 || 
-            strcmp(keyword, "char") == 0 || 
-            strcmp(keyword, "void") == 0 ||
-            strcmp(keyword, "double") == 0) {
-            advance(parser);
-            return true;
+    int keyword = keywordAt(parser, parser->currentIndex);
+    if (keyword == KEYWORD_STRUCT) {
+        // struct type: STRUCT ID
+        if (typeAt(parser, parser->currentIndex + 1) != TOKEN_IDENTIFIER) {
+            return false;
         }
-    } else if (getCurrentToken(parser).type == TOKEN_IDENTIFIER) {
+        advance(parser);
+        advance(parser);
+        return true;
+    } else if (isTypeKeyword(keyword)) {
+        advance(parser);
+        return true;
+    } else if (currentType(parser) == TOKEN_IDENTIFIER) {
         // Allow custom type names (structs, etc.)
         advance(parser);
         return true;
@@ -276,294 +494,347 @@ bool parseTypeName(Parser* parser) {
     return false;
 }
 
-// Parse unary expression
-bool parseExprUnary(Parser* parser) {
-    if (getCurrentToken(parser).type == TOKEN_MINUS || 
-        getCurrentToken(parser).type == TOKEN_NOT ||
-        getCurrentToken(parser).type == TOKEN_PLUS_1 ||
-        getCurrentToken(parser).type == TOKEN_MINUS_1) {
-        advance(parser);
-        return parseExprUnary(parser);
+// Token classes seen by the item decision table
+typedef enum {
+    CLASS_END,          // End of a rule
+    CLASS_TYPE,         // int float char void double
+    CLASS_STRUCT,
+    CLASS_ID,
+    CLASS_LPAREN,
+    CLASS_LBRACE,
+    CLASS_OTHER
+} TokenClass;
+
+#define ITEM_LOOKAHEAD 4
+
+// LL(4) decision table for items, derived by hand from the grammar
+//   item       = structDef | funcDef | varDef | stmt
+//   structDef  = STRUCT ID LACC ...
+//   funcDef    = typeName ID LPAREN ...
+//   varDef     = typeName ID ...
+//   typeName   = TYPE | STRUCT ID | ID
+// Rules are tried in order and the first whose tokens all match wins;
+// anything else is a statement. A type keyword always starts a variable,
+// so a malformed declaration is reported by the declaration parser.
+static const struct {
+    ItemKind item;
+    unsigned char classes[ITEM_LOOKAHEAD];
+} itemRules[] = {
+    {ITEM_STRUCT,   {CLASS_STRUCT, CLASS_ID, CLASS_LBRACE}},
+    {ITEM_FUNCTION, {CLASS_STRUCT, CLASS_ID, CLASS_ID, CLASS_LPAREN}},
+    {ITEM_VARIABLE, {CLASS_STRUCT, CLASS_ID}},
+    {ITEM_FUNCTION, {CLASS_TYPE, CLASS_ID, CLASS_LPAREN}},
+    {ITEM_VARIABLE, {CLASS_TYPE}},
+    {ITEM_FUNCTION, {CLASS_ID, CLASS_ID, CLASS_LPAREN}},
+    {ITEM_VARIABLE, {CLASS_ID, CLASS_ID}},
+};
+
+static TokenClass classAt(Parser* parser, int index) {
+    switch (typeAt(parser, index)) {
+        case TOKEN_IDENTIFIER: return CLASS_ID;
+        case TOKEN_LPAREN: return CLASS_LPAREN;
+        case TOKEN_LBRACE: return CLASS_LBRACE;
+        case TOKEN_KEYWORD: {
+            int keyword = parser->tokens[index].literal.keyword;
+            if (keyword == KEYWORD_STRUCT) {
+                return CLASS_STRUCT;
+            }
+            return isTypeKeyword(keyword) ? CLASS_TYPE : CLASS_OTHER;
+        }
+        default: return CLASS_OTHER;
     }
-    
-    return parseExprPostfix(parser);
 }
 
-// Parse postfix expression (including array access and function calls)
-bool parseExprPostfix(Parser* parser) {
-    if (!parseExprPrimary(parser)) {
-        return false;
+// Classify the item at the current token with bounded lookahead
+static ItemKind classifyItem(Parser* parser) {
+    TokenClass seen[ITEM_LOOKAHEAD];
+    int known = 0;      // Classes computed so far
+    for (size_t r = 0; r < sizeof(itemRules) / sizeof(itemRules[0]); r++) {
+        int k = 0;
+        for (; k < ITEM_LOOKAHEAD && itemRules[r].classes[k] != CLASS_END; k++) {
+            if (k == known) {
+                seen[known++] = classAt(parser, parser->currentIndex + k);
+            }
+            if (seen[k] != itemRules[r].classes[k]) {
+                break;
+            }
+        }
+        if (k == ITEM_LOOKAHEAD || itemRules[r].classes[k] == CLASS_END) {
+            return itemRules[r].item;
+        }
     }
+    return ITEM_STATEMENT;
+}
+
+// Parse statement. Statements that contain statements (blocks, if, else,
+// for, while) push a frame on parser->stmtStack and continue with their
+// body in the same loop, so nesting depth never grows the C stack.
+bool parseStatement(Parser* parser) {
+    int base = parser->stmtTop;
     
     while (true) {
-        if (getCurrentToken(parser).type == TOKEN_LBRACKET) {
-            // Handle array indexing
+        TokenType type = currentType(parser);
+        trace(parser, "DEBUG: Parsing statement at token %d: %s (type %d)\n", 
+               parser->currentIndex, getCurrentToken(parser).value, type);
+        
+        bool ok = true;
+        bool opened = false;    // A frame was pushed; its body comes next
+        ItemKind item = classifyItem(parser);
+        // AtomC has no nested functions; rejecting them here also keeps
+        // parseFunctionRest from recursing into parseBlock on the C stack
+        if (item == ITEM_FUNCTION && parser->nesting > 0) {
+            char position[64];
+            report(parser, "Function definition inside a block at %s\n",
+                   positionOf(parser, parser->currentIndex, position, sizeof(position)));
+            ok = false;
+        }
+        // Declaration
+        else if (item != ITEM_STATEMENT) {
+            ok = parseDeclaration(parser, item);
+        }
+        // Block statement
+        else if (type == TOKEN_LBRACE) {
             advance(parser);
-            if (!parseExpr(parser)) {
-                return false;
-            }
-            if (!match(parser, TOKEN_RBRACKET)) {
-                return false;
+            trace(parser, "Starting block at token %d\n", parser->currentIndex);
+            parser->nesting++;
+            ok = pushStmtFrame(parser, STMT_BLOCK);
+        }
+        else if (type == TOKEN_KEYWORD) {
+            switch (parser->tokens[parser->currentIndex].literal.keyword) {
+                case KEYWORD_FOR:
+                    ok = parseForHeader(parser) && pushStmtFrame(parser, STMT_LOOP);
+                    opened = true;
+                    break;
+                case KEYWORD_WHILE:
+                    ok = parseWhileHeader(parser) && pushStmtFrame(parser, STMT_LOOP);
+                    opened = true;
+                    break;
+                case KEYWORD_IF:
+                    ok = parseIfHeader(parser) && pushStmtFrame(parser, STMT_IF);
+                    opened = true;
+                    break;
+                case KEYWORD_RETURN:
+                    ok = parseReturnStatement(parser);
+                    break;
+                default:
+                    ok = parseExpressionStatement(parser);
+                    break;
             }
-        } else if (getCurrentToken(parser).type == TOKEN_DOT) {
-            // Handle structure member access
+        }
+        // Skip comments
+        else if (type == TOKEN_LINECOMMENT || type == TOKEN_MULTILINECOMMENT || 
+                 isComment(parser->tokens[parser->currentIndex])) {
             advance(parser);
-            if (!match(parser, TOKEN_IDENTIFIER)) {
-                return false;
+        }
+        // Expression statement
+        else {
+            ok = parseExpressionStatement(parser);
+        }
+        
+        if (!ok) {
+            if (parser->stmtTop > base && parser->stmtStack[parser->stmtTop - 1] == STMT_BLOCK) {
+                char position[64];
+                report(parser, "Failed to parse statement in block at %s: %s\n", 
+                       positionOf(parser, parser->currentIndex, position, sizeof(position)),
+                       getCurrentToken(parser).value);
             }
-        } else if (getCurrentToken(parser).type == TOKEN_PLUS_1 || 
-                   getCurrentToken(parser).type == TOKEN_MINUS_1) {
-            // Handle postfix increment/decrement
-            advance(parser);
-        } else {
-            break;
+            parser->stmtTop = base;
+            return false;
+        }
+        if (opened) {
+            continue;
         }
-    }
-    
-    return true;
-}
-
-// Parse primary expression
-bool parseExprPrimary(Parser* parser) {
-    if (getCurrentToken(parser).type == TOKEN_IDENTIFIER) {
-        printf("Found identifier: %s\n", getCurrentToken(parser).value);
-        advance(parser);
         
-        // Check for function call
-        if (getCurrentToken(parser).type == TOKEN_LPAREN) {
-            printf("Found function call\n");
-            advance(parser);
-            
-            // Parse arguments if any
-            if (getCurrentToken(parser).type != TOKEN_RPAREN) {
-                if (!parseExpr(parser)) {
-                    printf("Failed to parse function argument\n");
+        // A statement is complete: close every frame it completes
+        bool needStatement = false;
+        while (!needStatement) {
+            if (parser->stmtTop == base) {
+                return true;
+            }
+            StmtFrameKind kind = (StmtFrameKind)parser->stmtStack[parser->stmtTop - 1];
+            if (kind == STMT_BLOCK) {
+                type = currentType(parser);
+                if (type == TOKEN_RBRACE) {
+                    advance(parser);
+                    parser->nesting--;
+                    parser->stmtTop--;
+                    trace(parser, "Completed block at token %d\n", parser->currentIndex);
+                } else if (type == TOKEN_EOF) {
+                    report(parser, "Unexpected end of file in block\n");
+                    parser->stmtTop = base;
                     return false;
+                } else {
+                    needStatement = true;   // Next statement of the block
                 }
-                
-                while (getCurrentToken(parser).type == TOKEN_COMMA) {
+            } else if (kind == STMT_IF) {
+                // Skip any comments that might appear between if body and else
+                while (currentType(parser) == TOKEN_LINECOMMENT || 
+                       currentType(parser) == TOKEN_MULTILINECOMMENT ||
+                       (currentType(parser) != TOKEN_EOF && isComment(parser->tokens[parser->currentIndex]))) {
                     advance(parser);
-                    if (!parseExpr(parser)) {
-                        printf("Failed to parse function argument after comma\n");
-                        return false;
-                    }
                 }
+                // Parse optional else
+                if (keywordAt(parser, parser->currentIndex) == KEYWORD_ELSE) {
+                    trace(parser, "Found else clause\n");
+                    advance(parser);
+                    parser->stmtStack[parser->stmtTop - 1] = STMT_ELSE;
+                    needStatement = true;
+                } else {
+                    parser->stmtTop--;
+                }
+            } else {
+                parser->stmtTop--;      // else or loop body done
             }
-            
-            if (!match(parser, TOKEN_RPAREN)) {
-                printf("Expected closing parenthesis in function call\n");
-                return false;
-            }
-            printf("Successfully parsed function call\n");
-        }
-        
-        return true;
-    } else if (getCurrentToken(parser).type == TOKEN_NUMBER_ZEC || 
-               getCurrentToken(parser).type == TOKEN_NUMBER_HEX ||
-               getCurrentToken(parser).type == TOKEN_NUMBER_OCT ||
-               getCurrentToken(parser).type == TOKEN_REAL ||
-               getCurrentToken(parser).type == TOKEN_STRING ||
-               getCurrentToken(parser).type == TOKEN_CHAR_LITERAL) {
-        printf("Found string literal: %s\n", getCurrentToken(parser).value);
-        advance(parser);
-        return true;
-    } else if (getCurrentToken(parser).type == TOKEN_LPAREN) {
-        advance(parser);
-        if (!parseExpr(parser)) {
-            return false;
         }
-        return match(parser, TOKEN_RPAREN);
-    }
-    
-    return false;
-}
-
-// Parse statement
-bool parseStatement(Parser* parser) {
-    Token current = getCurrentToken(parser);
-    printf("DEBUG: Parsing statement at token %d: %s (type %d)\n", 
-           parser->currentIndex, current.value, current.type);
-    
-    // Block statement
-    if (current.type == TOKEN_LBRACE) {
-        return parseBlock(parser);
-    }
-    // For statement
-    else if (current.type == TOKEN_KEYWORD && strcmp(current.value, "for") == 0) {
-        return parseForStatement(parser);
-    }
-    // If statement
-    else if (current.type == TOKEN_KEYWORD && strcmp(current.value, "if") == 0) {
-        return parseIfStatement(parser);
-    }
-    // Return statement
-    else if (current.type == TOKEN_KEYWORD && strcmp(current.value, "return") == 0) {
-        return parseReturnStatement(parser);
-    }
-    // Declaration statement
-    else if (current.type == TOKEN_KEYWORD && 
-            (strcmp(current.value, "int") == 0 || 
-             strcmp(current.value, "float") == 0 || 
-             strcmp(current.value, "char") == 0 || 
-             strcmp(current.value, "void") == 0 ||
-             strcmp(current.value, "double") == 0)) {
-        return parseDeclaration(parser);
-    }
-    // Skip comments
-    else if (current.type == TOKEN_LINECOMMENT || current.type == TOKEN_MULTILINECOMMENT || 
-             (current.value[0] == '/' && 
-              (current.value[1] == '/' || current.value[1] == '*'))) {
-        advance(parser);
-        return true;
-    }
-    // Expression statement
-    else {
-        return parseExpressionStatement(parser);
     }
 }
 
 
 // Parse block of statements
 bool parseBlock(Parser* parser) {
-    if (!match(parser, TOKEN_LBRACE)) {
-        printf("Expected opening brace for block, got token type %d: %s\n", 
+    if (currentType(parser) != TOKEN_LBRACE) {
+        report(parser, "Expected opening brace for block, got token type %d: %s\n", 
                getCurrentToken(parser).type, getCurrentToken(parser).value);
         return false;
     }
-    
-    printf("Starting block at token %d\n", parser->currentIndex);
-    
-    // Parse statements until we hit the closing brace
-    while (getCurrentToken(parser).type != TOKEN_RBRACE && 
-           getCurrentToken(parser).type != TOKEN_EOF) {
-        if (!parseStatement(parser)) {
-            printf("Failed to parse statement in block at token %d: %s\n", 
-                   parser->currentIndex, getCurrentToken(parser).value);
-            return false;
-        }
-    }
-    
-    if (getCurrentToken(parser).type == TOKEN_EOF) {
-        printf("Unexpected end of file in block\n");
-        return false;
-    }
-    
-    if (!match(parser, TOKEN_RBRACE)) {
-        printf("Expected closing brace for block, got token type %d: %s\n", 
-               getCurrentToken(parser).type, getCurrentToken(parser).value);
-        return false;
-    }
-    
-    printf("Completed block at token %d\n", parser->currentIndex);
-    return true;
+    return parseStatement(parser);
 }
 
-// Parse declaration
-bool parseDeclaration(Parser* parser) {
-    // Look ahead to see if this is a function declaration or a variable declaration
-    int startPos = parser->currentIndex;
-    printf("DEBUG: Trying to parse declaration at token %d: %s\n", 
+// Parse declaration of the kind chosen by classifyItem. The type and name
+// are shared by functions and variables, so nothing is parsed twice.
+bool parseDeclaration(Parser* parser, ItemKind item) {
+    trace(parser, "DEBUG: Parsing declaration at token %d: %s\n", 
         parser->currentIndex, getCurrentToken(parser).value);
     
+    if (item == ITEM_STRUCT) {
+        return parseStructDefinition(parser);
+    }
+    
     // Parse type name
     if (!parseTypeName(parser)) {
-        printf("DEBUG: Failed to parse type name in declaration\n");
+        trace(parser, "DEBUG: Failed to parse type name in declaration\n");
         return false;
     }
     
-    // Check for special case of 'void main()'
-    if (startPos < parser->tokenCount && 
-        parser->tokens[startPos].type == TOKEN_KEYWORD && 
-        strcmp(parser->tokens[startPos].value, "void") == 0) {
-        
-        if (parser->currentIndex < parser->tokenCount && 
-            getCurrentToken(parser).type == TOKEN_IDENTIFIER && 
-            strcmp(getCurrentToken(parser).value, "main") == 0) {
-            
-            // This is likely a main function declaration
-            // Reset and parse as function
-            parser->currentIndex = startPos;
-            return parseFunctionDeclaration(parser);
-        }
-    }
-    
     // Parse identifier
     if (!match(parser, TOKEN_IDENTIFIER)) {
-        parser->currentIndex = startPos;
+        report(parser, "Expected identifier in declaration, got '%s'\n", getCurrentToken(parser).value);
         return false;
     }
     
-    // If next token is '(', this is a function declaration
-    if (getCurrentToken(parser).type == TOKEN_LPAREN) {
-        parser->currentIndex = startPos;
-        return parseFunctionDeclaration(parser);
-    }
-    // Otherwise, it's a variable declaration
-    else {
-        parser->currentIndex = startPos;
-        return parseVarDeclaration(parser);
+    if (item == ITEM_FUNCTION) {
+        return parseFunctionRest(parser);
     }
+    return parseVarDeclarators(parser);
 }
 
-// Parse variable declaration
-bool parseVarDeclaration(Parser* parser) {
-    printf("DEBUG: Parsing variable declaration at token %d: %s\n", 
-        parser->currentIndex, getCurrentToken(parser).value);
-    // Parse type name
-    if (!parseTypeName(parser)) {
-        printf("DEBUG: Failed to parse type name\n");
+// Parse struct definition: STRUCT ID LACC varDef* RACC SEMICOLON
+bool parseStructDefinition(Parser* parser) {
+    advance(parser);    // Consume 'struct'
+    trace(parser, "DEBUG: Parsing struct %s\n", getCurrentToken(parser).value);
+    if (!recordOutline(parser, OUTLINE_STRUCT, parser->currentIndex, -1, -1)) {
         return false;
     }
+    advance(parser);    // Consume the struct name
     
-    printf("DEBUG: After type name, at token %d: %s\n", 
-        parser->currentIndex, getCurrentToken(parser).value);
-
-    // Parse first variable
-    if (!match(parser, TOKEN_IDENTIFIER)) {
+    if (!match(parser, TOKEN_LBRACE)) {
         return false;
     }
+    parser->nesting++;
     
-    // Check for array declaration
-    if (getCurrentToken(parser).type == TOKEN_LBRACKET) {
-        advance(parser);
-        // Optional array size
-        if (getCurrentToken(parser).type == TOKEN_NUMBER_ZEC ||
-            getCurrentToken(parser).type == TOKEN_NUMBER_HEX ||
-            getCurrentToken(parser).type == TOKEN_NUMBER_OCT) {
+    while (getCurrentToken(parser).type != TOKEN_RBRACE) {
+        if (isComment(getCurrentToken(parser))) {
             advance(parser);
+            continue;
         }
-        if (!match(parser, TOKEN_RBRACKET)) {
+        if (!parseVarDeclaration(parser)) {
+            report(parser, "Invalid field declaration in struct\n");
             return false;
         }
     }
+    advance(parser);    // Consume '}'
+    parser->nesting--;
     
-    // Parse additional variables
-    while (getCurrentToken(parser).type == TOKEN_COMMA) {
-        advance(parser);
-        
-        if (!match(parser, TOKEN_IDENTIFIER)) {
+    if (!match(parser, TOKEN_SEMICOLON)) {
+        report(parser, "Expected semicolon after struct definition\n");
+        return false;
+    }
+    return true;
+}
+
+// Parse array declarator: LBRACKET expr? RBRACKET
+bool parseArrayDeclarator(Parser* parser) {
+    advance(parser);    // Consume '['
+    // Optional array size, any constant expression such as 20/4+5
+    if (getCurrentToken(parser).type != TOKEN_RBRACKET) {
+        if (!parseExpr(parser)) {
+            report(parser, "Invalid array size\n");
+            return false;
+        }
+    }
+    return match(parser, TOKEN_RBRACKET);
+}
+
+// Parse the rest of a variable declaration once the type and first name
+// are consumed: arrayDecl? (ASSIGN expr)? (COMMA ID arrayDecl? (ASSIGN expr)?)* SEMICOLON
+bool parseVarDeclarators(Parser* parser) {
+    while (true) {
+        if (!recordOutline(parser, OUTLINE_VARIABLE, parser->currentIndex - 1, -1, -1)) {
             return false;
         }
         
         // Check for array declaration
         if (getCurrentToken(parser).type == TOKEN_LBRACKET) {
-            advance(parser);
-            // Optional array size
-            if (getCurrentToken(parser).type == TOKEN_NUMBER_ZEC ||
-                getCurrentToken(parser).type == TOKEN_NUMBER_HEX ||
-                getCurrentToken(parser).type == TOKEN_NUMBER_OCT) {
-                advance(parser);
+            if (!parseArrayDeclarator(parser)) {
+                return false;
             }
-            if (!match(parser, TOKEN_RBRACKET)) {
+        }
+        
+        // Optional initializer
+        if (getCurrentToken(parser).type == TOKEN_ASSIGN) {
+            advance(parser);
+            if (!parseExpr(parser)) {
+                report(parser, "Invalid initializer\n");
                 return false;
             }
         }
+        
+        // Parse additional variables
+        if (getCurrentToken(parser).type != TOKEN_COMMA) {
+            break;
+        }
+        advance(parser);
+        
+        if (!match(parser, TOKEN_IDENTIFIER)) {
+            return false;
+        }
     }
     
     // Expect semicolon
     return match(parser, TOKEN_SEMICOLON);
 }
 
+// Parse variable declaration
+bool parseVarDeclaration(Parser* parser) {
+    trace(parser, "DEBUG: Parsing variable declaration at token %d: %s\n", 
+        parser->currentIndex, getCurrentToken(parser).value);
+    // Parse type name
+    if (!parseTypeName(parser)) {
+        trace(parser, "DEBUG: Failed to parse type name\n");
+        return false;
+    }
+    
+    trace(parser, "DEBUG: After type name, at token %d: %s\n", 
+        parser->currentIndex, getCurrentToken(parser).value);
+
+    // Parse first variable
+    if (!match(parser, TOKEN_IDENTIFIER)) {
+        return false;
+    }
+    
+    return parseVarDeclarators(parser);
+}
+
 // Parse function declaration
 bool parseFunctionDeclaration(Parser* parser) {
     // Parse return type
@@ -576,6 +847,13 @@ bool parseFunctionDeclaration(Parser* parser) {
         return false;
     }
     
+    return parseFunctionRest(parser);
+}
+
+// Parse the parameter list and body of a function whose type and name are consumed
+bool parseFunctionRest(Parser* parser) {
+    int nameIndex = parser->currentIndex - 1;
+    
     // Parse parameter list
     if (!match(parser, TOKEN_LPAREN)) {
         return false;
@@ -583,19 +861,7 @@ bool parseFunctionDeclaration(Parser* parser) {
     
     // Parse parameters if any
     if (getCurrentToken(parser).type != TOKEN_RPAREN) {
-        // Parse first parameter
-        if (!parseTypeName(parser)) {
-            return false;
-        }
-        
-        if (!match(parser, TOKEN_IDENTIFIER)) {
-            return false;
-        }
-        
-        // Parse additional parameters
-        while (getCurrentToken(parser).type == TOKEN_COMMA) {
-            advance(parser);
-            
+        while (true) {
             if (!parseTypeName(parser)) {
                 return false;
             }
@@ -603,6 +869,18 @@ bool parseFunctionDeclaration(Parser* parser) {
             if (!match(parser, TOKEN_IDENTIFIER)) {
                 return false;
             }
+            
+            // Array parameter, e.g. int v[]
+            if (getCurrentToken(parser).type == TOKEN_LBRACKET &&
+                !parseArrayDeclarator(parser)) {
+                return false;
+            }
+            
+            // Parse additional parameters
+            if (getCurrentToken(parser).type != TOKEN_COMMA) {
+                break;
+            }
+            advance(parser);
         }
     }
     
@@ -610,59 +888,55 @@ bool parseFunctionDeclaration(Parser* parser) {
         return false;
     }
     
+    // The body is recorded so it can be parsed later, on its own
+    int bodyStart = parser->currentIndex;
+    int bodyEnd = -1;
+    if (parser->brackets && getCurrentToken(parser).type == TOKEN_LBRACE) {
+        bodyEnd = parser->brackets[bodyStart];
+    }
+    if (!recordOutline(parser, OUTLINE_FUNCTION, nameIndex, bodyStart, bodyEnd)) {
+        return false;
+    }
+    
+    // Skimming: jump over the body in O(1)
+    if (parser->skimBodies && bodyEnd >= 0) {
+        parser->currentIndex = bodyEnd + 1;
+        return true;
+    }
+    
     // Parse function body
     return parseBlock(parser);
 }
 
-// Parse for statement
-bool parseForStatement(Parser* parser) {
-    if (!match(parser, TOKEN_KEYWORD) || strcmp(parser->tokens[parser->currentIndex-1].value, "for") != 0) {
-        return false;
-    }
+// Parse for statement header: FOR LPAREN expr? SEMICOLON expr? SEMICOLON expr? RPAREN
+bool parseForHeader(Parser* parser) {
+    advance(parser); // Consume 'for'
     
     if (!match(parser, TOKEN_LPAREN)) {
+        report(parser, "Expected '(' after 'for'\n");
         return false;
     }
     
     // Parse initialization
-    if (getCurrentToken(parser).type == TOKEN_KEYWORD) {
+    if (currentType(parser) == TOKEN_KEYWORD) {
         // Declaration as initialization
         if (!parseVarDeclaration(parser)) {
             return false;
         }
-    } else if (getCurrentToken(parser).type != TOKEN_SEMICOLON) {
+    } else if (currentType(parser) != TOKEN_SEMICOLON) {
         // Expression as initialization
-        printf("Parsing initialization expression at token %d: %s\n", 
+        trace(parser, "Parsing initialization expression at token %d: %s\n", 
                parser->currentIndex, getCurrentToken(parser).value);
-               
-        // Try to parse an identifier first
-        if (getCurrentToken(parser).type == TOKEN_IDENTIFIER) {
-            advance(parser); // Consume identifier
-            
-            // Check for assignment operator
-            if (getCurrentToken(parser).type == TOKEN_ASSIGN) {
-                advance(parser); // Consume '='
-                
-                // Parse right-hand side of assignment
-                if (!parseExpr(parser)) {
-                    printf("Failed to parse RHS of assignment in for loop init\n");
-                    return false;
-                }
-            } else {
-                printf("Expected '=' after identifier in for loop init\n");
-                return false;
-            }
-        } else {
-            // Not an identifier, try regular expression parsing
-            if (!parseExpr(parser)) {
-                printf("Failed to parse expression in for loop init\n");
-                return false;
-            }
+        if (!parseExpr(parser)) {
+            report(parser, "Failed to parse expression in for loop init\n");
+            return false;
         }
         
         if (!match(parser, TOKEN_SEMICOLON)) {
-            printf("Expected semicolon after initialization, got token %d: %s\n", 
-                   parser->currentIndex, getCurrentToken(parser).value);
+            char position[64];
+            report(parser, "Expected semicolon after initialization at %s: %s\n", 
+                   positionOf(parser, parser->currentIndex, position, sizeof(position)),
+                   getCurrentToken(parser).value);
             return false;
         }
     } else {
@@ -671,137 +945,97 @@ bool parseForStatement(Parser* parser) {
     }
     
     // Parse condition (can be empty)
-    printf("Parsing for loop condition at token %d: %s\n", 
+    trace(parser, "Parsing for loop condition at token %d: %s\n", 
            parser->currentIndex, getCurrentToken(parser).value);
-    if (getCurrentToken(parser).type != TOKEN_SEMICOLON) {
+    if (currentType(parser) != TOKEN_SEMICOLON) {
         if (!parseExpr(parser)) {
-            printf("Failed to parse condition in for loop\n");
+            report(parser, "Failed to parse condition in for loop\n");
             return false;
         }
     }
     
     if (!match(parser, TOKEN_SEMICOLON)) {
-        printf("Expected semicolon after condition in for loop\n");
+        report(parser, "Expected semicolon after condition in for loop\n");
         return false;
     }
     
     // Parse increment (can be empty)
-    printf("Parsing for loop increment at token %d: %s\n", 
+    trace(parser, "Parsing for loop increment at token %d: %s\n", 
            parser->currentIndex, getCurrentToken(parser).value);
-    if (getCurrentToken(parser).type != TOKEN_RPAREN) {
+    if (currentType(parser) != TOKEN_RPAREN) {
         if (!parseExpr(parser)) {
-            printf("Failed to parse increment in for loop. Current token: %s\n", 
+            report(parser, "Failed to parse increment in for loop. Current token: %s\n", 
                    getCurrentToken(parser).value);
             return false;
         }
     }
     
     if (!match(parser, TOKEN_RPAREN)) {
-        printf("Expected closing parenthesis after for loop components\n");
+        report(parser, "Expected closing parenthesis after for loop components\n");
         return false;
     }
     
-    // Parse body
-    printf("Parsing for loop body at token %d: %s\n", 
+    trace(parser, "Parsing for loop body at token %d: %s\n", 
            parser->currentIndex, getCurrentToken(parser).value);
-    bool result = parseStatement(parser);
-    if (!result) {
-        printf("Failed to parse for loop body\n");
-    } else {
-        printf("Successfully parsed for loop body, now at token %d: %s\n", 
-               parser->currentIndex, getCurrentToken(parser).value);
-    }
-    return result;
+    return true;
 }
 
-// Parse if statement
-// Parse if statement
-bool parseIfStatement(Parser* parser) {
-    printf("Starting if statement parsing\n");
-    if (getCurrentToken(parser).type != TOKEN_KEYWORD || 
-        strcmp(getCurrentToken(parser).value, "if") != 0) {
-        return false;
-    }
-    
-    advance(parser); // Now advance past the 'if' token
+// Parse while statement header: WHILE LPAREN expr RPAREN
+bool parseWhileHeader(Parser* parser) {
+    advance(parser); // Consume 'while'
     
     if (!match(parser, TOKEN_LPAREN)) {
-        printf("Expected '(' after 'if'\n");
+        report(parser, "Expected '(' after 'while'\n");
         return false;
     }
     
-    printf("Parsing if condition\n");
-    
-    // Parse the condition expression with special handling for complex conditions
-    //int conditionStart = parser->currentIndex;
-    int parenCount = 1; // We already consumed one opening parenthesis
-    
-    // Find the matching closing parenthesis by counting parens
-    while (parser->currentIndex < parser->tokenCount && parenCount > 0) {
-        if (getCurrentToken(parser).type == TOKEN_LPAREN) {
-            parenCount++;
-        } else if (getCurrentToken(parser).type == TOKEN_RPAREN) {
-            parenCount--;
-        }
-        
-        if (parenCount > 0) {
-            advance(parser);
-        }
+    if (!parseExpr(parser)) {
+        report(parser, "Failed to parse condition in while loop\n");
+        return false;
     }
     
-    if (parenCount > 0) {
-        printf("Unmatched parentheses in if condition\n");
+    if (!match(parser, TOKEN_RPAREN)) {
+        report(parser, "Expected ')' after while condition\n");
         return false;
     }
     
-    // Now consume the closing parenthesis
-    advance(parser);
-    
-    printf("Parsing if body at token %d: %s (type %d)\n", 
-           parser->currentIndex, getCurrentToken(parser).value, getCurrentToken(parser).type);
+    trace(parser, "Parsing while loop body at token %d: %s\n", 
+           parser->currentIndex, getCurrentToken(parser).value);
+    return true;
+}
+
+// Parse if statement header: IF LPAREN expr RPAREN
+bool parseIfHeader(Parser* parser) {
+    trace(parser, "Starting if statement parsing\n");
+    advance(parser); // Now advance past the 'if' token
     
-    // Parse if body
-    if (!parseStatement(parser)) {
-        printf("Failed to parse if body\n");
-        // Try to recover - skip to "else" or next statement
-        while (parser->currentIndex < parser->tokenCount && 
-               (getCurrentToken(parser).type != TOKEN_KEYWORD || 
-                strcmp(getCurrentToken(parser).value, "else") != 0) &&
-               getCurrentToken(parser).type != TOKEN_SEMICOLON &&
-               getCurrentToken(parser).type != TOKEN_RBRACE) {
-            advance(parser);
-        }
+    if (!match(parser, TOKEN_LPAREN)) {
+        report(parser, "Expected '(' after 'if'\n");
+        return false;
     }
     
-    // Skip any comments that might appear between if body and else
-    while (parser->currentIndex < parser->tokenCount &&
-           (getCurrentToken(parser).type == TOKEN_LINECOMMENT || 
-            getCurrentToken(parser).type == TOKEN_MULTILINECOMMENT ||
-            isComment(getCurrentToken(parser)))) {
-        advance(parser);
+    trace(parser, "Parsing if condition\n");
+    
+    // Parse the condition expression
+    if (!parseExpr(parser)) {
+        report(parser, "Failed to parse condition in if statement\n");
+        return false;
     }
     
-    // Parse optional else
-    if (parser->currentIndex < parser->tokenCount &&
-        getCurrentToken(parser).type == TOKEN_KEYWORD && 
-        strcmp(getCurrentToken(parser).value, "else") == 0) {
-        printf("Found else clause\n");
-        advance(parser);
-        
-        printf("Parsing else body at token %d: %s\n", 
-               parser->currentIndex, getCurrentToken(parser).value);
-        
-        return parseStatement(parser);
+    if (!match(parser, TOKEN_RPAREN)) {
+        report(parser, "Unmatched parentheses in if condition\n");
+        return false;
     }
     
+    trace(parser, "Parsing if body at token %d: %s (type %d)\n", 
+           parser->currentIndex, getCurrentToken(parser).value, getCurrentToken(parser).type);
     return true;
 }
 
 // Parse return statement
 bool parseReturnStatement(Parser* parser) {
     // First check if the current token is 'return' before advancing
-    if (getCurrentToken(parser).type != TOKEN_KEYWORD || 
-        strcmp(getCurrentToken(parser).value, "return") != 0) {
+    if (keywordAt(parser, parser->currentIndex) != KEYWORD_RETURN) {
         return false;
     }
     
@@ -811,13 +1045,13 @@ bool parseReturnStatement(Parser* parser) {
     // Parse optional return value
     if (getCurrentToken(parser).type != TOKEN_SEMICOLON) {
         if (!parseExpr(parser)) {
-            printf("Failed to parse return value expression\n");
+            report(parser, "Failed to parse return value expression\n");
             return false;
         }
     }
     
     if (!match(parser, TOKEN_SEMICOLON)) {
-        printf("Expected semicolon after return statement\n");
+        report(parser, "Expected semicolon after return statement\n");
         return false;
     }
     
@@ -832,99 +1066,76 @@ bool parseExpressionStatement(Parser* parser) {
         return true;
     }
     
-    printf("Trying to parse expression statement at token %d: %s (type %d)\n", 
+    trace(parser, "Trying to parse expression statement at token %d: %s (type %d)\n", 
            parser->currentIndex, getCurrentToken(parser).value, getCurrentToken(parser).type);
     
     // Special case for function calls which are common in expression statements
-    if (getCurrentToken(parser).type == TOKEN_IDENTIFIER) {
-        int startPos = parser->currentIndex;
-        
-        // Save function name for debugging
-        char functionName[256];
-        strcpy(functionName, getCurrentToken(parser).value);
+    if (currentType(parser) == TOKEN_IDENTIFIER && typeAt(parser, parser->currentIndex + 1) == TOKEN_LPAREN) {
+        // Remember the function name for debugging (the token array may move
+        // while a stream is being parsed, so keep its index)
+        int nameIndex = parser->currentIndex;
         advance(parser); // Consume function name
         
-        if (getCurrentToken(parser).type == TOKEN_LPAREN) {
-            printf("Parsing function call to %s\n", functionName);
-            advance(parser); // Consume '('
-            
-            // Parse arguments if any
-            if (getCurrentToken(parser).type != TOKEN_RPAREN) {
-                // Handle special case of string literals that may be split across tokens
-                if (getCurrentToken(parser).type == TOKEN_STRING || 
-                    getCurrentToken(parser).type == TOKEN_CHAR_LITERAL) {
-                    // Skip the string/char literal token
-                    printf("Processing string/char literal argument\n");
-                    advance(parser);
-                    
-                    // Skip any additional tokens that might be part of the string
-                    // until we find the closing parenthesis
-                    while (parser->currentIndex < parser->tokenCount && 
-                           getCurrentToken(parser).type != TOKEN_RPAREN) {
-                        printf("Skipping additional string token: %s\n", getCurrentToken(parser).value);
-                        advance(parser);
-                    }
-                } else {
-                    // Parse regular expression argument
-                    if (!parseExpr(parser)) {
-                        printf("Failed to parse function argument\n");
-                        parser->currentIndex = startPos;
-                        return false;
-                    }
-                }
-            }
-            
-            if (!match(parser, TOKEN_RPAREN)) {
-                printf("Expected closing parenthesis in function call\n");
-                // Try to recover - find the next closing parenthesis
-                while (parser->currentIndex < parser->tokenCount && 
-                       getCurrentToken(parser).type != TOKEN_RPAREN) {
-                    advance(parser);
-                }
-                if (getCurrentToken(parser).type == TOKEN_RPAREN) {
-                    advance(parser); // Consume the closing parenthesis
-                } else {
+        trace(parser, "Parsing function call to %s\n", parser->tokens[nameIndex].value);
+        advance(parser); // Consume '('
+        
+        // Parse arguments if any
+        if (getCurrentToken(parser).type != TOKEN_RPAREN) {
+            do {
+                if (!parseExpr(parser)) {
+                    report(parser, "Failed to parse function argument\n");
                     return false;
                 }
+            } while (match(parser, TOKEN_COMMA));
+        }
+        
+        if (!match(parser, TOKEN_RPAREN)) {
+            report(parser, "Expected closing parenthesis in function call\n");
+            // Try to recover - find the next closing parenthesis
+            while (getCurrentToken(parser).type != TOKEN_EOF && 
+                   getCurrentToken(parser).type != TOKEN_RPAREN) {
+                advance(parser);
             }
-            
-            // Expect semicolon after function call
-            if (!match(parser, TOKEN_SEMICOLON)) {
-                printf("Expected semicolon after function call\n");
-                // Try to recover - find the next semicolon
-                while (parser->currentIndex < parser->tokenCount && 
-                       getCurrentToken(parser).type != TOKEN_SEMICOLON) {
-                    advance(parser);
-                }
-                if (getCurrentToken(parser).type == TOKEN_SEMICOLON) {
-                    advance(parser); // Consume the semicolon
-                } else {
-                    return false;
-                }
+            if (getCurrentToken(parser).type == TOKEN_RPAREN) {
+                advance(parser); // Consume the closing parenthesis
+            } else {
+                return false;
             }
-            
-            printf("Successfully parsed function call to %s\n", functionName);
-            return true;
         }
         
-        // If not a function call, reset and try normal expression parsing
-        parser->currentIndex = startPos;
+        // Expect semicolon after function call
+        if (!match(parser, TOKEN_SEMICOLON)) {
+            report(parser, "Expected semicolon after function call\n");
+            // Try to recover - find the next semicolon
+            while (getCurrentToken(parser).type != TOKEN_EOF && 
+                   getCurrentToken(parser).type != TOKEN_SEMICOLON) {
+                advance(parser);
+            }
+            if (getCurrentToken(parser).type == TOKEN_SEMICOLON) {
+                advance(parser); // Consume the semicolon
+            } else {
+                return false;
+            }
+        }
+        
+        trace(parser, "Successfully parsed function call to %s\n", parser->tokens[nameIndex].value);
+        return true;
     }
     
     // Try to parse a normal expression
     if (!parseExpr(parser)) {
-        printf("Failed to parse expression in statement\n");
+        report(parser, "Failed to parse expression in statement\n");
         return false;
     }
     
-    printf("Expression parsed, expecting semicolon at token %d: %s\n", 
+    trace(parser, "Expression parsed, expecting semicolon at token %d: %s\n", 
            parser->currentIndex, getCurrentToken(parser).value);
     
     // Expect semicolon at the end
     if (!match(parser, TOKEN_SEMICOLON)) {
-        printf("Expected semicolon after expression statement\n");
+        report(parser, "Expected semicolon after expression statement\n");
         // Try to recover - skip to next semicolon
-        while (parser->currentIndex < parser->tokenCount && 
+        while (getCurrentToken(parser).type != TOKEN_EOF && 
                getCurrentToken(parser).type != TOKEN_SEMICOLON) {
             advance(parser);
         }
@@ -954,7 +1165,8 @@ bool parseProgram(Parser* parser) {
             continue;
         }
         
-        if (!parseDeclaration(parser) && !parseStatement(parser)) {
+        parser->nesting = 0;
+        if (!parseStatement(parser)) {
             return false;
         }
     }
@@ -963,18 +1175,93 @@ bool parseProgram(Parser* parser) {
 
 // Main parse function that interfaces with the main.c file
 int parse(Token* tokens, int token_count) {
+    return parseWithDiagnostics(tokens, token_count, NULL);
+}
+
+// Parse with messages routed through diag (see parser.h)
+int parseWithDiagnostics(Token* tokens, int token_count, ParseDiagnostics* diag) {
     Parser parser;
     initParser(&parser, tokens, token_count);
+    parser.diag = diag;
     
     // Parse the entire program
     bool result = parseProgram(&parser);
     
     if (!result) {
         int errorPosition = parser.currentIndex;
-        printf("Syntax error at token %d: %s\n", 
-               errorPosition, 
+        char position[64];
+        report(&parser, "Syntax error at %s: %s\n", 
+               positionOf(&parser, errorPosition, position, sizeof(position)), 
                errorPosition < token_count ? tokens[errorPosition].value : "EOF");
     }
     
+    finishParser(&parser);
     return result ? 1 : 0;  // Return 1 for success, 0 for failure
+}
+
+// Parse a program whose tokens are still being produced
+int parseStream(TokenStream* stream, ParseDiagnostics* diag) {
+    Parser parser;
+    initParser(&parser, stream->tokens, stream->tokenCount);
+    parser.stream = stream;
+    parser.diag = diag;
+    
+    bool result = parseProgram(&parser);
+    
+    if (!result) {
+        Token errorToken = getCurrentToken(&parser);
+        char position[64];
+        report(&parser, "Syntax error at %s: %s\n", 
+               positionOf(&parser, parser.currentIndex, position, sizeof(position)), errorToken.value);
+    }
+    
+    finishParser(&parser);
+    return result ? 1 : 0;
+}
+
+// Parse only the top-level declarations, skipping function bodies
+int parseOutline(Token* tokens, int token_count, const int* brackets,
+                 Outline* outline, ParseDiagnostics* diag) {
+    Parser parser;
+    initParser(&parser, tokens, token_count);
+    parser.diag = diag;
+    parser.brackets = brackets;
+    parser.outline = outline;
+    parser.skimBodies = true;
+    outline->count = 0;
+    
+    bool result = parseProgram(&parser);
+    
+    if (!result) {
+        int errorPosition = parser.currentIndex;
+        char position[64];
+        report(&parser, "Syntax error at %s: %s\n", 
+               positionOf(&parser, errorPosition, position, sizeof(position)), 
+               errorPosition < token_count ? tokens[errorPosition].value : "EOF");
+    }
+    
+    finishParser(&parser);
+    return result ? 1 : 0;
+}
+
+// Parse the body of one function found by parseOutline
+int parseFunctionBody(Token* tokens, int token_count, const OutlineItem* item,
+                      ParseDiagnostics* diag) {
+    Parser parser;
+    initParser(&parser, tokens, token_count);
+    parser.diag = diag;
+    parser.currentIndex = item->bodyStart;
+    
+    bool result = parseBlock(&parser);
+    
+    if (!result) {
+        int errorPosition = parser.currentIndex;
+        char position[64];
+        report(&parser, "Syntax error at %s: %s\n", 
+               positionOf(&parser, errorPosition, position, sizeof(position)), 
+               errorPosition < token_count ? tokens[errorPosition].value : "EOF");
+    }
+    
+    finishParser(&parser);
+    return result ? 1 : 0;
 }
\ No newline at end of file
@@ -1,9 +1,69 @@
 #ifndef PARSER_H
 #define PARSER_H
 
+#include <stddef.h>
+
 #include "lexer.h"
+#include "lineindex.h"
+
+// Where the parser sends its messages. With buffer == NULL they are
+// printed to stdout; otherwise they are appended to buffer (truncated at
+// capacity, always NUL-terminated) so library callers can return them.
+typedef struct {
+    char* buffer;
+    size_t capacity;
+    size_t length;
+    int trace;      // Also emit the step-by-step debug trace
+    LineIndex* lines;   // Source of the tokens: errors give line and column instead of token index
+    int errors;         // Out: messages that point at a token (added to)
+    int errorOffset;    // Out: source offset of the first of them, -1 for the end of input
+} ParseDiagnostics;
+
+// Source of tokens that arrive while parsing is under way. fill appends
+// at least one more token to tokens/tokenCount (it may move the array) and
+// returns 0 once the input is exhausted.
+typedef struct TokenStream TokenStream;
+struct TokenStream {
+    int (*fill)(TokenStream* stream);
+    Token* tokens;
+    int tokenCount;
+};
+
+// A top-level item found by parseOutline. nameIndex is the token index
+// of its name; functions also record the token range of their body block.
+typedef enum {
+    OUTLINE_FUNCTION, OUTLINE_VARIABLE, OUTLINE_STRUCT
+} OutlineKind;
+
+typedef struct {
+    OutlineKind kind;
+    int nameIndex;
+    int bodyStart;      // Index of '{', or -1
+    int bodyEnd;        // Index of the matching '}', or -1
+} OutlineItem;
+
+typedef struct {
+    OutlineItem* items;
+    int count;
+    int capacity;
+} Outline;
 
 // Parse function that returns 1 if successful, 0 otherwise
 int parse(Token* tokens, int token_count);
 
-#endif // PARSER_H
\ No newline at end of file
+// Same as parse, with messages routed through diag (NULL behaves like parse)
+int parseWithDiagnostics(Token* tokens, int token_count, ParseDiagnostics* diag);
+
+// Parse tokens as the stream produces them, pulling more on demand
+int parseStream(TokenStream* stream, ParseDiagnostics* diag);
+
+// Parse only the top-level declarations into outline. Function bodies are
+// skipped in O(1) through brackets (see build_bracket_index) instead of parsed.
+int parseOutline(Token* tokens, int token_count, const int* brackets,
+                 Outline* outline, ParseDiagnostics* diag);
+
+// Parse the body of one function from the outline
+int parseFunctionBody(Token* tokens, int token_count, const OutlineItem* item,
+                      ParseDiagnostics* diag);
+
+#endif // PARSER_H
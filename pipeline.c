@@ -0,0 +1,192 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include "pipeline.h"
+#include "hugemem.h"
+
+#define PIPE_BATCH 512      // Tokens per batch
+#define PIPE_SLOTS 8        // Batches in flight
+#define PIPE_SPINS 256      // Polls before yielding the CPU
+
+typedef struct {
+    int count;
+    int last;               // Final batch of the input
+    Token tokens[PIPE_BATCH];
+} TokenBatch;
+
+// Single-producer/single-consumer ring. head is only written by the lexer,
+// tail only by the parser; each sits on its own cache line.
+typedef struct {
+    _Alignas(64) atomic_size_t head;
+    _Alignas(64) atomic_size_t tail;
+    _Alignas(64) atomic_int abort;
+    const char *source;
+    struct timespec start;
+    PipelineStats *stats;
+    TokenBatch slots[PIPE_SLOTS];
+} TokenRing;
+
+typedef struct {
+    TokenStream stream;     // Must be first: the parser only sees this part
+    TokenRing *ring;
+    int capacity;
+    int finished;
+    int failed;
+} PipeConsumer;
+
+static double elapsed_ms(const struct timespec *start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1e3 + (now.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static void *lexer_main(void *arg) {
+    TokenRing *ring = (TokenRing *)arg;
+    const char *input = ring->source;
+    int done = 0;
+
+    ring->stats->lexStart = elapsed_ms(&ring->start);
+    while (!done) {
+        size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+        // Wait for a free slot
+        if (head - atomic_load_explicit(&ring->tail, memory_order_acquire) >= PIPE_SLOTS) {
+            double waitStart = elapsed_ms(&ring->start);
+            for (int spins = 0;
+                 head - atomic_load_explicit(&ring->tail, memory_order_acquire) >= PIPE_SLOTS;
+                 spins++) {
+                if (atomic_load_explicit(&ring->abort, memory_order_relaxed)) {
+                    return NULL;
+                }
+                if (spins >= PIPE_SPINS) {
+                    sched_yield();
+                }
+            }
+            ring->stats->lexerWait += elapsed_ms(&ring->start) - waitStart;
+        }
+
+        TokenBatch *batch = &ring->slots[head % PIPE_SLOTS];
+        int count = 0;
+        while (count < PIPE_BATCH) {
+            Token token = next_token(ring->source, &input);
+            if (token.type == TOKEN_EOF) {
+                done = 1;
+                break;
+            }
+            batch->tokens[count++] = token;
+        }
+        batch->count = count;
+        batch->last = done;
+
+        // Publish the batch
+        atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    }
+    ring->stats->lexEnd = elapsed_ms(&ring->start);
+    return NULL;
+}
+
+// TokenStream callback: move the next batch from the ring into the token array
+static int pipe_fill(TokenStream *stream) {
+    PipeConsumer *consumer = (PipeConsumer *)stream;
+    TokenRing *ring = consumer->ring;
+    if (consumer->finished) {
+        return 0;
+    }
+
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    if (atomic_load_explicit(&ring->head, memory_order_acquire) == tail) {
+        double waitStart = elapsed_ms(&ring->start);
+        for (int spins = 0; atomic_load_explicit(&ring->head, memory_order_acquire) == tail; spins++) {
+            if (spins >= PIPE_SPINS) {
+                sched_yield();
+            }
+        }
+        ring->stats->parserWait += elapsed_ms(&ring->start) - waitStart;
+    }
+
+    TokenBatch *batch = &ring->slots[tail % PIPE_SLOTS];
+    if (stream->tokenCount + batch->count > consumer->capacity) {
+        int capacity = consumer->capacity > 0 ? consumer->capacity : 4 * PIPE_BATCH;
+        while (capacity < stream->tokenCount + batch->count) {
+            capacity *= 2;
+        }
+        Token *tokens = (Token *)huge_realloc(stream->tokens, capacity * sizeof(Token));
+        if (!tokens) {
+            // Stop the lexer; the parser sees the end of input
+            atomic_store(&ring->abort, 1);
+            consumer->failed = 1;
+            consumer->finished = 1;
+            return 0;
+        }
+        stream->tokens = tokens;
+        consumer->capacity = capacity;
+    }
+    memcpy(stream->tokens + stream->tokenCount, batch->tokens, batch->count * sizeof(Token));
+    stream->tokenCount += batch->count;
+    consumer->finished = batch->last;
+
+    // Hand the slot back to the lexer
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return batch->count > 0 || !consumer->finished;
+}
+
+Token *parse_pipelined(const char *source, int *token_count, int *ok,
+                       ParseDiagnostics *diag, PipelineStats *stats) {
+    PipelineStats local_stats;
+    if (!stats) {
+        stats = &local_stats;
+    }
+    memset(stats, 0, sizeof(*stats));
+    *ok = 0;
+    *token_count = 0;
+
+    TokenRing *ring = (TokenRing *)aligned_alloc(64, sizeof(TokenRing));
+    if (!ring) {
+        return NULL;
+    }
+    memset(ring, 0, sizeof(TokenRing));
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->abort, 0);
+    ring->source = source;
+    ring->stats = stats;
+    clock_gettime(CLOCK_MONOTONIC, &ring->start);
+
+    pthread_t lexer;
+    if (pthread_create(&lexer, NULL, lexer_main, ring) != 0) {
+        free(ring);
+        return NULL;
+    }
+
+    PipeConsumer consumer;
+    memset(&consumer, 0, sizeof(consumer));
+    consumer.stream.fill = pipe_fill;
+    consumer.ring = ring;
+
+    stats->parseStart = elapsed_ms(&ring->start);
+    *ok = parseStream(&consumer.stream, diag);
+    stats->parseEnd = elapsed_ms(&ring->start);
+
+    // A syntax error can stop the parser early; drain the rest so the lexer
+    // finishes and the caller still gets every token
+    while (pipe_fill(&consumer.stream)) {
+    }
+    pthread_join(lexer, NULL);
+    free(ring);
+
+    if (consumer.failed) {
+        huge_free(consumer.stream.tokens);
+        *ok = 0;
+        return NULL;
+    }
+    if (!consumer.stream.tokens) {
+        consumer.stream.tokens = (Token *)huge_alloc(sizeof(Token));
+    }
+    *token_count = consumer.stream.tokenCount;
+    return consumer.stream.tokens;
+}
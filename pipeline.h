@@ -0,0 +1,22 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include "lexer.h"
+#include "parser.h"
+
+// Timings of a pipelined run, in milliseconds from the start of the call
+typedef struct {
+    double lexStart, lexEnd;
+    double parseStart, parseEnd;
+    double parserWait;      // Time the parser spent waiting on an empty ring
+    double lexerWait;       // Time the lexer spent waiting on a full ring
+} PipelineStats;
+
+// Lex source on a separate thread while parsing it on the calling thread.
+// Tokens travel in batches through a bounded single-producer/single-consumer
+// ring. Returns the complete token array (caller frees with huge_free), or NULL if out of
+// memory; *ok receives the parse result.
+Token *parse_pipelined(const char *source, int *token_count, int *ok,
+                       ParseDiagnostics *diag, PipelineStats *stats);
+
+#endif
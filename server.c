@@ -0,0 +1,539 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#include "server.h"
+#include "atomc.h"
+#include "cache.h"
+#include "tokfile.h"
+#include "hugemem.h"
+#include "util.h"
+
+#define WARM_BUCKETS 4096
+#define WARM_MAX_ENTRIES 65536
+#define WARM_MAX_BYTES (64 * 1024 * 1024)   // Paths and diagnostics held by the warm cache
+#define QUEUE_CAPACITY 256
+#define SOURCE_MAX_BYTES (256 * 1024 * 1024) // Largest SOURCE request accepted
+
+// Result of the last compilation of a file, reused while the file is unchanged
+typedef struct WarmEntry {
+    char *path;
+    struct timespec mtime;
+    off_t size;
+    uint64_t contentHash;
+    int ok;
+    char *diagnostics;
+    size_t bytes;               // Of path and diagnostics
+    struct WarmEntry *next;     // In the bucket
+    struct WarmEntry *newer;    // In the recency list
+    struct WarmEntry *older;
+} WarmEntry;
+
+// Entries are evicted least recently used first once either limit is passed
+static WarmEntry *warm_cache[WARM_BUCKETS];
+static WarmEntry *warm_newest, *warm_oldest;
+static size_t warm_entries, warm_bytes;
+static pthread_mutex_t warm_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Accepted connections waiting for a worker
+static int queue_fds[QUEUE_CAPACITY];
+static int queue_head, queue_count;
+static pthread_mutex_t queue_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t queue_not_empty = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t queue_not_full = PTHREAD_COND_INITIALIZER;
+
+static void queue_push(int fd) {
+    pthread_mutex_lock(&queue_lock);
+    while (queue_count == QUEUE_CAPACITY) {
+        pthread_cond_wait(&queue_not_full, &queue_lock);
+    }
+    queue_fds[(queue_head + queue_count++) % QUEUE_CAPACITY] = fd;
+    pthread_cond_signal(&queue_not_empty);
+    pthread_mutex_unlock(&queue_lock);
+}
+
+static int queue_pop(void) {
+    pthread_mutex_lock(&queue_lock);
+    while (queue_count == 0) {
+        pthread_cond_wait(&queue_not_empty, &queue_lock);
+    }
+    int fd = queue_fds[queue_head];
+    queue_head = (queue_head + 1) % QUEUE_CAPACITY;
+    queue_count--;
+    pthread_cond_signal(&queue_not_full);
+    pthread_mutex_unlock(&queue_lock);
+    return fd;
+}
+
+// Must be called with warm_lock held
+static WarmEntry *warm_find(const char *path) {
+    uint64_t h = hash_bytes(path, strlen(path), 0);
+    for (WarmEntry *e = warm_cache[h % WARM_BUCKETS]; e; e = e->next) {
+        if (strcmp(e->path, path) == 0) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+// The recency list helpers must be called with warm_lock held
+static void warm_unlink(WarmEntry *e) {
+    if (e->newer) e->newer->older = e->older; else warm_newest = e->older;
+    if (e->older) e->older->newer = e->newer; else warm_oldest = e->newer;
+    e->newer = e->older = NULL;
+}
+
+static void warm_make_newest(WarmEntry *e) {
+    e->older = warm_newest;
+    e->newer = NULL;
+    if (warm_newest) warm_newest->newer = e; else warm_oldest = e;
+    warm_newest = e;
+}
+
+static void warm_evict(WarmEntry *e) {
+    WarmEntry **link = &warm_cache[hash_bytes(e->path, strlen(e->path), 0) % WARM_BUCKETS];
+    while (*link != e) {
+        link = &(*link)->next;
+    }
+    *link = e->next;
+    warm_unlink(e);
+    warm_entries--;
+    warm_bytes -= e->bytes;
+    free(e->path);
+    free(e->diagnostics);
+    free(e);
+}
+
+static void warm_store(const char *path, const struct stat *st, uint64_t content_hash,
+                       int ok, const char *diagnostics) {
+    pthread_mutex_lock(&warm_lock);
+    WarmEntry *e = warm_find(path);
+    if (!e) {
+        e = (WarmEntry *)calloc(1, sizeof(WarmEntry));
+        if (!e || !(e->path = strdup(path))) {
+            free(e);
+            pthread_mutex_unlock(&warm_lock);
+            return;
+        }
+        uint64_t h = hash_bytes(path, strlen(path), 0);
+        e->next = warm_cache[h % WARM_BUCKETS];
+        warm_cache[h % WARM_BUCKETS] = e;
+        warm_make_newest(e);
+        warm_entries++;
+    } else {
+        warm_unlink(e);
+        warm_make_newest(e);
+    }
+    free(e->diagnostics);
+    e->diagnostics = strdup(diagnostics);
+    warm_bytes -= e->bytes;
+    e->bytes = strlen(path) + (e->diagnostics ? strlen(e->diagnostics) : 0);
+    warm_bytes += e->bytes;
+    e->mtime = st->st_mtim;
+    e->size = st->st_size;
+    e->contentHash = content_hash;
+    e->ok = ok;
+    while (warm_oldest && warm_oldest != e && (warm_entries > WARM_MAX_ENTRIES || warm_bytes > WARM_MAX_BYTES)) {
+        warm_evict(warm_oldest);
+    }
+    pthread_mutex_unlock(&warm_lock);
+}
+
+// Look up a file by mtime+size (have_hash == 0) or by content hash.
+// On a hit, returns 1 with a copy of the diagnostics in *diagnostics.
+static int warm_lookup(const char *path, const struct stat *st, int have_hash,
+                       uint64_t content_hash, int *ok, char **diagnostics) {
+    int hit = 0;
+    pthread_mutex_lock(&warm_lock);
+    WarmEntry *e = warm_find(path);
+    if (e && e->diagnostics) {
+        if (!have_hash) {
+            hit = e->size == st->st_size &&
+                  e->mtime.tv_sec == st->st_mtim.tv_sec &&
+                  e->mtime.tv_nsec == st->st_mtim.tv_nsec;
+        } else if (e->contentHash == content_hash) {
+            // Touched but not modified: remember the new mtime
+            e->mtime = st->st_mtim;
+            e->size = st->st_size;
+            hit = 1;
+        }
+        if (hit) {
+            warm_unlink(e);
+            warm_make_newest(e);
+            *ok = e->ok;
+            *diagnostics = strdup(e->diagnostics);
+            hit = *diagnostics != NULL;
+        }
+    }
+    pthread_mutex_unlock(&warm_lock);
+    return hit;
+}
+
+static void send_reply(FILE *out, int ok, const char *artifact, const char *name, const char *diagnostics) {
+    size_t length = strlen(diagnostics);
+    fprintf(out, "%s\t%zu\t%s\t%s\n", ok ? "OK" : "ERROR", length, artifact ? artifact : "-", name);
+    fwrite(diagnostics, 1, length, out);
+}
+
+static void compile_file_request(AtomcContext *ctx, FILE *out, const char *path, const char *artifact) {
+    struct stat st;
+    char message[1200];
+    int ok;
+    char *cached = NULL;
+
+    if (stat(path, &st) != 0) {
+        snprintf(message, sizeof(message), "Error opening file: %s\n", path);
+        send_reply(out, 0, NULL, path, message);
+        return;
+    }
+
+    // Unchanged mtime: answer without reading the file. Artifacts need the
+    // tokens, so those requests always compile.
+    if (!artifact && warm_lookup(path, &st, 0, 0, &ok, &cached)) {
+        send_reply(out, ok, NULL, path, cached);
+        free(cached);
+        return;
+    }
+
+    size_t length = 0;
+    char *source = load_file(path, &length);
+    if (!source) {
+        snprintf(message, sizeof(message), "Error opening file: %s\n", path);
+        send_reply(out, 0, NULL, path, message);
+        return;
+    }
+
+    uint64_t content_hash = cache_key(source, length);
+    if (!artifact && warm_lookup(path, &st, 1, content_hash, &ok, &cached)) {
+        send_reply(out, ok, NULL, path, cached);
+        free(cached);
+        free(source);
+        return;
+    }
+
+    AtomcStatus status = atomc_set_name(ctx, path);
+    if (status == ATOMC_OK) {
+        status = atomc_compile_buffer(ctx, source, length);
+    }
+    free(source);
+    ok = status == ATOMC_OK;
+
+    if (artifact && status != ATOMC_ERROR_MEMORY) {
+        int token_count;
+        const Token *tokens = atomc_tokens(ctx, &token_count);
+        if (!write_token_file(artifact, tokens, token_count)) {
+            snprintf(message, sizeof(message), "Failed to write token file %s\n", artifact);
+            send_reply(out, 0, NULL, path, message);
+            return;
+        }
+    }
+
+    if (status != ATOMC_ERROR_MEMORY) {
+        warm_store(path, &st, content_hash, ok, atomc_diagnostics(ctx));
+    }
+    send_reply(out, ok, artifact, path, status == ATOMC_ERROR_MEMORY ? "Out of memory\n" : atomc_diagnostics(ctx));
+}
+
+static void serve_connection(AtomcContext *ctx, int fd) {
+    FILE *in = fdopen(fd, "r");
+    int out_fd = dup(fd);
+    FILE *out = out_fd >= 0 ? fdopen(out_fd, "w") : NULL;
+    if (!in || !out) {
+        if (in) fclose(in); else close(fd);
+        if (out) fclose(out); else if (out_fd >= 0) close(out_fd);
+        return;
+    }
+
+    char *line = NULL, *source = NULL;
+    size_t line_capacity = 0, source_capacity = 0;
+    ssize_t n;
+    while ((n = getline(&line, &line_capacity, in)) > 0) {
+        if (line[n - 1] == '\n') {
+            line[--n] = '\0';
+        }
+
+        // Split the request into at most three tab-separated fields
+        char *fields[3] = {line, NULL, NULL};
+        for (int i = 1; i < 3; i++) {
+            char *tab = fields[i - 1] ? strchr(fields[i - 1], '\t') : NULL;
+            if (tab) {
+                *tab = '\0';
+                fields[i] = tab + 1;
+            }
+        }
+
+        if (strcmp(fields[0], "FILE") == 0 && fields[1]) {
+            compile_file_request(ctx, out, fields[1], fields[2]);
+        } else if (strcmp(fields[0], "SOURCE") == 0 && fields[1]) {
+            char *end;
+            errno = 0;
+            unsigned long long requested = strtoull(fields[1], &end, 10);
+            const char *name = fields[2] ? fields[2] : "<source>";
+            // The body cannot be skipped reliably, so an oversized request ends the connection
+            if (errno != 0 || end == fields[1] || *end != '\0' || requested > SOURCE_MAX_BYTES) {
+                send_reply(out, 0, NULL, name, "Source too large or invalid length\n");
+                break;
+            }
+            size_t length = (size_t)requested;
+            if (length + 1 > source_capacity) {
+                char *buffer = (char *)realloc(source, length + 1);
+                if (!buffer) {
+                    send_reply(out, 0, NULL, name, "Out of memory\n");
+                    break;
+                }
+                source = buffer;
+                source_capacity = length + 1;
+            }
+            if (fread(source, 1, length, in) != length) {
+                send_reply(out, 0, NULL, name, "Truncated source\n");
+                break;
+            }
+            AtomcStatus status = atomc_set_name(ctx, name);
+            if (status == ATOMC_OK) {
+                status = atomc_compile_buffer(ctx, source, length);
+            }
+            send_reply(out, status == ATOMC_OK, NULL, name,
+                       status == ATOMC_ERROR_MEMORY ? "Out of memory\n" : atomc_diagnostics(ctx));
+        } else {
+            send_reply(out, 0, NULL, fields[0], "Unknown request\n");
+        }
+        fflush(out);
+    }
+
+    free(line);
+    free(source);
+    fclose(out);
+    fclose(in);
+}
+
+static void *worker_main(void *arg) {
+    // The context's buffers are reused for every request; with huge pages,
+    // keep them and the thread on one NUMA node
+    numa_place_worker((int)(intptr_t)arg);
+    AtomcContext *ctx = atomc_context_new();
+    if (!ctx) {
+        fprintf(stderr, "Failed to create compiler context\n");
+        return NULL;
+    }
+    for (;;) {
+        serve_connection(ctx, queue_pop());
+        atomc_context_reset(ctx);
+    }
+    return NULL;
+}
+
+static int make_address(const char *socket_path, struct sockaddr_un *addr) {
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(addr->sun_path)) {
+        fprintf(stderr, "Socket path too long: %s\n", socket_path);
+        return 0;
+    }
+    strcpy(addr->sun_path, socket_path);
+    return 1;
+}
+
+int run_server(const char *socket_path, int jobs) {
+    struct sockaddr_un addr;
+    if (!make_address(socket_path, &addr)) {
+        return -1;
+    }
+    signal(SIGPIPE, SIG_IGN);   // A client going away must not kill the server
+
+    // Replace the socket of an earlier server, but never another kind of file
+    struct stat st;
+    if (lstat(socket_path, &st) == 0) {
+        if (!S_ISSOCK(st.st_mode)) {
+            fprintf(stderr, "Cannot listen on %s: file exists and is not a socket\n", socket_path);
+            return -1;
+        }
+        unlink(socket_path);
+    }
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0 || bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+        listen(listen_fd, 128) != 0) {
+        fprintf(stderr, "Cannot listen on %s: %s\n", socket_path, strerror(errno));
+        return -1;
+    }
+
+    if (jobs < 1) {
+        jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        if (jobs < 1) {
+            jobs = 1;
+        }
+    }
+    for (int i = 0; i < jobs; i++) {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, worker_main, (void *)(intptr_t)i) != 0) {
+            fprintf(stderr, "Failed to start worker thread\n");
+            return -1;
+        }
+        pthread_detach(thread);
+    }
+    fprintf(stderr, "Compile server listening on %s with %d workers\n", socket_path, jobs);
+
+    for (;;) {
+        int fd = accept(listen_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            fprintf(stderr, "accept failed: %s\n", strerror(errno));
+            return -1;
+        }
+        queue_push(fd);
+    }
+}
+
+static int connect_server(const char *socket_path) {
+    struct sockaddr_un addr;
+    if (!make_address(socket_path, &addr)) {
+        return -1;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        fprintf(stderr, "Cannot connect to %s: %s\n", socket_path, strerror(errno));
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Send FILE requests for files[0..file_count) on one connection and read the
+// replies, or with sources SOURCE requests with their contents, which the
+// server compiles without consulting its warm cache. Prints the replies when
+// verbose. Returns the number of failed files, or -1.
+static int send_batch(const char *socket_path, int file_count, char **files, int verbose, int sources) {
+    int fd = connect_server(socket_path);
+    if (fd < 0) {
+        return -1;
+    }
+
+    int out_fd = dup(fd);
+    FILE *out = out_fd >= 0 ? fdopen(out_fd, "w") : NULL;
+    if (!out) {
+        close(fd);
+        return -1;
+    }
+    for (int i = 0; i < file_count; i++) {
+        if (sources) {
+            size_t length = 0;
+            char *source = load_file(files[i], &length);
+            if (source) {
+                fprintf(out, "SOURCE\t%zu\t%s\n", length, files[i]);
+                fwrite(source, 1, length, out);
+                free(source);
+            }
+            continue;   // An unreadable file gets no reply, so it counts as failed
+        }
+        // The server may run in another directory, so send absolute paths
+        char *path = realpath(files[i], NULL);
+        fprintf(out, "FILE\t%s\n", path ? path : files[i]);
+        free(path);
+    }
+    fclose(out);
+    shutdown(fd, SHUT_WR);
+
+    FILE *in = fdopen(fd, "r");
+    if (!in) {
+        close(fd);
+        return -1;
+    }
+    int failed = 0, replies = 0;
+    char *line = NULL;
+    size_t line_capacity = 0;
+    ssize_t n;
+    while ((n = getline(&line, &line_capacity, in)) > 0) {
+        char status[16], artifact[1024];
+        size_t length;
+        int name_start = 0;
+        if (sscanf(line, "%15[^\t]\t%zu\t%1023[^\t]\t%n", status, &length, artifact, &name_start) < 3 ||
+            name_start == 0) {
+            failed++;
+            break;
+        }
+        int ok = strcmp(status, "OK") == 0;
+        failed += !ok;
+        replies++;
+        if (verbose) {
+            printf("%s: %s", status, line + name_start);
+        }
+        for (size_t i = 0; i < length; i++) {
+            int c = fgetc(in);
+            if (c == EOF) {
+                break;
+            }
+            if (verbose) {
+                putchar(c);
+            }
+        }
+    }
+    free(line);
+    fclose(in);
+    return failed + (file_count - replies);
+}
+
+int run_client(const char *socket_path, int file_count, char **files) {
+    signal(SIGPIPE, SIG_IGN);
+    int failed = send_batch(socket_path, file_count, files, 1, 0);
+    return failed == 0 ? 0 : -1;
+}
+
+int run_server_benchmark(const char *socket_path, const char *compiler, int file_count, char **files) {
+    signal(SIGPIPE, SIG_IGN);
+    if (file_count == 0) {
+        return -1;
+    }
+
+    // One connection per file, as a build system would issue them. The
+    // first round sends the sources, so every file is compiled; the second
+    // one populates the server's warm cache and the third one only hits it.
+    double server_us[3];
+    for (int round = 0; round < 3; round++) {
+        double start = now_ms();
+        for (int i = 0; i < file_count; i++) {
+            if (send_batch(socket_path, 1, &files[i], 0, round == 0) < 0) {
+                return -1;
+            }
+        }
+        server_us[round] = (now_ms() - start) * 1e3 / file_count;
+    }
+
+    // One compiler process per file
+    double start = now_ms();
+    for (int i = 0; i < file_count; i++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            int null_fd = open("/dev/null", O_WRONLY);
+            dup2(null_fd, 1);
+            dup2(null_fd, 2);
+            execl(compiler, compiler, files[i], (char *)NULL);
+            _exit(127);
+        }
+        if (pid < 0) {
+            fprintf(stderr, "fork failed: %s\n", strerror(errno));
+            return -1;
+        }
+        waitpid(pid, NULL, 0);
+    }
+    double process_us = (now_ms() - start) * 1e3 / file_count;
+
+    printf("Files:                    %d\n", file_count);
+    printf("Server, compiling:        %.1f us/file\n", server_us[0]);
+    printf("Server, cache hits:       %.1f us/file\n", server_us[2]);
+    printf("One process per file:     %.1f us/file\n", process_us);
+    printf("Speedup (compiling vs process):  %.1fx\n", process_us / server_us[0]);
+    printf("Speedup (cache hits vs process): %.1fx\n", process_us / server_us[2]);
+    return 0;
+}
@@ -0,0 +1,24 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+// Compile server over a Unix domain socket.
+//
+// A connection carries a batch of requests, one per line, fields separated
+// by a tab:
+//   FILE\t<path>[\t<out.tok>]     compile a file, optionally writing its tokens
+//   SOURCE\t<length>\t<name>      compile the <length> bytes that follow the line
+//                                (at most 256 MB; a larger length ends the connection)
+// The server answers each request in order with
+//   <OK|ERROR>\t<diagnostics length>\t<artifact path or ->\t<name>\n<diagnostics>
+// and closes the connection once the client has shut down its write side.
+
+// Serve until killed, handling connections on `jobs` worker threads
+int run_server(const char *socket_path, int jobs);
+
+// Send every file as one batch and print the replies. Returns 0 if all compiled.
+int run_client(const char *socket_path, int file_count, char **files);
+
+// Compare per-file latency of the server with one compiler process per file
+int run_server_benchmark(const char *socket_path, const char *compiler, int file_count, char **files);
+
+#endif
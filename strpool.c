@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "strpool.h"
+#include "cache.h"
+
+void string_pool_init(StringPool *pool) {
+    memset(pool, 0, sizeof(*pool));
+}
+
+void string_pool_clear(StringPool *pool) {
+    pool->length = 0;
+    pool->count = 0;
+    if (pool->table) {
+        memset(pool->table, -1, pool->tableSize * sizeof(int));
+    }
+}
+
+void string_pool_free(StringPool *pool) {
+    free(pool->data);
+    free(pool->offsets);
+    free(pool->lengths);
+    free(pool->table);
+    string_pool_init(pool);
+}
+
+static int reserve_bytes(StringPool *pool, size_t extra) {
+    if (pool->length + extra <= pool->capacity) {
+        return 1;
+    }
+    size_t capacity = pool->capacity ? pool->capacity : 4096;
+    while (capacity < pool->length + extra) {
+        capacity *= 2;
+    }
+    char *data = (char *)realloc(pool->data, capacity);
+    if (!data) {
+        return 0;
+    }
+    pool->data = data;
+    pool->capacity = capacity;
+    return 1;
+}
+
+// Keep the table at most half full
+static int grow_table(StringPool *pool) {
+    if ((size_t)(pool->count + 1) * 2 <= pool->tableSize) {
+        return 1;
+    }
+    size_t size = pool->tableSize ? pool->tableSize * 2 : 256;
+    int *table = (int *)malloc(size * sizeof(int));
+    if (!table) {
+        return 0;
+    }
+    memset(table, -1, size * sizeof(int));
+    for (int i = 0; i < pool->count; i++) {
+        size_t slot = hash_bytes(pool->data + pool->offsets[i], pool->lengths[i], 0) & (size - 1);
+        while (table[slot] >= 0) {
+            slot = (slot + 1) & (size - 1);
+        }
+        table[slot] = i;
+    }
+    free(pool->table);
+    pool->table = table;
+    pool->tableSize = size;
+    return 1;
+}
+
+// Look up the string at the end of data (not yet part of the pool) and
+// either keep it as a new entry or drop it in favour of the existing copy
+static int commit_string(StringPool *pool, size_t start, size_t length) {
+    if (!grow_table(pool)) {
+        return -1;
+    }
+    const char *bytes = pool->data + start;
+    size_t slot = hash_bytes(bytes, length, 0) & (pool->tableSize - 1);
+    while (pool->table[slot] >= 0) {
+        int index = pool->table[slot];
+        if (pool->lengths[index] == length &&
+            memcmp(pool->data + pool->offsets[index], bytes, length) == 0) {
+            pool->length = start;
+            return index;
+        }
+        slot = (slot + 1) & (pool->tableSize - 1);
+    }
+
+    if (pool->count >= pool->capacityStrings) {
+        int capacity = pool->capacityStrings ? pool->capacityStrings * 2 : 64;
+        uint32_t *offsets = (uint32_t *)realloc(pool->offsets, capacity * sizeof(uint32_t));
+        if (offsets) {
+            pool->offsets = offsets;
+        }
+        uint32_t *lengths = (uint32_t *)realloc(pool->lengths, capacity * sizeof(uint32_t));
+        if (lengths) {
+            pool->lengths = lengths;
+        }
+        if (!offsets || !lengths) {
+            pool->length = start;
+            return -1;
+        }
+        pool->capacityStrings = capacity;
+    }
+    pool->offsets[pool->count] = (uint32_t)start;
+    pool->lengths[pool->count] = (uint32_t)length;
+    pool->data[start + length] = '\0';
+    pool->length = start + length + 1;
+    pool->table[slot] = pool->count;
+    return pool->count++;
+}
+
+int string_pool_add(StringPool *pool, const char *bytes, size_t length) {
+    if (!reserve_bytes(pool, length + 1)) {
+        return -1;
+    }
+    size_t start = pool->length;
+    memcpy(pool->data + start, bytes, length);
+    return commit_string(pool, start, length);
+}
+
+const char *string_pool_get(const StringPool *pool, int index, size_t *length) {
+    if (length) {
+        *length = pool->lengths[index];
+    }
+    return pool->data + pool->offsets[index];
+}
+
+// Decode the literal text starting at p (after the opening quote) straight
+// into the end of the pool, then deduplicate it
+static int intern_literal(StringPool *pool, const char *p) {
+    // The decoded string is never longer than its source text
+    const char *end = p;
+    while (*end && *end != '"') {
+        end += (*end == '\\' && end[1]) ? 2 : 1;
+    }
+    if (!reserve_bytes(pool, (size_t)(end - p) + 1)) {
+        return -1;
+    }
+
+    size_t start = pool->length;
+    char *out = pool->data + start;
+    while (p < end) {
+        if (*p == '\\') {
+            p++;
+            *out++ = (char)decode_escape(&p);
+        } else {
+            *out++ = *p++;
+        }
+    }
+    return commit_string(pool, start, (size_t)(out - (pool->data + start)));
+}
+
+void print_escaped(FILE *out, const char *bytes, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        unsigned char c = (unsigned char)bytes[i];
+        if (c == '\n') {
+            fputs("\\n", out);
+        } else if (c == '\t') {
+            fputs("\\t", out);
+        } else if (c == '"' || c == '\\') {
+            fprintf(out, "\\%c", c);
+        } else if (c < 0x20 || c >= 0x7f) {
+            fprintf(out, "\\x%02x", c);
+        } else {
+            putc(c, out);
+        }
+    }
+}
+
+int intern_strings(const char *source, Token *tokens, int token_count, StringPool *pool) {
+    for (int i = 0; i < token_count; i++) {
+        if (tokens[i].type != TOKEN_STRING) {
+            continue;
+        }
+        const char *text = source ? source + tokens[i].offset + 1 : tokens[i].value;
+        int index = intern_literal(pool, text);
+        if (index < 0) {
+            return 0;
+        }
+        // Tokens mapped from the cache already hold the same index; leave
+        // them untouched so their pages are not copied
+        if (tokens[i].literal.string != index) {
+            tokens[i].literal.string = index;
+        }
+    }
+    return 1;
+}
@@ -0,0 +1,47 @@
+#ifndef STRPOOL_H
+#define STRPOOL_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lexer.h"
+
+// Constant pool of decoded string literals. Each distinct string is stored
+// once, NUL-terminated, in one contiguous buffer that a code generator can
+// emit as a read-only data section; tokens refer to it by index.
+typedef struct {
+    char *data;             // Decoded strings, back to back
+    size_t length;
+    size_t capacity;
+    uint32_t *offsets;      // Start of each string in data
+    uint32_t *lengths;      // Length of each string, without the NUL
+    int count;
+    int capacityStrings;
+    int *table;             // Open addressing table of string indices
+    size_t tableSize;
+} StringPool;
+
+void string_pool_init(StringPool *pool);
+
+// Forget every string but keep the buffers for reuse
+void string_pool_clear(StringPool *pool);
+void string_pool_free(StringPool *pool);
+
+// Index of a string, adding it if it is not in the pool yet (-1 if out of memory)
+int string_pool_add(StringPool *pool, const char *bytes, size_t length);
+
+// Decoded bytes of string index (NUL-terminated; length may be NULL)
+const char *string_pool_get(const StringPool *pool, int index, size_t *length);
+
+// Print decoded bytes with C escapes for quotes, backslashes and unprintable
+// bytes, so that between quotes they read as the literal
+void print_escaped(FILE *out, const char *bytes, size_t length);
+
+// Decode the escapes of every string literal and store its pool index in
+// token->literal.string. Literals are read from source at the token offsets,
+// so they are not limited by the size of Token.value; without a source (a
+// token file) the token text is used. Returns 1 on success, 0 if out of memory.
+int intern_strings(const char *source, Token *tokens, int token_count, StringPool *pool);
+
+#endif
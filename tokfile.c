@@ -0,0 +1,233 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "tokfile.h"
+#include "cache.h"
+#include "hugemem.h"
+
+#define TOKFILE_HEADER_SIZE 24
+
+typedef struct {
+    unsigned char *data;
+    size_t length;
+    size_t capacity;
+} ByteBuffer;
+
+static int buffer_reserve(ByteBuffer *buf, size_t extra) {
+    if (buf->length + extra <= buf->capacity) {
+        return 1;
+    }
+    size_t capacity = buf->capacity ? buf->capacity : 4096;
+    while (capacity < buf->length + extra) {
+        capacity *= 2;
+    }
+    unsigned char *data = (unsigned char *)realloc(buf->data, capacity);
+    if (!data) {
+        return 0;
+    }
+    buf->data = data;
+    buf->capacity = capacity;
+    return 1;
+}
+
+// Append an unsigned LEB128 varint (at most 5 bytes for 32-bit values)
+static int buffer_put_varint(ByteBuffer *buf, uint32_t value) {
+    if (!buffer_reserve(buf, 5)) {
+        return 0;
+    }
+    while (value >= 0x80) {
+        buf->data[buf->length++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    buf->data[buf->length++] = (unsigned char)value;
+    return 1;
+}
+
+static int buffer_put_u32(ByteBuffer *buf, uint32_t value) {
+    if (!buffer_reserve(buf, 4)) {
+        return 0;
+    }
+    memcpy(buf->data + buf->length, &value, 4);
+    buf->length += 4;
+    return 1;
+}
+
+int write_token_file(const char *filename, const Token *tokens, int token_count) {
+    ByteBuffer blob = {0}, offsets = {0}, body = {0};
+    int ok = 1;
+
+    // Open addressing table of pool indices used to deduplicate token values
+    size_t table_size = 64;
+    while (table_size < (size_t)token_count * 2) {
+        table_size *= 2;
+    }
+    int *table = (int *)malloc(table_size * sizeof(int));
+    const char **pool = (const char **)malloc((token_count + 1) * sizeof(char *));
+    if (!table || !pool) {
+        ok = 0;
+    } else {
+        memset(table, -1, table_size * sizeof(int));
+    }
+
+    uint32_t pool_count = 0;
+    int previous_offset = 0;
+    for (int i = 0; ok && i < token_count; i++) {
+        const char *value = tokens[i].value;
+        size_t length = strnlen(value, sizeof(tokens[i].value) - 1);
+
+        // Find the value in the pool, adding it if this is the first occurrence
+        size_t slot = hash_bytes(value, length, 0) & (table_size - 1);
+        while (table[slot] >= 0 && strcmp(pool[table[slot]], value) != 0) {
+            slot = (slot + 1) & (table_size - 1);
+        }
+        if (table[slot] < 0) {
+            table[slot] = pool_count;
+            pool[pool_count++] = value;
+            ok = buffer_put_u32(&offsets, (uint32_t)blob.length) &&
+                 buffer_reserve(&blob, length + 1);
+            if (ok) {
+                memcpy(blob.data + blob.length, value, length);
+                blob.data[blob.length + length] = '\0';
+                blob.length += length + 1;
+            }
+        }
+
+        // Offsets are stored as zigzag-encoded deltas from the previous token
+        int delta = tokens[i].offset - previous_offset;
+        previous_offset = tokens[i].offset;
+        ok = ok &&
+             buffer_put_varint(&body, (uint32_t)tokens[i].type) &&
+             buffer_put_varint(&body, ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31)) &&
+             buffer_put_varint(&body, (uint32_t)table[slot]);
+    }
+    ok = ok && buffer_put_u32(&offsets, (uint32_t)blob.length);
+
+    FILE *file = ok ? fopen(filename, "wb") : NULL;
+    if (file) {
+        uint32_t header[6];
+        memcpy(&header[0], "ATOK", 4);
+        header[1] = TOKFILE_VERSION;
+        header[2] = (uint32_t)token_count;
+        header[3] = pool_count;
+        header[4] = (uint32_t)blob.length;
+        header[5] = (uint32_t)body.length;
+        ok = fwrite(header, sizeof(header), 1, file) == 1 &&
+             fwrite(offsets.data, 1, offsets.length, file) == offsets.length &&
+             fwrite(blob.data, 1, blob.length, file) == blob.length &&
+             fwrite(body.data, 1, body.length, file) == body.length;
+        if (fclose(file) != 0) {
+            ok = 0;
+        }
+    } else {
+        ok = 0;
+    }
+
+    free(table);
+    free(pool);
+    free(blob.data);
+    free(offsets.data);
+    free(body.data);
+    return ok;
+}
+
+// Decode one varint, returning 0 if it runs past the end of the section
+static inline int get_varint(const unsigned char **p, const unsigned char *end, uint32_t *value) {
+    const unsigned char *q = *p;
+    if (q < end && *q < 0x80) {    // Fast path: single byte
+        *value = *q;
+        *p = q + 1;
+        return 1;
+    }
+    uint32_t result = 0;
+    for (int shift = 0; shift < 35 && q < end; shift += 7) {
+        unsigned char byte = *q++;
+        result |= (uint32_t)(byte & 0x7f) << shift;
+        if (byte < 0x80) {
+            *value = result;
+            *p = q;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+Token *read_token_file(const char *filename, int *token_count) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error opening token file: %s\n", filename);
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < TOKFILE_HEADER_SIZE) {
+        fprintf(stderr, "Invalid token file: %s\n", filename);
+        close(fd);
+        return NULL;
+    }
+    size_t size = st.st_size;
+    const unsigned char *map = (const unsigned char *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        fprintf(stderr, "Error mapping token file: %s\n", filename);
+        return NULL;
+    }
+
+    uint32_t header[6];
+    memcpy(header, map, sizeof(header));
+    uint32_t count = header[2], pool_count = header[3];
+    uint32_t blob_size = header[4], body_size = header[5];
+    const uint32_t *offsets = (const uint32_t *)(map + TOKFILE_HEADER_SIZE);
+    const char *blob = (const char *)(offsets + pool_count + 1);
+    const unsigned char *body = (const unsigned char *)blob + blob_size;
+
+    Token *tokens = NULL;
+    int ok = memcmp(map, "ATOK", 4) == 0 &&
+             header[1] == TOKFILE_VERSION &&
+             count <= 0x7fffffff && pool_count < 0x3fffffff &&
+             TOKFILE_HEADER_SIZE + (uint64_t)(pool_count + 1) * 4 + blob_size + body_size == size &&
+             offsets[pool_count] == blob_size;
+    if (ok) {
+        tokens = (Token *)huge_alloc((count ? count : 1) * sizeof(Token));
+        ok = tokens != NULL;
+    }
+
+    const unsigned char *p = body, *end = body + body_size;
+    int offset = 0;
+    for (uint32_t i = 0; ok && i < count; i++) {
+        uint32_t type, delta, index;
+        if (!get_varint(&p, end, &type) || !get_varint(&p, end, &delta) ||
+            !get_varint(&p, end, &index) || type > TOKEN_CAST || index >= pool_count) {
+            ok = 0;
+            break;
+        }
+        uint32_t start = offsets[index], stop = offsets[index + 1];
+        if (start >= stop || stop > blob_size || stop - start > sizeof(tokens[i].value) ||
+            blob[stop - 1] != '\0') {
+            ok = 0;
+            break;
+        }
+        offset += (int)((delta >> 1) ^ -(delta & 1));
+        tokens[i].type = (TokenType)type;
+        tokens[i].offset = offset;
+        memcpy(tokens[i].value, blob + start, stop - start);
+        // Literal values are not stored; decode them again from the text
+        if (!decode_literal(&tokens[i])) {
+            ok = 0;
+            break;
+        }
+    }
+
+    munmap((void *)map, size);
+    if (!ok) {
+        fprintf(stderr, "Invalid token file: %s\n", filename);
+        huge_free(tokens);
+        return NULL;
+    }
+    *token_count = (int)count;
+    return tokens;
+}
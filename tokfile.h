@@ -0,0 +1,22 @@
+#ifndef TOKFILE_H
+#define TOKFILE_H
+
+#include "lexer.h"
+
+#define TOKFILE_VERSION 1
+
+// Binary token stream file (.tok):
+//   header   "ATOK", version, token count, pool count, pool bytes, token bytes (u32 each)
+//   pool     (pool count + 1) u32 offsets into the string blob, then the blob
+//            of NUL-terminated, deduplicated token values
+//   tokens   per token: varint type, varint offset delta, varint pool index
+//
+// The pool can be used in place from a mapping; only the token section is decoded.
+
+// Returns 1 on success, 0 on failure
+int write_token_file(const char *filename, const Token *tokens, int token_count);
+
+// Returns a token array from huge_alloc, or NULL if the file is missing or malformed
+Token *read_token_file(const char *filename, int *token_count);
+
+#endif
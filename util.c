@@ -0,0 +1,46 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <time.h>
+
+#include "util.h"
+
+double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+char *load_file(const char *path, size_t *length) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *buffer = size >= 0 ? (char *)malloc((size_t)size + 1) : NULL;
+    if (buffer) {
+        *length = fread(buffer, 1, size, file);
+        buffer[*length] = '\0';
+    }
+    fclose(file);
+    return buffer;
+}
+
+int grow_array(void **items, int *capacity, int count, size_t item_size) {
+    if (count < *capacity) {
+        return 1;
+    }
+    if (*capacity > INT_MAX / 2) {
+        return 0;
+    }
+    int new_capacity = *capacity ? *capacity * 2 : 16;
+    void *grown = realloc(*items, (size_t)new_capacity * item_size);
+    if (!grown) {
+        return 0;
+    }
+    *items = grown;
+    *capacity = new_capacity;
+    return 1;
+}
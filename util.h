@@ -0,0 +1,21 @@
+#ifndef UTIL_H
+#define UTIL_H
+
+#include <stddef.h>
+
+// Helpers shared by the command-line modes and the analyses
+
+// Milliseconds on the monotonic clock
+double now_ms(void);
+
+// Read a whole file into a NUL-terminated buffer and store its length in
+// *length. Returns NULL if it cannot be opened or the buffer cannot be
+// allocated; nothing is printed, so long-running modes can go on.
+char *load_file(const char *path, size_t *length);
+
+// Make room for one more item in an array of *capacity items of item_size
+// bytes holding count, doubling it (from 16) when full. Returns 0 if out of
+// memory, leaving the array as it was.
+int grow_array(void **items, int *capacity, int count, size_t item_size);
+
+#endif
@@ -0,0 +1,440 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+
+#include "watch.h"
+#include "lexer.h"
+#include "parser.h"
+#include "bounds.h"
+#include "cache.h"
+#include "hugemem.h"
+#include "util.h"
+
+#define WATCH_DIAG_CAPACITY (64 * 1024)
+#define WATCH_EVENT_BUFFER (64 * 1024)
+#define WATCH_SETTLE_MS 5       // Events this close together are one save
+#define WATCH_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE)
+
+// Last result of one function, found again by the hash of its tokens
+typedef struct {
+    uint64_t hash;
+    int offset;             // Byte offset of its name
+    uint64_t layout;        // Of the text and position it had, when it has messages
+    int ok;
+    char *diagnostics;      // Messages of its body, or NULL
+} FunctionResult;
+
+typedef struct WatchedFile {
+    char *name;             // Relative to the watched directory
+    uint64_t contentHash;
+    FunctionResult *functions;  // Sorted by hash
+    int functionCount;
+    struct WatchedFile *next;
+} WatchedFile;
+
+typedef struct {
+    char dir[PATH_MAX];
+    const char *only;       // The one file watched in dir, or NULL for all
+    int trace;
+    BoundsWorkspace *bounds;    // NULL with --no-bounds-check
+    WatchedFile *files;
+    Token *tokens;          // Reused from build to build
+    int tokenCapacity;
+    int *brackets;
+    int bracketCapacity;
+    char *diag;
+} Watcher;
+
+// AtomC sources, without editor swap and backup files
+static int is_source_name(const char *name) {
+    size_t length = strlen(name);
+    return name[0] != '.' && length > 2 && strcmp(name + length - 2, ".c") == 0;
+}
+
+static int scan_filter(const struct dirent *entry) {
+    return is_source_name(entry->d_name);
+}
+
+static void free_results(FunctionResult *results, int count) {
+    for (int i = 0; i < count; i++) {
+        free(results[i].diagnostics);
+    }
+    free(results);
+}
+
+static WatchedFile *find_file(Watcher *watcher, const char *name, int create) {
+    for (WatchedFile *file = watcher->files; file; file = file->next) {
+        if (strcmp(file->name, name) == 0) {
+            return file;
+        }
+    }
+    if (!create) {
+        return NULL;
+    }
+    WatchedFile *file = (WatchedFile *)calloc(1, sizeof(WatchedFile));
+    if (!file || !(file->name = strdup(name))) {
+        free(file);
+        return NULL;
+    }
+    file->next = watcher->files;
+    watcher->files = file;
+    return file;
+}
+
+static void forget_file(Watcher *watcher, const char *name) {
+    for (WatchedFile **link = &watcher->files; *link; link = &(*link)->next) {
+        WatchedFile *file = *link;
+        if (strcmp(file->name, name) == 0) {
+            *link = file->next;
+            free_results(file->functions, file->functionCount);
+            free(file->name);
+            free(file);
+            return;
+        }
+    }
+}
+
+// Hash of a function's tokens from its return type to its closing '}'.
+// Offsets are left out, so moving a function does not change it.
+static uint64_t function_hash(const Token *tokens, int first, int last) {
+    uint64_t hash = 0;
+    for (int k = first; k <= last; k++) {
+        hash = hash_bytes(&tokens[k].type, sizeof(tokens[k].type), hash);
+        hash = hash_bytes(tokens[k].value, strlen(tokens[k].value), hash);
+    }
+    return hash;
+}
+
+static int compare_results(const void *a, const void *b) {
+    uint64_t x = ((const FunctionResult *)a)->hash, y = ((const FunctionResult *)b)->hash;
+    return x < y ? -1 : x > y;
+}
+
+// Hash of the text of the function in tokens [first, last] and of the line
+// and column it starts at. When it and the offset match, every position
+// inside the function is the same.
+static uint64_t function_layout(const Token *tokens, const char *source, LineIndex *lines,
+                                int first, int last) {
+    int line = 0, column = 0;
+    line_index_lookup(lines, tokens[first].offset, &line, &column);
+    uint64_t seed = ((uint64_t)(uint32_t)line << 32) | (uint32_t)column;
+    return hash_bytes(source + tokens[first].offset, tokens[last].offset + 1 - tokens[first].offset, seed);
+}
+
+// Previous result of a function with these tokens. One with messages is
+// only reused at the same offset, line and column and with the same text,
+// since the messages carry positions; the layout is only worked out then.
+static const FunctionResult *find_result(const WatchedFile *file, uint64_t hash, int offset,
+                                         const Token *tokens, const char *source, LineIndex *lines,
+                                         int first, int last) {
+    int low = 0, high = file->functionCount;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (file->functions[middle].hash < hash) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    int has_layout = 0;
+    uint64_t layout = 0;
+    for (int i = low; i < file->functionCount && file->functions[i].hash == hash; i++) {
+        const FunctionResult *result = &file->functions[i];
+        if (result->diagnostics && result->offset != offset) {
+            continue;
+        }
+        if (result->diagnostics && !has_layout) {
+            layout = function_layout(tokens, source, lines, first, last);
+            has_layout = 1;
+        }
+        if (!result->diagnostics || result->layout == layout) {
+            return result;
+        }
+    }
+    return NULL;
+}
+
+// Parse the bodies of the functions in outline that changed since the last
+// build of file. Returns the results in outline order, or NULL if out of memory.
+static FunctionResult *parse_functions(Watcher *watcher, const WatchedFile *file, const char *source,
+                                       int token_count, const Outline *outline, ParseDiagnostics *diag,
+                                       int *parsed) {
+    FunctionResult *results = (FunctionResult *)calloc(outline->count + 1, sizeof(FunctionResult));
+    if (!results) {
+        return NULL;
+    }
+    for (int i = 0; i < outline->count; i++) {
+        const OutlineItem *item = &outline->items[i];
+        FunctionResult *result = &results[i];
+        result->ok = 1;
+        // Bodies the skeleton could not skip were already parsed there
+        if (item->kind != OUTLINE_FUNCTION || item->bodyEnd < 0) {
+            continue;
+        }
+        int first = item->nameIndex > 0 ? item->nameIndex - 1 : 0;
+        result->hash = function_hash(watcher->tokens, first, item->bodyEnd);
+        result->offset = watcher->tokens[item->nameIndex].offset;
+
+        const FunctionResult *previous = find_result(file, result->hash, result->offset, watcher->tokens,
+                                                     source, diag->lines, first, item->bodyEnd);
+        if (previous) {
+            result->ok = previous->ok;
+            result->layout = previous->layout;
+            result->diagnostics = previous->diagnostics ? strdup(previous->diagnostics) : NULL;
+            continue;
+        }
+
+        // The body's messages go after the skeleton's and are copied out
+        ParseDiagnostics body = {diag->buffer + diag->length, diag->capacity - diag->length, 0,
+                                 diag->trace, diag->lines, 0, 0};
+        result->ok = parseFunctionBody(watcher->tokens, token_count, item, &body);
+        if (body.length > 0) {
+            result->diagnostics = strdup(body.buffer);
+            result->layout = function_layout(watcher->tokens, source, diag->lines, first, item->bodyEnd);
+        }
+        diag->buffer[diag->length] = '\0';
+        (*parsed)++;
+    }
+    return results;
+}
+
+// Compile a file again if its content changed and print the outcome.
+// start is when the change was noticed.
+static void rebuild(Watcher *watcher, const char *name, double start) {
+    char path[PATH_MAX + NAME_MAX + 2];
+    snprintf(path, sizeof(path), "%s/%s", watcher->dir, name);
+    size_t length = 0;
+    char *source = load_file(path, &length);
+    if (!source) {
+        if (find_file(watcher, name, 0)) {
+            forget_file(watcher, name);
+            printf("%s: removed\n", path);
+            fflush(stdout);
+        }
+        return;
+    }
+
+    // Saving without an edit changes nothing
+    WatchedFile *file = find_file(watcher, name, 1);
+    uint64_t content = hash_bytes(source, length, 0);
+    if (!file || (file->contentHash == content && file->functions)) {
+        free(source);
+        return;
+    }
+    file->contentHash = content;
+
+    double build_start = now_ms();
+    int token_count = 0;
+    int ok = tokenize_source_into(source, &watcher->tokens, &watcher->tokenCapacity, &token_count);
+    if (ok && token_count + 1 > watcher->bracketCapacity) {
+        int *grown = (int *)realloc(watcher->brackets, (token_count + 1) * sizeof(int));
+        ok = grown != NULL;
+        if (ok) {
+            watcher->brackets = grown;
+            watcher->bracketCapacity = token_count + 1;
+        }
+    }
+    if (!ok) {
+        printf("%s: out of memory\n", path);
+        fflush(stdout);
+        free(source);
+        return;
+    }
+    build_bracket_index(watcher->tokens, token_count, watcher->brackets);
+
+    LineIndex lines;
+    line_index_init(&lines, source);
+    ParseDiagnostics diag = {watcher->diag, WATCH_DIAG_CAPACITY, 0, watcher->trace, &lines, 0, 0};
+    watcher->diag[0] = '\0';
+    Outline outline = {NULL, 0, 0};
+    ok = parseOutline(watcher->tokens, token_count, watcher->brackets, &outline, &diag);
+    fputs(watcher->diag, stdout);
+
+    // Without a skeleton the function boundaries are unknown; the results of
+    // the last good build stay for the next save
+    int parsed = 0, functions = 0;
+    if (ok) {
+        FunctionResult *results = parse_functions(watcher, file, source, token_count, &outline, &diag, &parsed);
+        ok = results != NULL;
+        for (int i = 0; results && i < outline.count; i++) {
+            if (results[i].diagnostics) {
+                fputs(results[i].diagnostics, stdout);
+            }
+            ok = ok && results[i].ok;
+        }
+        if (results) {
+            // Keep only the functions, sorted for lookup
+            for (int i = 0; i < outline.count; i++) {
+                if (outline.items[i].kind == OUTLINE_FUNCTION && outline.items[i].bodyEnd >= 0) {
+                    results[functions++] = results[i];
+                }
+            }
+            qsort(results, functions, sizeof(FunctionResult), compare_results);
+            free_results(file->functions, file->functionCount);
+            file->functions = results;
+            file->functionCount = functions;
+        }
+    }
+
+    // Like the command line, check array bounds once the syntax is clean
+    int bounds_ok = 1;
+    if (ok && watcher->bounds) {
+        ParseDiagnostics bounds = {watcher->diag, WATCH_DIAG_CAPACITY, 0, 0, &lines, 0, -1};
+        watcher->diag[0] = '\0';
+        bounds_ok = check_array_bounds_into(watcher->tokens, token_count, watcher->brackets, path,
+                                            watcher->bounds, &bounds, NULL);
+        fputs(watcher->diag, stdout);
+        if (bounds_ok < 0) {
+            printf("%s: out of memory\n", path);
+        }
+    }
+
+    double end = now_ms();
+    printf("%s: syntax analysis %s%s, %d of %d functions parsed, %.2f ms (%.2f ms after the change)\n",
+           path, ok ? "successful" : "failed", bounds_ok > 0 ? "" : ", array bounds check failed",
+           parsed, functions, end - build_start, end - start);
+    fflush(stdout);
+    free(outline.items);
+    line_index_free(&lines);
+    free(source);
+}
+
+// Build every watched file whose content differs from the last build
+static void rebuild_all(Watcher *watcher) {
+    struct dirent **entries;
+    int count = scandir(watcher->dir, &entries, scan_filter, alphasort);
+    for (int i = 0; i < count; i++) {
+        if (!watcher->only || strcmp(entries[i]->d_name, watcher->only) == 0) {
+            rebuild(watcher, entries[i]->d_name, now_ms());
+        }
+        free(entries[i]);
+    }
+    if (count >= 0) {
+        free(entries);
+    }
+}
+
+// Add a changed name to the batch unless it is already there
+static int note_change(char ***names, int *count, int *capacity, const char *name) {
+    for (int i = 0; i < *count; i++) {
+        if (strcmp((*names)[i], name) == 0) {
+            return 1;
+        }
+    }
+    if (*count >= *capacity) {
+        int grown_capacity = *capacity ? *capacity * 2 : 16;
+        char **grown = (char **)realloc(*names, grown_capacity * sizeof(char *));
+        if (!grown) {
+            return 0;
+        }
+        *names = grown;
+        *capacity = grown_capacity;
+    }
+    return ((*names)[*count] = strdup(name)) != NULL && ++*count;
+}
+
+int run_watch(const char *path, int trace, int bounds_check) {
+    Watcher watcher;
+    memset(&watcher, 0, sizeof(watcher));
+    watcher.trace = trace;
+
+    // A single file is watched through its directory
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        printf("Cannot watch %s\n", path);
+        return -1;
+    }
+    if (S_ISDIR(st.st_mode)) {
+        snprintf(watcher.dir, sizeof(watcher.dir), "%s", path);
+    } else {
+        const char *slash = strrchr(path, '/');
+        snprintf(watcher.dir, sizeof(watcher.dir), "%.*s", slash ? (int)(slash - path) : 1,
+                 slash ? path : ".");
+        watcher.only = slash ? slash + 1 : path;
+    }
+
+    int fd = inotify_init1(IN_CLOEXEC);
+    if (fd < 0 || inotify_add_watch(fd, watcher.dir, WATCH_EVENTS) < 0) {
+        printf("Cannot watch %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    watcher.diag = (char *)malloc(WATCH_DIAG_CAPACITY);
+    watcher.bounds = bounds_check ? bounds_workspace_new() : NULL;
+    if (!watcher.diag || (bounds_check && !watcher.bounds)) {
+        printf("Out of memory\n");
+        free(watcher.diag);
+        bounds_workspace_free(watcher.bounds);
+        return -1;
+    }
+
+    rebuild_all(&watcher);
+    printf("Watching %s for changes\n", path);
+    fflush(stdout);
+
+    char buffer[WATCH_EVENT_BUFFER] __attribute__((aligned(__alignof__(struct inotify_event))));
+    char **names = NULL;
+    int name_count = 0, name_capacity = 0;
+    for (;;) {
+        ssize_t length = read(fd, buffer, sizeof(buffer));
+        if (length < 0 && errno == EINTR) {
+            continue;
+        }
+        if (length <= 0) {
+            break;
+        }
+        double start = now_ms();
+
+        // Editors save in several steps; collect them into one batch
+        int overflow = 0;
+        struct pollfd more = {fd, POLLIN, 0};
+        do {
+            for (char *p = buffer; p < buffer + length;) {
+                const struct inotify_event *event = (const struct inotify_event *)p;
+                if (event->mask & IN_Q_OVERFLOW) {
+                    overflow = 1;
+                } else if (event->len > 0 && is_source_name(event->name) &&
+                           (!watcher.only || strcmp(event->name, watcher.only) == 0) &&
+                           !note_change(&names, &name_count, &name_capacity, event->name)) {
+                    overflow = 1;
+                }
+                p += sizeof(struct inotify_event) + event->len;
+            }
+            length = 0;
+            if (poll(&more, 1, WATCH_SETTLE_MS) > 0) {
+                length = read(fd, buffer, sizeof(buffer));
+            }
+        } while (length > 0);
+
+        // Events were lost: compare every file with its last build
+        if (overflow) {
+            rebuild_all(&watcher);
+        }
+        for (int i = 0; i < name_count; i++) {
+            if (!overflow) {
+                rebuild(&watcher, names[i], start);
+            }
+            free(names[i]);
+        }
+        name_count = 0;
+    }
+
+    printf("Stopped watching %s: %s\n", path, strerror(errno));
+    close(fd);
+    free(names);
+    free(watcher.diag);
+    bounds_workspace_free(watcher.bounds);
+    huge_free(watcher.tokens);
+    free(watcher.brackets);
+    while (watcher.files) {
+        forget_file(&watcher, watcher.files->name);
+    }
+    return -1;
+}
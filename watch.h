@@ -0,0 +1,16 @@
+#ifndef WATCH_H
+#define WATCH_H
+
+// Watch mode: compile every .c file of a directory (or one file), then
+// wait on inotify and recompile the files that are saved. Within a file the
+// top-level skeleton is always parsed again, but a function whose tokens
+// hash the same as in the last build keeps its previous result instead of
+// having its body parsed. Once the syntax is clean the array bounds are
+// checked as on the command line, unless bounds_check is 0. Each rebuild
+// prints the diagnostics of the file and a line with how many functions were
+// parsed and the latency from the change event to the finished result.
+
+// Runs until killed. Returns -1 if the path cannot be watched.
+int run_watch(const char *path, int trace, int bounds_check);
+
+#endif
@@ -0,0 +1,626 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "xref.h"
+#include "lexer.h"
+#include "lineindex.h"
+#include "namemap.h"
+#include "hugemem.h"
+#include "util.h"
+
+#define XREF_HEADER_SIZE 24
+
+typedef struct {
+    unsigned char *data;
+    size_t length;
+    size_t capacity;
+} ByteBuffer;
+
+// A definition or use found while indexing, before it is encoded
+typedef struct {
+    const char *name;
+    uint32_t file;
+    uint32_t line;
+    uint32_t column;
+    int definition;
+} Occurrence;
+
+// Identifiers of one source file. names holds each distinct name once.
+typedef struct {
+    int ok;
+    uint64_t size;
+    uint64_t mtime;
+    int reused;             // Index of the file in the old index, or -1
+    char *names;
+    Occurrence *sites;
+    int count;
+} FileScan;
+
+typedef struct {
+    char **paths;
+    FileScan *scans;
+    int count;
+    atomic_int next;        // Next file to hand out
+} IndexWork;
+
+static int buffer_reserve(ByteBuffer *buf, size_t extra) {
+    if (buf->length + extra <= buf->capacity) {
+        return 1;
+    }
+    size_t capacity = buf->capacity ? buf->capacity : 4096;
+    while (capacity < buf->length + extra) {
+        capacity *= 2;
+    }
+    unsigned char *data = (unsigned char *)realloc(buf->data, capacity);
+    if (!data) {
+        return 0;
+    }
+    buf->data = data;
+    buf->capacity = capacity;
+    return 1;
+}
+
+static int buffer_put(ByteBuffer *buf, const void *data, size_t length) {
+    if (!buffer_reserve(buf, length)) {
+        return 0;
+    }
+    memcpy(buf->data + buf->length, data, length);
+    buf->length += length;
+    return 1;
+}
+
+// Append an unsigned LEB128 varint (at most 5 bytes for 32-bit values)
+static int buffer_put_varint(ByteBuffer *buf, uint32_t value) {
+    if (!buffer_reserve(buf, 5)) {
+        return 0;
+    }
+    while (value >= 0x80) {
+        buf->data[buf->length++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    buf->data[buf->length++] = (unsigned char)value;
+    return 1;
+}
+
+// Decode one varint, returning 0 if it runs past the end of the section
+static inline int get_varint(const unsigned char **p, const unsigned char *end, uint32_t *value) {
+    const unsigned char *q = *p;
+    if (q < end && *q < 0x80) {    // Fast path: single byte
+        *value = *q;
+        *p = q + 1;
+        return 1;
+    }
+    uint32_t result = 0;
+    for (int shift = 0; shift < 35 && q < end; shift += 7) {
+        unsigned char byte = *q++;
+        result |= (uint32_t)(byte & 0x7f) << shift;
+        if (byte < 0x80) {
+            *value = result;
+            *p = q;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int xref_open(const char *path, XrefIndex *index) {
+    memset(index, 0, sizeof(*index));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < XREF_HEADER_SIZE) {
+        close(fd);
+        return 0;
+    }
+    size_t size = st.st_size;
+    const unsigned char *map = (const unsigned char *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return 0;
+    }
+
+    uint32_t header[6];
+    memcpy(header, map, sizeof(header));
+    uint64_t files_size = (uint64_t)header[2] * sizeof(XrefFile);
+    uint64_t names_size = (uint64_t)header[3] * sizeof(XrefName);
+    if (memcmp(map, "AXRF", 4) != 0 || header[1] != XREF_VERSION ||
+        XREF_HEADER_SIZE + files_size + names_size + header[4] + header[5] != size ||
+        (header[5] > 0 && map[size - 1] != '\0')) {
+        munmap((void *)map, size);
+        return 0;
+    }
+    index->map = (void *)map;
+    index->mapSize = size;
+    index->fileCount = header[2];
+    index->nameCount = header[3];
+    index->files = (const XrefFile *)(map + XREF_HEADER_SIZE);
+    index->names = (const XrefName *)(map + XREF_HEADER_SIZE + files_size);
+    index->postings = map + XREF_HEADER_SIZE + files_size + names_size;
+    index->postingsSize = header[4];
+    index->strings = (const char *)index->postings + header[4];
+    index->stringsSize = header[5];
+    for (uint32_t i = 0; i < index->fileCount; i++) {
+        if (index->files[i].path >= index->stringsSize) {
+            xref_close(index);
+            return 0;
+        }
+    }
+    // Every site takes at least three varint bytes, which bounds the site
+    // count of a name by the postings left after its offset
+    for (uint32_t i = 0; i < index->nameCount; i++) {
+        const XrefName *name = &index->names[i];
+        if (name->text >= index->stringsSize || name->postings > index->postingsSize ||
+            name->sites > (index->postingsSize - name->postings) / 3 || name->definitions > name->sites) {
+            xref_close(index);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void xref_close(XrefIndex *index) {
+    if (index->map) {
+        munmap(index->map, index->mapSize);
+    }
+    memset(index, 0, sizeof(*index));
+}
+
+const XrefName *xref_find(const XrefIndex *index, const char *name) {
+    uint32_t low = 0, high = index->nameCount;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        const XrefName *entry = &index->names[middle];
+        int order = strcmp(index->strings + entry->text, name);
+        if (order == 0) {
+            return entry;
+        }
+        if (order < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return NULL;
+}
+
+int xref_sites(const XrefIndex *index, const XrefName *name, XrefSite *sites) {
+    if (name->postings > index->postingsSize) {
+        return 0;
+    }
+    const unsigned char *p = index->postings + name->postings;
+    const unsigned char *end = index->postings + index->postingsSize;
+    uint32_t file = 0, line = 0;
+    for (uint32_t i = 0; i < name->sites; i++) {
+        uint32_t file_delta, line_delta, column;
+        if (!get_varint(&p, end, &file_delta) || !get_varint(&p, end, &line_delta) ||
+            !get_varint(&p, end, &column)) {
+            return 0;
+        }
+        // A new file starts its lines from zero
+        if (file_delta != 0) {
+            line = 0;
+        }
+        file += file_delta;
+        line += line_delta;
+        if (file >= index->fileCount) {
+            return 0;
+        }
+        sites[i].file = file;
+        sites[i].line = line;
+        sites[i].column = column >> 1;
+        sites[i].definition = column & 1;
+    }
+    return 1;
+}
+
+static int is_type_keyword(const Token *token) {
+    return token_is_keyword(token, KEYWORD_INT) || token_is_keyword(token, KEYWORD_DOUBLE) ||
+           token_is_keyword(token, KEYWORD_CHAR) || token_is_keyword(token, KEYWORD_VOID) ||
+           token_is_keyword(token, KEYWORD_FLOAT);
+}
+
+// Collect the identifiers of one file. A name is a definition when it
+// follows a type (int x, struct S x, parameters and functions), when it is a
+// struct name followed by its '{', or when it follows a ',' in the same
+// declaration (int a[2], b).
+static void scan_file(const char *path, uint32_t file, FileScan *scan, Token **tokens, int *capacity) {
+    size_t length;
+    char *source = load_file(path, &length);
+    int token_count = 0;
+    if (!source || !tokenize_source_into(source, tokens, capacity, &token_count)) {
+        free(source);
+        return;
+    }
+
+    // Every name fits, so the pointers into names stay valid
+    size_t bytes = 1;
+    int identifiers = 0;
+    for (int k = 0; k < token_count; k++) {
+        if ((*tokens)[k].type == TOKEN_IDENTIFIER) {
+            bytes += strlen((*tokens)[k].value) + 1;
+            identifiers++;
+        }
+    }
+    scan->names = (char *)malloc(bytes);
+    scan->sites = (Occurrence *)malloc((identifiers + 1) * sizeof(Occurrence));
+    NameMap seen;
+    name_map_init(&seen);
+    LineIndex lines;
+    line_index_init(&lines, source);
+    scan->ok = scan->names && scan->sites;
+
+    size_t used = 0;
+    int depth = 0, declaring = -1;   // Paren depth of the declaration being read
+    for (int k = 0; scan->ok && k < token_count; k++) {
+        const Token *token = &(*tokens)[k];
+        if (token->type == TOKEN_LPAREN) {
+            depth++;
+        } else if (token->type == TOKEN_RPAREN) {
+            depth--;
+            declaring = depth < declaring ? -1 : declaring;
+        } else if (token->type == TOKEN_SEMICOLON || token->type == TOKEN_LBRACE ||
+                   token->type == TOKEN_RBRACE) {
+            declaring = -1;
+        }
+        if (token->type != TOKEN_IDENTIFIER) {
+            continue;
+        }
+
+        const Token *previous = k > 0 ? &(*tokens)[k - 1] : NULL;
+        int definition = 0;
+        if (previous && token_is_keyword(previous, KEYWORD_STRUCT)) {
+            definition = k + 1 < token_count && (*tokens)[k + 1].type == TOKEN_LBRACE;
+        } else if (previous && (is_type_keyword(previous) ||
+                                (previous->type == TOKEN_IDENTIFIER && k >= 2 &&
+                                 token_is_keyword(&(*tokens)[k - 2], KEYWORD_STRUCT)))) {
+            definition = 1;
+            declaring = depth;
+        } else if (previous && previous->type == TOKEN_COMMA && declaring == depth) {
+            definition = 1;
+        }
+
+        int offset = name_map_get(&seen, token->value);
+        if (offset < 0) {
+            offset = (int)used;
+            size_t size = strlen(token->value) + 1;
+            memcpy(scan->names + used, token->value, size);
+            used += size;
+            scan->ok = name_map_set(&seen, scan->names + offset, offset);
+        }
+        int line = 0, column = 0;
+        scan->ok = scan->ok && line_index_lookup(&lines, token->offset, &line, &column);
+        Occurrence *site = &scan->sites[scan->count++];
+        site->name = scan->names + offset;
+        site->file = file;
+        site->line = (uint32_t)line;
+        site->column = (uint32_t)column;
+        site->definition = definition;
+    }
+
+    name_map_free(&seen);
+    line_index_free(&lines);
+    free(source);
+}
+
+static void *index_worker(void *arg) {
+    IndexWork *work = (IndexWork *)arg;
+    Token *tokens = NULL;
+    int capacity = 0;
+    for (;;) {
+        int i = atomic_fetch_add(&work->next, 1);
+        if (i >= work->count) {
+            break;
+        }
+        if (work->scans[i].reused < 0) {
+            scan_file(work->paths[i], (uint32_t)i, &work->scans[i], &tokens, &capacity);
+        }
+    }
+    huge_free(tokens);
+    return NULL;
+}
+
+static int compare_occurrences(const void *a, const void *b) {
+    const Occurrence *x = (const Occurrence *)a, *y = (const Occurrence *)b;
+    if (x->name != y->name) {
+        int order = strcmp(x->name, y->name);
+        if (order != 0) {
+            return order;
+        }
+    }
+    if (x->file != y->file) {
+        return x->file < y->file ? -1 : 1;
+    }
+    if (x->line != y->line) {
+        return x->line < y->line ? -1 : 1;
+    }
+    return x->column < y->column ? -1 : x->column > y->column;
+}
+
+// Encode the sorted occurrences and write the index to a temporary file
+// that replaces index_path atomically
+static int write_index(const char *index_path, char **paths, const FileScan *scans, int file_count,
+                       const Occurrence *sites, size_t site_count, uint32_t *name_count) {
+    ByteBuffer files = {0}, names = {0}, postings = {0}, strings = {0};
+    uint32_t *file_sites = (uint32_t *)calloc(file_count + 1, sizeof(uint32_t));
+    int ok = file_sites != NULL;
+    for (size_t k = 0; ok && k < site_count; k++) {
+        file_sites[sites[k].file]++;
+    }
+    for (int i = 0; ok && i < file_count; i++) {
+        XrefFile entry = {scans[i].size, scans[i].mtime, (uint32_t)strings.length, file_sites[i]};
+        ok = buffer_put(&strings, paths[i], strlen(paths[i]) + 1) &&
+             buffer_put(&files, &entry, sizeof(entry));
+    }
+    free(file_sites);
+
+    *name_count = 0;
+    for (size_t k = 0; ok && k < site_count;) {
+        XrefName entry = {(uint32_t)strings.length, (uint32_t)postings.length, 0, 0};
+        const char *name = sites[k].name;
+        ok = buffer_put(&strings, name, strlen(name) + 1);
+        uint32_t file = 0, line = 0;
+        for (; ok && k < site_count && (sites[k].name == name || strcmp(sites[k].name, name) == 0); k++) {
+            const Occurrence *site = &sites[k];
+            if (site->file != file) {
+                line = 0;
+            }
+            ok = buffer_put_varint(&postings, site->file - file) &&
+                 buffer_put_varint(&postings, site->line - line) &&
+                 buffer_put_varint(&postings, site->column << 1 | (site->definition != 0));
+            file = site->file;
+            line = site->line;
+            entry.sites++;
+            entry.definitions += site->definition != 0;
+        }
+        ok = ok && buffer_put(&names, &entry, sizeof(entry));
+        (*name_count)++;
+    }
+
+    char tmp_path[4096];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.%ld.tmp", index_path, (long)getpid());
+    FILE *out = ok ? fopen(tmp_path, "wb") : NULL;
+    if (out) {
+        uint32_t header[6];
+        memcpy(&header[0], "AXRF", 4);
+        header[1] = XREF_VERSION;
+        header[2] = (uint32_t)file_count;
+        header[3] = *name_count;
+        header[4] = (uint32_t)postings.length;
+        header[5] = (uint32_t)strings.length;
+        ok = fwrite(header, sizeof(header), 1, out) == 1 &&
+             fwrite(files.data, 1, files.length, out) == files.length &&
+             fwrite(names.data, 1, names.length, out) == names.length &&
+             fwrite(postings.data, 1, postings.length, out) == postings.length &&
+             fwrite(strings.data, 1, strings.length, out) == strings.length;
+        if (fclose(out) != 0) {
+            ok = 0;
+        }
+        // rename() is atomic: queries see either the old index or the new one
+        if (!ok || rename(tmp_path, index_path) != 0) {
+            unlink(tmp_path);
+            ok = 0;
+        }
+    } else {
+        ok = 0;
+    }
+
+    free(files.data);
+    free(names.data);
+    free(postings.data);
+    free(strings.data);
+    return ok;
+}
+
+int run_indexer(const char *index_path, int jobs, int file_count, char **paths) {
+    double start = now_ms();
+    FileScan *scans = (FileScan *)calloc(file_count + 1, sizeof(FileScan));
+    if (!scans) {
+        printf("Out of memory\n");
+        return -1;
+    }
+
+    // Files unchanged since the last index keep their entries
+    XrefIndex old;
+    int have_old = xref_open(index_path, &old);
+    NameMap old_paths;
+    name_map_init(&old_paths);
+    int ok = 1;
+    for (uint32_t f = 0; have_old && ok && f < old.fileCount; f++) {
+        ok = name_map_set(&old_paths, old.strings + old.files[f].path, (int)f);
+    }
+    int reused = 0;
+    for (int i = 0; ok && i < file_count; i++) {
+        struct stat st;
+        scans[i].reused = -1;
+        if (stat(paths[i], &st) != 0) {
+            continue;
+        }
+        scans[i].size = (uint64_t)st.st_size;
+        scans[i].mtime = (uint64_t)st.st_mtim.tv_sec * 1000000000u + st.st_mtim.tv_nsec;
+        int f = have_old ? name_map_get(&old_paths, paths[i]) : -1;
+        if (f >= 0 && old.files[f].size == scans[i].size && old.files[f].mtime == scans[i].mtime) {
+            scans[i].reused = f;
+            scans[i].ok = 1;
+            reused++;
+        }
+    }
+    name_map_free(&old_paths);
+
+    // Same files in the same order, none of them changed: nothing to write
+    int current = ok && have_old && reused == file_count && old.fileCount == (uint32_t)file_count;
+    for (int i = 0; current && i < file_count; i++) {
+        current = scans[i].reused == i;
+    }
+    if (current) {
+        printf("Index %s is up to date (%d files)\n", index_path, file_count);
+        free(scans);
+        xref_close(&old);
+        return 0;
+    }
+
+    // Worker 0 runs on the calling thread
+    IndexWork work;
+    work.paths = paths;
+    work.scans = scans;
+    work.count = file_count;
+    atomic_init(&work.next, 0);
+    if (jobs < 1) {
+        jobs = 1;
+    }
+    if (jobs > file_count) {
+        jobs = file_count > 0 ? file_count : 1;
+    }
+    pthread_t *threads = (pthread_t *)calloc(jobs, sizeof(pthread_t));
+    int started = 1;
+    for (int i = 1; ok && threads && i < jobs; i++) {
+        if (pthread_create(&threads[i], NULL, index_worker, &work) != 0) {
+            break;
+        }
+        started = i + 1;
+    }
+    if (ok) {
+        index_worker(&work);
+    }
+    for (int i = 1; threads && i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+
+    // Gather the new occurrences and those of the reused files
+    size_t site_count = 0;
+    for (int i = 0; i < file_count; i++) {
+        if (scans[i].reused >= 0) {
+            site_count += old.files[scans[i].reused].sites;
+        } else if (!scans[i].ok) {
+            printf("Error opening file: %s\n", paths[i]);
+            ok = 0;
+        } else {
+            site_count += scans[i].count;
+        }
+    }
+    Occurrence *sites = ok ? (Occurrence *)malloc((site_count + 1) * sizeof(Occurrence)) : NULL;
+    XrefSite *decoded = NULL;
+    ok = ok && sites;
+    size_t gathered = 0;
+    for (int i = 0; ok && i < file_count; i++) {
+        if (scans[i].reused < 0) {
+            memcpy(sites + gathered, scans[i].sites, scans[i].count * sizeof(Occurrence));
+            gathered += scans[i].count;
+        }
+    }
+    if (ok && reused > 0) {
+        int *new_file = (int *)malloc((old.fileCount + 1) * sizeof(int));
+        ok = new_file != NULL;
+        for (uint32_t f = 0; ok && f < old.fileCount; f++) {
+            new_file[f] = -1;
+        }
+        for (int i = 0; ok && i < file_count; i++) {
+            if (scans[i].reused >= 0) {
+                new_file[scans[i].reused] = i;
+            }
+        }
+        // Names of reused entries point into the old mapping, kept until written
+        size_t decoded_capacity = 0;
+        for (uint32_t n = 0; ok && n < old.nameCount; n++) {
+            const XrefName *name = &old.names[n];
+            if (name->sites >= decoded_capacity) {
+                size_t capacity = (size_t)name->sites + 1;
+                XrefSite *grown = (XrefSite *)realloc(decoded, capacity * sizeof(XrefSite));
+                ok = grown != NULL;
+                decoded = grown ? grown : decoded;
+                decoded_capacity = grown ? capacity : decoded_capacity;
+            }
+            ok = ok && xref_sites(&old, name, decoded);
+            for (uint32_t s = 0; ok && s < name->sites; s++) {
+                int file = new_file[decoded[s].file];
+                if (file >= 0 && gathered < site_count) {
+                    Occurrence *site = &sites[gathered++];
+                    site->name = old.strings + name->text;
+                    site->file = (uint32_t)file;
+                    site->line = decoded[s].line;
+                    site->column = decoded[s].column;
+                    site->definition = decoded[s].definition;
+                }
+            }
+        }
+        free(new_file);
+        if (ok && gathered != site_count) {
+            printf("Invalid index file: %s\n", index_path);
+            ok = 0;
+        }
+    }
+
+    uint32_t name_count = 0;
+    if (ok) {
+        qsort(sites, gathered, sizeof(Occurrence), compare_occurrences);
+        ok = write_index(index_path, paths, scans, file_count, sites, gathered, &name_count);
+        if (!ok) {
+            printf("Failed to write index file %s\n", index_path);
+        }
+    }
+    if (ok) {
+        printf("Indexed %d files (%d unchanged), %u names, %zu sites in %.2f ms\n",
+               file_count, reused, name_count, gathered, now_ms() - start);
+    }
+
+    free(decoded);
+    free(sites);
+    for (int i = 0; i < file_count; i++) {
+        free(scans[i].names);
+        free(scans[i].sites);
+    }
+    free(scans);
+    if (have_old) {
+        xref_close(&old);
+    }
+    return ok ? 0 : -1;
+}
+
+int run_query(const char *index_path, int name_count, char **names) {
+    XrefIndex index;
+    if (!xref_open(index_path, &index)) {
+        printf("Invalid index file: %s\n", index_path);
+        return -1;
+    }
+
+    int missing = 0;
+    XrefSite *sites = NULL;
+    for (int i = 0; i < name_count; i++) {
+        double start = now_ms();
+        const XrefName *name = xref_find(&index, names[i]);
+        XrefSite *grown = name ? (XrefSite *)realloc(sites, ((size_t)name->sites + 1) * sizeof(XrefSite)) : NULL;
+        sites = grown ? grown : sites;
+        if (!name || !grown || !xref_sites(&index, name, sites)) {
+            printf("'%s' not found\n", names[i]);
+            missing++;
+            continue;
+        }
+        double elapsed = now_ms() - start;
+
+        // Definitions first, then uses, each in file order
+        for (int definitions = 1; definitions >= 0; definitions--) {
+            for (uint32_t s = 0; s < name->sites; s++) {
+                if (sites[s].definition == definitions) {
+                    printf("%s:%u:%u: %s of '%s'\n", index.strings + index.files[sites[s].file].path,
+                           sites[s].line, sites[s].column, definitions ? "definition" : "use", names[i]);
+                }
+            }
+        }
+        printf("'%s': %u definitions, %u uses (%.1f us)\n", names[i], name->definitions,
+               name->sites - name->definitions, elapsed * 1e3);
+    }
+
+    free(sites);
+    xref_close(&index);
+    return missing ? -1 : 0;
+}
@@ -0,0 +1,77 @@
+#ifndef XREF_H
+#define XREF_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define XREF_VERSION 1
+
+// Cross-reference index file (.idx), used in place from a mapping:
+//   header    "AXRF", version, file count, name count, postings bytes,
+//             strings bytes (u32 each)
+//   files     per file: u64 size, u64 mtime (ns), u32 path, u32 sites
+//   names     sorted by text: u32 text, u32 postings offset, u32 sites,
+//             u32 definitions
+//   postings  per name, sorted by file, line and column: varint file delta,
+//             varint line (a delta within the same file), varint
+//             column << 1 | definition
+//   strings   NUL-terminated paths and names
+// Paths and names are offsets into strings.
+
+typedef struct {
+    uint64_t size;
+    uint64_t mtime;
+    uint32_t path;
+    uint32_t sites;
+} XrefFile;
+
+typedef struct {
+    uint32_t text;
+    uint32_t postings;
+    uint32_t sites;
+    uint32_t definitions;
+} XrefName;
+
+typedef struct {
+    void *map;
+    size_t mapSize;
+    uint32_t fileCount;
+    uint32_t nameCount;
+    const XrefFile *files;
+    const XrefName *names;
+    const unsigned char *postings;
+    uint32_t postingsSize;
+    const char *strings;
+    uint32_t stringsSize;
+} XrefIndex;
+
+// One definition or use of a name
+typedef struct {
+    uint32_t file;
+    uint32_t line;
+    uint32_t column;
+    int definition;
+} XrefSite;
+
+// Map an index file. Returns 0 if it is missing or malformed.
+int xref_open(const char *path, XrefIndex *index);
+void xref_close(XrefIndex *index);
+
+// Find a name by binary search. Returns NULL if it does not occur.
+const XrefName *xref_find(const XrefIndex *index, const char *name);
+
+// Decode the sites of a name into sites (name->sites entries). Returns 0 if
+// the postings are malformed.
+int xref_sites(const XrefIndex *index, const XrefName *name, XrefSite *sites);
+
+// Index the identifiers of files on jobs threads and write them to
+// index_path. Files whose size and mtime match an existing index at that
+// path keep their entries without being read. Returns 0 on failure.
+int run_indexer(const char *index_path, int jobs, int file_count, char **files);
+
+// Print the definitions and then the uses of each name as
+// "file:line:column: definition|use of 'name'". Returns 0 if all were found.
+int run_query(const char *index_path, int name_count, char **names);
+
+#endif